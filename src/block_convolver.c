@@ -0,0 +1,852 @@
+/*! \file   block_convolver.c
+    \brief  The implementation of the streaming overlap-save and overlap-add
+            convolution.
+ 
+    \author Brent Carrara
+ */
+#include "block_convolver.h"
+
+/*! \fn     void csignal_block_convolver_convolve_frame (
+              csignal_block_convolver* io_convolver
+            )
+    \brief  Calculates the circular convolution of the frame with the kernel
+            into the first fft_length elements of fft_buffer.
+ 
+    \param  io_convolver  The convolver.
+ */
+void
+csignal_block_convolver_convolve_frame  (
+                                         csignal_block_convolver* io_convolver
+                                         );
+
+/*! \fn     void csignal_block_convolver_end_hop (
+              csignal_block_convolver* io_convolver
+            )
+    \brief  Moves the part of a complete hop that later outputs depend on to
+            the start of the frame (overlap-save) or of the overlap
+            (overlap-add) and clears the rest of the frame.
+ 
+    \param  io_convolver  The convolver whose current hop is complete.
+ */
+void
+csignal_block_convolver_end_hop (
+                                 csignal_block_convolver* io_convolver
+                                 );
+
+/*! \fn     void csignal_fdl_convolver_end_block (
+              csignal_fdl_convolver* io_convolver
+            )
+    \brief  Moves the complete current block to the start of the frame and
+            calculates the accumulator of the next block from the delay line,
+            whose most recent spectrum is the one of the current block.
+ 
+    \param  io_convolver  The convolver whose current block is complete.
+ */
+void
+csignal_fdl_convolver_end_block (
+                                 csignal_fdl_convolver* io_convolver
+                                 );
+
+csignal_error_code
+csignal_initialize_block_convolver  (
+                                     USIZE                     in_kernel_length,
+                                     FLOAT64*                  in_kernel,
+                                     USIZE                     in_fft_length,
+                                     csignal_overlap_method    in_method,
+                                     csignal_block_convolver** out_convolver
+                                     )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  USIZE fft_length =
+    ( 0 == in_fft_length
+      ? 2 * csignal_calculate_closest_power_of_two( in_kernel_length )
+      : in_fft_length );
+  
+  if( NULL == in_kernel || NULL == out_convolver )
+  {
+    CPC_ERROR (
+               "Kernel (0x%x) or convolver (0x%x) are null.",
+               in_kernel,
+               out_convolver
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           CSIGNAL_OVERLAP_SAVE != in_method
+           && CSIGNAL_OVERLAP_ADD != in_method
+           )
+  {
+    CPC_ERROR( "Unknown overlap method %d.", in_method );
+    
+    return_value = CSIGNAL_ERROR_CODE_INVALID_TYPE;
+  }
+  else if (
+           0 == in_kernel_length
+           || 2 > fft_length
+           || 0 != ( fft_length & ( fft_length - 1 ) )
+           || in_kernel_length > fft_length
+           )
+  {
+    CPC_ERROR (
+               "Kernel length (%d) or FFT length (%d) are invalid.",
+               in_kernel_length,
+               in_fft_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_convolver = NULL;
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) out_convolver,
+                       sizeof( csignal_block_convolver )
+                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_block_convolver* convolver = *out_convolver;
+      
+      convolver->method             = in_method;
+      convolver->kernel_length      = in_kernel_length;
+      convolver->fft_length         = fft_length;
+      convolver->hop_length         = fft_length - in_kernel_length + 1;
+      convolver->kernel_spectrum    = NULL;
+      convolver->frame              = NULL;
+      convolver->overlap            = NULL;
+      convolver->fft_buffer         = NULL;
+      convolver->number_of_samples  = 0;
+      convolver->plan               = NULL;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( convolver->kernel_spectrum ),
+                         sizeof( FLOAT64 ) * ( fft_length + 2 )
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( convolver->frame ),
+                           sizeof( FLOAT64 ) * fft_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( convolver->overlap ),
+                           sizeof( FLOAT64 ) * fft_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( convolver->fft_buffer ),
+                           sizeof( FLOAT64 ) * ( fft_length + 2 )
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          csignal_initialize_real_fft_plan  (
+                                             fft_length,
+                                             &( convolver->plan )
+                                             );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        //  The IFFT is unscaled, so the scale is folded into the kernel
+        for( USIZE i = 0; i < fft_length; i++ )
+        {
+          convolver->kernel_spectrum[ i ] =
+            ( i < in_kernel_length )
+            ? in_kernel[ i ] / ( fft_length * 1.0 )
+            : 0.0;
+        }
+        
+        csignal_execute_real_FFT  (
+                                   convolver->plan,
+                                   convolver->kernel_spectrum,
+                                   convolver->kernel_spectrum
+                                   );
+        
+        return_value = csignal_reset_block_convolver( convolver );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not initialize convolver: 0x%x.", return_value );
+        
+        csignal_destroy_block_convolver( *out_convolver );
+        
+        *out_convolver = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc convolver: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_block_convolver (
+                                 csignal_block_convolver* io_convolver
+                                 )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_convolver )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Convolver is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_convolver->kernel_spectrum )
+    {
+      return_value =
+        cpc_safe_free( ( void** ) &( io_convolver->kernel_spectrum ) );
+    }
+    
+    if( NULL != io_convolver->frame )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_convolver->frame ) );
+    }
+    
+    if( NULL != io_convolver->overlap )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_convolver->overlap ) );
+    }
+    
+    if( NULL != io_convolver->fft_buffer )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_convolver->fft_buffer ) );
+    }
+    
+    if( NULL != io_convolver->plan )
+    {
+      return_value = csignal_destroy_real_fft_plan( io_convolver->plan );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_convolver );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_reset_block_convolver (
+                               csignal_block_convolver* io_convolver
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_convolver )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Convolver is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    CPC_MEMSET  (
+                 io_convolver->frame,
+                 0x0,
+                 sizeof( FLOAT64 ) * io_convolver->fft_length
+                 );
+    
+    CPC_MEMSET  (
+                 io_convolver->overlap,
+                 0x0,
+                 sizeof( FLOAT64 ) * io_convolver->fft_length
+                 );
+    
+    io_convolver->number_of_samples = 0;
+  }
+  
+  return( return_value );
+}
+
+USIZE
+csignal_block_convolver_get_hop_length  (
+                                         csignal_block_convolver* in_convolver
+                                         )
+{
+  return( NULL == in_convolver ? 0 : in_convolver->hop_length );
+}
+
+csignal_error_code
+csignal_block_convolver_process (
+                                 csignal_block_convolver* io_convolver,
+                                 USIZE                    in_number_of_samples,
+                                 FLOAT64*                 in_samples,
+                                 FLOAT64*                 out_samples
+                                 )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_convolver || NULL == in_samples || NULL == out_samples )
+  {
+    CPC_ERROR (
+               "Convolver (0x%x), input (0x%x) or output (0x%x) are null.",
+               io_convolver,
+               in_samples,
+               out_samples
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    //  Overlap-save frames start with the kernel_length - 1 samples of
+    //  history, overlap-add frames with the current hop
+    USIZE frame_offset =
+      ( CSIGNAL_OVERLAP_SAVE == io_convolver->method )
+      ? io_convolver->kernel_length - 1
+      : 0;
+    
+    USIZE processed = 0;
+    
+    while( processed < in_number_of_samples )
+    {
+      USIZE first   = io_convolver->number_of_samples;
+      USIZE count   =
+        CPC_MIN (
+                 USIZE,
+                 io_convolver->hop_length - first,
+                 in_number_of_samples - processed
+                 );
+      
+      FLOAT64* frame  = io_convolver->frame + frame_offset;
+      FLOAT64* output = io_convolver->fft_buffer + frame_offset;
+      
+      for( USIZE i = 0; i < count; i++ )
+      {
+        frame[ first + i ] = in_samples[ processed + i ];
+      }
+      
+      io_convolver->number_of_samples += count;
+      
+      //  Outputs only depend on the samples before them, so a hop that is not
+      //  complete yet can be convolved with zeros in place of the rest
+      csignal_block_convolver_convolve_frame( io_convolver );
+      
+      for( USIZE i = first; i < first + count; i++ )
+      {
+        out_samples[ processed + i - first ] =
+          output[ i ] + io_convolver->overlap[ i ];
+      }
+      
+      if( io_convolver->number_of_samples == io_convolver->hop_length )
+      {
+        csignal_block_convolver_end_hop( io_convolver );
+      }
+      
+      processed += count;
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_fdl_convolver  (
+                                  USIZE                   in_kernel_length,
+                                  FLOAT64*                in_kernel,
+                                  USIZE                   in_partition_length,
+                                  csignal_fdl_convolver** out_convolver
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_kernel || NULL == out_convolver )
+  {
+    CPC_ERROR (
+               "Kernel (0x%x) or convolver (0x%x) are null.",
+               in_kernel,
+               out_convolver
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           0 == in_kernel_length
+           || 0 == in_partition_length
+           || 0 != ( in_partition_length & ( in_partition_length - 1 ) )
+           )
+  {
+    CPC_ERROR (
+               "Kernel length (%d) or partition length (%d) are invalid.",
+               in_kernel_length,
+               in_partition_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    USIZE fft_length            = 2 * in_partition_length;
+    USIZE spectrum_length       = fft_length + 2;
+    USIZE number_of_partitions  =
+      ( in_kernel_length + in_partition_length - 1 ) / in_partition_length;
+    
+    *out_convolver = NULL;
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) out_convolver,
+                       sizeof( csignal_fdl_convolver )
+                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_fdl_convolver* convolver = *out_convolver;
+      
+      convolver->kernel_length        = in_kernel_length;
+      convolver->partition_length     = in_partition_length;
+      convolver->number_of_partitions = number_of_partitions;
+      convolver->partitions           = NULL;
+      convolver->delay_line           = NULL;
+      convolver->delay_line_index     = 0;
+      convolver->accumulator          = NULL;
+      convolver->frame                = NULL;
+      convolver->fft_buffer           = NULL;
+      convolver->number_of_samples    = 0;
+      convolver->plan                 = NULL;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( convolver->partitions ),
+                         sizeof( FLOAT64 ) * spectrum_length
+                         * number_of_partitions
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( convolver->delay_line ),
+                           sizeof( FLOAT64 ) * spectrum_length
+                           * number_of_partitions
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( convolver->accumulator ),
+                           sizeof( FLOAT64 ) * spectrum_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( convolver->frame ),
+                           sizeof( FLOAT64 ) * fft_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( convolver->fft_buffer ),
+                           sizeof( FLOAT64 ) * spectrum_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          csignal_initialize_real_fft_plan  (
+                                             fft_length,
+                                             &( convolver->plan )
+                                             );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        for( USIZE p = 0; p < number_of_partitions; p++ )
+        {
+          FLOAT64* partition  = convolver->partitions + p * spectrum_length;
+          USIZE offset        = p * in_partition_length;
+          
+          //  The IFFT is unscaled, so the scale is folded into the kernel
+          for( USIZE i = 0; i < fft_length; i++ )
+          {
+            partition[ i ] =
+              ( i < in_partition_length && offset + i < in_kernel_length )
+              ? in_kernel[ offset + i ] / ( fft_length * 1.0 )
+              : 0.0;
+          }
+          
+          csignal_execute_real_FFT( convolver->plan, partition, partition );
+        }
+        
+        return_value = csignal_reset_fdl_convolver( convolver );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not initialize convolver: 0x%x.", return_value );
+        
+        csignal_destroy_fdl_convolver( *out_convolver );
+        
+        *out_convolver = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc convolver: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_fdl_convolver (
+                               csignal_fdl_convolver* io_convolver
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_convolver )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Convolver is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_convolver->partitions )
+    {
+      return_value =
+        cpc_safe_free( ( void** ) &( io_convolver->partitions ) );
+    }
+    
+    if( NULL != io_convolver->delay_line )
+    {
+      return_value =
+        cpc_safe_free( ( void** ) &( io_convolver->delay_line ) );
+    }
+    
+    if( NULL != io_convolver->accumulator )
+    {
+      return_value =
+        cpc_safe_free( ( void** ) &( io_convolver->accumulator ) );
+    }
+    
+    if( NULL != io_convolver->frame )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_convolver->frame ) );
+    }
+    
+    if( NULL != io_convolver->fft_buffer )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_convolver->fft_buffer ) );
+    }
+    
+    if( NULL != io_convolver->plan )
+    {
+      return_value = csignal_destroy_real_fft_plan( io_convolver->plan );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_convolver );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_reset_fdl_convolver (
+                             csignal_fdl_convolver* io_convolver
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_convolver )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Convolver is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    USIZE spectrum_length = 2 * io_convolver->partition_length + 2;
+    
+    CPC_MEMSET  (
+                 io_convolver->delay_line,
+                 0x0,
+                 sizeof( FLOAT64 ) * spectrum_length
+                 * io_convolver->number_of_partitions
+                 );
+    
+    CPC_MEMSET  (
+                 io_convolver->accumulator,
+                 0x0,
+                 sizeof( FLOAT64 ) * spectrum_length
+                 );
+    
+    CPC_MEMSET  (
+                 io_convolver->frame,
+                 0x0,
+                 sizeof( FLOAT64 ) * 2 * io_convolver->partition_length
+                 );
+    
+    io_convolver->delay_line_index  = 0;
+    io_convolver->number_of_samples = 0;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_fdl_convolver_process (
+                               csignal_fdl_convolver* io_convolver,
+                               USIZE                  in_number_of_samples,
+                               FLOAT64*               in_samples,
+                               FLOAT64*               out_samples
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_convolver || NULL == in_samples || NULL == out_samples )
+  {
+    CPC_ERROR (
+               "Convolver (0x%x), input (0x%x) or output (0x%x) are null.",
+               io_convolver,
+               in_samples,
+               out_samples
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    USIZE block_length    = io_convolver->partition_length;
+    USIZE fft_length      = 2 * block_length;
+    USIZE spectrum_length = fft_length + 2;
+    USIZE processed       = 0;
+    
+    FLOAT64* buffer     = io_convolver->fft_buffer;
+    FLOAT64* partition  = io_convolver->partitions;
+    
+    while( processed < in_number_of_samples )
+    {
+      USIZE first   = io_convolver->number_of_samples;
+      USIZE count   =
+        CPC_MIN (
+                 USIZE,
+                 block_length - first,
+                 in_number_of_samples - processed
+                 );
+      
+      for( USIZE i = 0; i < count; i++ )
+      {
+        io_convolver->frame[ block_length + first + i ] =
+          in_samples[ processed + i ];
+      }
+      
+      io_convolver->number_of_samples += count;
+      
+      for( USIZE i = 0; i < fft_length; i++ )
+      {
+        buffer[ i ] = io_convolver->frame[ i ];
+      }
+      
+      csignal_execute_real_FFT( io_convolver->plan, buffer, buffer );
+      
+      //  The spectrum of a complete block enters the delay line
+      if( io_convolver->number_of_samples == block_length )
+      {
+        FLOAT64* slot =
+          io_convolver->delay_line
+          + io_convolver->delay_line_index * spectrum_length;
+        
+        for( USIZE i = 0; i < spectrum_length; i++ )
+        {
+          slot[ i ] = buffer[ i ];
+        }
+      }
+      
+      //  Only the first partition sees the current block, the older blocks
+      //  were summed into the accumulator when the previous block ended
+      for( USIZE k = 0; k <= block_length; k++ )
+      {
+        FLOAT64 ar = buffer[ 2 * k ];
+        FLOAT64 ai = buffer[ 2 * k + 1 ];
+        FLOAT64 br = partition[ 2 * k ];
+        FLOAT64 bi = partition[ 2 * k + 1 ];
+        
+        buffer[ 2 * k ]     =
+          ar * br - ai * bi + io_convolver->accumulator[ 2 * k ];
+        buffer[ 2 * k + 1 ] =
+          ar * bi + ai * br + io_convolver->accumulator[ 2 * k + 1 ];
+      }
+      
+      csignal_execute_real_IFFT( io_convolver->plan, buffer, buffer );
+      
+      for( USIZE i = 0; i < count; i++ )
+      {
+        out_samples[ processed + i ] = buffer[ block_length + first + i ];
+      }
+      
+      if( io_convolver->number_of_samples == block_length )
+      {
+        csignal_fdl_convolver_end_block( io_convolver );
+      }
+      
+      processed += count;
+    }
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_block_convolver_convolve_frame  (
+                                         csignal_block_convolver* io_convolver
+                                         )
+{
+  FLOAT64* buffer   = io_convolver->fft_buffer;
+  FLOAT64* spectrum = io_convolver->kernel_spectrum;
+  
+  for( USIZE i = 0; i < io_convolver->fft_length; i++ )
+  {
+    buffer[ i ] = io_convolver->frame[ i ];
+  }
+  
+  csignal_execute_real_FFT( io_convolver->plan, buffer, buffer );
+  
+  for( USIZE k = 0; k <= io_convolver->fft_length / 2; k++ )
+  {
+    FLOAT64 ar = buffer[ 2 * k ];
+    FLOAT64 ai = buffer[ 2 * k + 1 ];
+    FLOAT64 br = spectrum[ 2 * k ];
+    FLOAT64 bi = spectrum[ 2 * k + 1 ];
+    
+    buffer[ 2 * k ]     = ar * br - ai * bi;
+    buffer[ 2 * k + 1 ] = ar * bi + ai * br;
+  }
+  
+  csignal_execute_real_IFFT( io_convolver->plan, buffer, buffer );
+}
+
+void
+csignal_block_convolver_end_hop (
+                                 csignal_block_convolver* io_convolver
+                                 )
+{
+  USIZE hop_length  = io_convolver->hop_length;
+  USIZE overlap     = io_convolver->kernel_length - 1;
+  
+  if( CSIGNAL_OVERLAP_SAVE == io_convolver->method )
+  {
+    //  The frame is full, its last kernel_length - 1 samples become the
+    //  history of the next hop
+    for( USIZE i = 0; i < overlap; i++ )
+    {
+      io_convolver->frame[ i ] = io_convolver->frame[ hop_length + i ];
+    }
+    
+    for( USIZE i = overlap; i < io_convolver->fft_length; i++ )
+    {
+      io_convolver->frame[ i ] = 0.0;
+    }
+  }
+  else
+  {
+    //  The outputs of the hop past its end (and of the earlier hops if the
+    //  hop is shorter than the kernel) overlap the following hops
+    for( USIZE i = 0; i < overlap; i++ )
+    {
+      io_convolver->overlap[ i ] =
+        io_convolver->fft_buffer[ hop_length + i ]
+        + io_convolver->overlap[ hop_length + i ];
+    }
+    
+    for( USIZE i = overlap; i < io_convolver->fft_length; i++ )
+    {
+      io_convolver->overlap[ i ] = 0.0;
+    }
+    
+    for( USIZE i = 0; i < hop_length; i++ )
+    {
+      io_convolver->frame[ i ] = 0.0;
+    }
+  }
+  
+  io_convolver->number_of_samples = 0;
+}
+
+void
+csignal_fdl_convolver_end_block (
+                                 csignal_fdl_convolver* io_convolver
+                                 )
+{
+  USIZE block_length          = io_convolver->partition_length;
+  USIZE spectrum_length       = 2 * block_length + 2;
+  USIZE number_of_partitions  = io_convolver->number_of_partitions;
+  USIZE index                 = io_convolver->delay_line_index;
+  
+  FLOAT64* accumulator = io_convolver->accumulator;
+  FLOAT64* frame       = io_convolver->frame;
+  
+  for( USIZE i = 0; i < block_length; i++ )
+  {
+    frame[ i ]                = frame[ block_length + i ];
+    frame[ block_length + i ] = 0.0;
+  }
+  
+  CPC_MEMSET( accumulator, 0x0, sizeof( FLOAT64 ) * spectrum_length );
+  
+  //  For the next block j + 1, partition p > 0 sees block j + 1 - p, i.e.,
+  //  the current block for p = 1 and older ones going back in the ring
+  for( USIZE p = 1; p < number_of_partitions; p++ )
+  {
+    FLOAT64* partition  = io_convolver->partitions + p * spectrum_length;
+    FLOAT64* spectrum   =
+      io_convolver->delay_line
+      + ( ( index + number_of_partitions - ( p - 1 ) ) % number_of_partitions )
+      * spectrum_length;
+    
+    for( USIZE k = 0; k <= block_length; k++ )
+    {
+      FLOAT64 ar = spectrum[ 2 * k ];
+      FLOAT64 ai = spectrum[ 2 * k + 1 ];
+      FLOAT64 br = partition[ 2 * k ];
+      FLOAT64 bi = partition[ 2 * k + 1 ];
+      
+      accumulator[ 2 * k ]      += ar * br - ai * bi;
+      accumulator[ 2 * k + 1 ]  += ar * bi + ai * br;
+    }
+  }
+  
+  io_convolver->delay_line_index  = ( index + 1 ) % number_of_partitions;
+  io_convolver->number_of_samples = 0;
+}
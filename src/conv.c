@@ -3,6 +3,245 @@
  */
 #include "conv.h"
 
+#include "conv_kernels.h"
+#include "fft.h"
+#include "thread_pool.h"
+
+/*! \fn     CPC_BOOL csignal_convolve_prefers_fft (
+              USIZE in_signal_one_length,
+              USIZE in_signal_two_length,
+              USIZE in_number_of_outputs,
+              USIZE in_decimation
+            )
+    \brief  Decides whether the FFT method is faster than the direct sum for
+            the given signal lengths (see
+            CSIGNAL_CONVOLUTION_FFT_CROSSOVER_FACTOR). The FFT method calculates
+            every output of a piece while the direct sum only calculates the
+            ones that are kept, so the crossover grows with the decimation.
+ 
+    \param  in_signal_one_length  The number of elements in signal one.
+    \param  in_signal_two_length  The number of elements in siganl two.
+    \param  in_number_of_outputs  The number of outputs of the convolution
+                                  the kept outputs are taken from.
+    \param  in_decimation The distance between kept outputs.
+    \return CPC_TRUE if the FFT method should be used, CPC_FALSE otherwise.
+ */
+CPC_BOOL
+csignal_convolve_prefers_fft  (
+                               USIZE in_signal_one_length,
+                               USIZE in_signal_two_length,
+                               USIZE in_number_of_outputs,
+                               USIZE in_decimation
+                               );
+
+/*! \var    csignal_convolution_job
+    \brief  The state shared by the tasks of a convolution. The outputs are
+            cut into pieces of chunk_length outputs and every task calculates
+            a contiguous range of pieces. Output k is sample first_output + k *
+            decimation of the full convolution.
+ */
+typedef struct csignal_convolution_job_t
+{
+  /*! \var    signal_length
+      \brief  The number of samples in signal, the longer of the two signals.
+   */
+  USIZE                   signal_length;
+  
+  /*! \var    signal
+      \brief  The longer of the two signals.
+   */
+  FLOAT64*                signal;
+  
+  /*! \var    filter_length
+      \brief  The number of samples in filter, the shorter of the two signals.
+   */
+  USIZE                   filter_length;
+  
+  /*! \var    filter
+      \brief  The shorter of the two signals.
+   */
+  FLOAT64*                filter;
+  
+  /*! \var    symmetric
+      \brief  True if filter is symmetric.
+   */
+  CPC_BOOL                symmetric;
+  
+  /*! \var    first_output
+      \brief  The index of the first output in the full convolution.
+   */
+  USIZE                   first_output;
+  
+  /*! \var    decimation
+      \brief  The distance between consecutive outputs in the full
+              convolution.
+   */
+  USIZE                   decimation;
+  
+  /*! \var    output_length
+      \brief  The number of outputs to calculate.
+   */
+  USIZE                   output_length;
+  
+  /*! \var    chunk_length
+      \brief  The number of outputs in a piece.
+   */
+  USIZE                   chunk_length;
+  
+  /*! \var    number_of_chunks
+      \brief  The number of pieces, the last of which may be shorter.
+   */
+  USIZE                   number_of_chunks;
+  
+  /*! \var    number_of_tasks
+      \brief  The number of ranges the pieces are divided into.
+   */
+  USIZE                   number_of_tasks;
+  
+  /*! \var    plan
+      \brief  The real-input plan used to calculate a piece with overlap-save,
+              or null for the direct sum.
+   */
+  csignal_real_fft_plan*  plan;
+  
+  /*! \var    filter_spectrum
+      \brief  The FFT of the zero-padded filter scaled by 1 / fft_length.
+   */
+  FLOAT64*                filter_spectrum;
+  
+  /*! \var    buffers
+      \brief  One FFT buffer of fft_length + 2 elements per task.
+   */
+  FLOAT64*                buffers;
+  
+  /*! \var    scratch
+      \brief  The work space of the FFTs of a task, scratch_length elements
+              per task, or null if the plan needs none. The plan may be shared
+              with other threads, so its own scratch space is not used.
+   */
+  FLOAT64*                scratch;
+  
+  /*! \var    scratch_length
+      \brief  csignal_get_real_fft_scratch_length( plan ).
+   */
+  USIZE                   scratch_length;
+  
+  /*! \var    out_signal
+      \brief  The output_length outputs.
+   */
+  FLOAT64*                out_signal;
+  
+} csignal_convolution_job;
+
+/*! \fn     csignal_error_code csignal_convolve_region (
+              USIZE                      in_signal_one_length,
+              FLOAT64*                   in_signal_one,
+              USIZE                      in_signal_two_length,
+              FLOAT64*                   in_signal_two,
+              CPC_BOOL                   in_symmetric,
+              csignal_convolution_mode   in_mode,
+              csignal_convolution_method in_method,
+              USIZE                      in_decimation,
+              USIZE*                     out_signal_length,
+              FLOAT64**                  out_signal
+            )
+    \brief  Implements convolve_decimated and convolve_symmetric, which differ
+            only in whether signal two is known to be symmetric.
+ 
+    \param  in_symmetric  If true signal two is symmetric, see
+                          csignal_convolve_partitioned.
+    \return See convolve_decimated.
+ */
+csignal_error_code
+csignal_convolve_region (
+                         USIZE                      in_signal_one_length,
+                         FLOAT64*                   in_signal_one,
+                         USIZE                      in_signal_two_length,
+                         FLOAT64*                   in_signal_two,
+                         CPC_BOOL                   in_symmetric,
+                         csignal_convolution_mode   in_mode,
+                         csignal_convolution_method in_method,
+                         USIZE                      in_decimation,
+                         USIZE*                     out_signal_length,
+                         FLOAT64**                  out_signal
+                         );
+
+/*! \fn     csignal_error_code csignal_convolve_partitioned (
+              USIZE                       in_signal_one_length,
+              FLOAT64*                    in_signal_one,
+              USIZE                       in_signal_two_length,
+              FLOAT64*                    in_signal_two,
+              csignal_convolution_filter* io_filter,
+              CPC_BOOL                    in_symmetric,
+              USIZE                       in_first_output,
+              USIZE                       in_decimation,
+              USIZE                       in_number_of_outputs,
+              CPC_BOOL                    in_use_fft,
+              FLOAT64*                    out_signal
+            )
+    \brief  Calculates in_number_of_outputs samples of the full convolution of
+            signal one and two, every in_decimation-th starting at sample
+            in_first_output, in pieces of the grain size spread over the
+            threads of the shared pool. Outputs past the end of the
+            convolution are zero.
+ 
+    \param  in_signal_one_length  The number of elements in signal one.
+    \param  in_signal_one One of the two signals to be convolved.
+    \param  in_signal_two_length  The number of elements in siganl two.
+    \param  in_signal_two The second signal to be used in the convolution.
+    \param  io_filter If not null, the filter whose taps are signal two. Its
+                      spectrum is used, and replaced if the FFT length
+                      differs, instead of transforming signal two.
+    \param  in_symmetric  If true signal two is symmetric and, when it is the
+                          shorter signal, the direct sum uses the folded
+                          kernels (see csignal_conv_run_symmetric_kernel).
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_decimation The distance between consecutive outputs, at least
+                          one.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  in_use_fft  If true the pieces are calculated with FFTs, otherwise
+                        with the direct sum. Both lengths must then be greater
+                        than zero.
+    \param  out_signal  The in_number_of_outputs outputs.
+    \return Returns NO_ERROR upon succesful exection or an error from
+            cpc_safe_malloc or csignal_get_real_fft_plan.
+ */
+csignal_error_code
+csignal_convolve_partitioned  (
+                               USIZE                       in_signal_one_length,
+                               FLOAT64*                    in_signal_one,
+                               USIZE                       in_signal_two_length,
+                               FLOAT64*                    in_signal_two,
+                               csignal_convolution_filter* io_filter,
+                               CPC_BOOL                    in_symmetric,
+                               USIZE                       in_first_output,
+                               USIZE                       in_decimation,
+                               USIZE                       in_number_of_outputs,
+                               CPC_BOOL                    in_use_fft,
+                               FLOAT64*                    out_signal
+                               );
+
+/*! \fn     void csignal_convolution_task (
+              void* in_job,
+              USIZE in_index
+            )
+    \brief  Calculates the pieces of range in_index.
+ 
+    \param  in_job  The csignal_convolution_job.
+    \param  in_index  The range of pieces to calculate.
+ */
+void
+csignal_convolution_task  (
+                           void* in_job,
+                           USIZE in_index
+                           );
+
+/*! \var    csignal_convolution_grain_size
+    \brief  The number of outputs in a piece of work, 0 for a single piece.
+ */
+static USIZE csignal_convolution_grain_size =
+  CSIGNAL_CONVOLUTION_DEFAULT_GRAIN_SIZE;
+
 csignal_error_code
 convolve  (
            USIZE       in_signal_one_length,
@@ -12,9 +251,174 @@ convolve  (
            USIZE*      out_signal_length,
            FLOAT64**   out_signal
            )
+{
+  return  (
+           convolve_with_method (
+                                 in_signal_one_length,
+                                 in_signal_one,
+                                 in_signal_two_length,
+                                 in_signal_two,
+                                 CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC,
+                                 out_signal_length,
+                                 out_signal
+                                 )
+           );
+}
+
+csignal_error_code
+convolve_with_method  (
+                       USIZE                      in_signal_one_length,
+                       FLOAT64*                   in_signal_one,
+                       USIZE                      in_signal_two_length,
+                       FLOAT64*                   in_signal_two,
+                       csignal_convolution_method in_method,
+                       USIZE*                     out_signal_length,
+                       FLOAT64**                  out_signal
+                       )
+{
+  return  (
+           convolve_with_mode (
+                               in_signal_one_length,
+                               in_signal_one,
+                               in_signal_two_length,
+                               in_signal_two,
+                               CSIGNAL_CONVOLUTION_MODE_FULL,
+                               in_method,
+                               out_signal_length,
+                               out_signal
+                               )
+           );
+}
+
+csignal_error_code
+convolve_with_mode  (
+                     USIZE                      in_signal_one_length,
+                     FLOAT64*                   in_signal_one,
+                     USIZE                      in_signal_two_length,
+                     FLOAT64*                   in_signal_two,
+                     csignal_convolution_mode   in_mode,
+                     csignal_convolution_method in_method,
+                     USIZE*                     out_signal_length,
+                     FLOAT64**                  out_signal
+                     )
+{
+  return  (
+           convolve_decimated (
+                               in_signal_one_length,
+                               in_signal_one,
+                               in_signal_two_length,
+                               in_signal_two,
+                               in_mode,
+                               in_method,
+                               1,
+                               out_signal_length,
+                               out_signal
+                               )
+           );
+}
+
+csignal_error_code
+convolve_decimated  (
+                     USIZE                      in_signal_one_length,
+                     FLOAT64*                   in_signal_one,
+                     USIZE                      in_signal_two_length,
+                     FLOAT64*                   in_signal_two,
+                     csignal_convolution_mode   in_mode,
+                     csignal_convolution_method in_method,
+                     USIZE                      in_decimation,
+                     USIZE*                     out_signal_length,
+                     FLOAT64**                  out_signal
+                     )
+{
+  return  (
+           csignal_convolve_region  (
+                                     in_signal_one_length,
+                                     in_signal_one,
+                                     in_signal_two_length,
+                                     in_signal_two,
+                                     CPC_FALSE,
+                                     in_mode,
+                                     in_method,
+                                     in_decimation,
+                                     out_signal_length,
+                                     out_signal
+                                     )
+           );
+}
+
+csignal_error_code
+convolve_symmetric  (
+                     USIZE                      in_signal_length,
+                     FLOAT64*                   in_signal,
+                     USIZE                      in_filter_length,
+                     FLOAT64*                   in_filter,
+                     csignal_convolution_mode   in_mode,
+                     csignal_convolution_method in_method,
+                     USIZE                      in_decimation,
+                     USIZE*                     out_signal_length,
+                     FLOAT64**                  out_signal
+                     )
+{
+  return  (
+           csignal_convolve_region  (
+                                     in_signal_length,
+                                     in_signal,
+                                     in_filter_length,
+                                     in_filter,
+                                     CPC_TRUE,
+                                     in_mode,
+                                     in_method,
+                                     in_decimation,
+                                     out_signal_length,
+                                     out_signal
+                                     )
+           );
+}
+
+csignal_error_code
+csignal_convolve_region (
+                         USIZE                      in_signal_one_length,
+                         FLOAT64*                   in_signal_one,
+                         USIZE                      in_signal_two_length,
+                         FLOAT64*                   in_signal_two,
+                         CPC_BOOL                   in_symmetric,
+                         csignal_convolution_mode   in_mode,
+                         csignal_convolution_method in_method,
+                         USIZE                      in_decimation,
+                         USIZE*                     out_signal_length,
+                         FLOAT64**                  out_signal
+                         )
 {
   csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
   
+  USIZE shorter_length =
+    CPC_MIN( USIZE, in_signal_one_length, in_signal_two_length );
+  USIZE longer_length  =
+    CPC_MAX( USIZE, in_signal_one_length, in_signal_two_length );
+  
+  //  The region of the full convolution the mode keeps, the full convolution
+  //  keeps its historical trailing zero
+  USIZE first_output  = 0;
+  USIZE region_length = in_signal_one_length + in_signal_two_length;
+  USIZE output_length = 0;
+  
+  if( 0 < shorter_length && CSIGNAL_CONVOLUTION_MODE_SAME == in_mode )
+  {
+    first_output  = ( in_signal_two_length - 1 ) / 2;
+    region_length = in_signal_one_length;
+  }
+  else if( 0 < shorter_length && CSIGNAL_CONVOLUTION_MODE_VALID == in_mode )
+  {
+    first_output  = shorter_length - 1;
+    region_length = longer_length - shorter_length + 1;
+  }
+  
+  //  Every in_decimation-th sample of the region, starting with its first
+  if( 0 < in_decimation )
+  {
+    output_length = ( region_length + in_decimation - 1 ) / in_decimation;
+  }
+  
   if  (
        NULL == in_signal_one
        || NULL == in_signal_two
@@ -31,20 +435,51 @@ convolve  (
                );
   }
   else if (
-           *out_signal_length != 0
-           && (
-               in_signal_one_length + in_signal_two_length
-               ) > *out_signal_length
+           CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC != in_method
+           && CSIGNAL_CONVOLUTION_METHOD_DIRECT != in_method
+           && CSIGNAL_CONVOLUTION_METHOD_FFT != in_method
+           )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR( "Convolution method (%d) is unknown.", in_method );
+  }
+  else if (
+           CSIGNAL_CONVOLUTION_MODE_FULL != in_mode
+           && CSIGNAL_CONVOLUTION_MODE_SAME != in_mode
+           && CSIGNAL_CONVOLUTION_MODE_VALID != in_mode
            )
   {
     return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
     
+    CPC_ERROR( "Convolution mode (%d) is unknown.", in_mode );
+  }
+  else if( 0 == in_decimation )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR( "Decimation (%d) must be greater than zero.", in_decimation );
+  }
+  else if( CSIGNAL_CONVOLUTION_MODE_FULL != in_mode && 0 == shorter_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Signal one (%d) and two (%d) must not be empty in mode %d.",
+               in_signal_one_length,
+               in_signal_two_length,
+               in_mode
+               );
+  }
+  else if( *out_signal_length != 0 && output_length > *out_signal_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
     CPC_ERROR (
                "Signal length (%d) must be greater or equal to the length of"
-               " signal one (%d) plus signal two (%d).",
+               " the convolution (%d).",
                *out_signal_length,
-               in_signal_one_length,
-               in_signal_two_length
+               output_length
                );
   }
   else if( *out_signal_length != 0 && NULL == *out_signal )
@@ -59,37 +494,67 @@ convolve  (
   }
   else
   {
+    CPC_BOOL allocated = CPC_FALSE;
+    
     if( NULL == *out_signal )
     {
       return_value =
         cpc_safe_malloc (
                          ( void** ) out_signal,
-                         sizeof( FLOAT64 )
-                         * ( in_signal_one_length + in_signal_two_length )
+                         sizeof( FLOAT64 ) * output_length
                          );
+      
+      allocated = CPC_TRUE;
     }
     
     if( CPC_ERROR_CODE_NO_ERROR == return_value )
     {
-      *out_signal_length = in_signal_one_length + in_signal_two_length;
+      *out_signal_length = output_length;
+      
+      //  An empty signal has nothing to transform
+      CPC_BOOL use_fft =
+        (
+         0 < shorter_length
+         && (
+             CSIGNAL_CONVOLUTION_METHOD_FFT == in_method
+             || (
+                 CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC == in_method
+                 && csignal_convolve_prefers_fft  (
+                                                   in_signal_one_length,
+                                                   in_signal_two_length,
+                                                   region_length,
+                                                   in_decimation
+                                                   )
+                 )
+             )
+         );
       
-      for( SSIZE i = 0; i < *out_signal_length; i++ )
+      return_value =
+        csignal_convolve_partitioned  (
+                                       in_signal_one_length,
+                                       in_signal_one,
+                                       in_signal_two_length,
+                                       in_signal_two,
+                                       NULL,
+                                       in_symmetric,
+                                       first_output,
+                                       in_decimation,
+                                       output_length,
+                                       use_fft,
+                                       *out_signal
+                                       );
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
       {
-        FLOAT64 value = 0;
-        
-        SSIZE min =
-          ( i >= in_signal_two_length - 1 )
-          ? i - ( in_signal_two_length - 1 ) : 0;
+        CPC_ERROR( "Could not convolve signals: 0x%x.", return_value );
         
-        SSIZE max =
-          ( i < in_signal_one_length - 1 ) ? i : in_signal_one_length - 1;
-        
-        for( SSIZE j = min; j <= max; j++ )
+        if( allocated )
         {
-          value += in_signal_one[ j ] * in_signal_two[ i - j ];
+          cpc_safe_free( ( void** ) out_signal );
         }
         
-        ( *out_signal )[ i ] = value;
+        *out_signal_length = 0;
+        *out_signal        = NULL;
       }
     }
     else
@@ -103,3 +568,629 @@ convolve  (
   
   return( return_value );
 }
+
+csignal_error_code
+csignal_initialize_convolution_filter (
+                                       USIZE                         in_length,
+                                       FLOAT64*                      in_taps,
+                                       csignal_convolution_filter**  out_filter
+                                       )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_taps || NULL == out_filter )
+  {
+    CPC_ERROR (
+               "Taps (0x%x) or filter (0x%x) are null.",
+               in_taps,
+               out_filter
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Filter must have taps." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_filter = NULL;
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) out_filter,
+                       sizeof( csignal_convolution_filter )
+                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_convolution_filter* filter = *out_filter;
+      
+      filter->number_of_taps  = in_length;
+      filter->taps            = NULL;
+      filter->fft_length      = 0;
+      filter->spectrum        = NULL;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( filter->taps ),
+                         sizeof( FLOAT64 ) * in_length
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        for( USIZE i = 0; i < in_length; i++ )
+        {
+          filter->taps[ i ] = in_taps[ i ];
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not malloc taps: 0x%x.", return_value );
+        
+        csignal_destroy_convolution_filter( *out_filter );
+        
+        *out_filter = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc filter: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_convolution_filter  (
+                                     csignal_convolution_filter* io_filter
+                                     )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_filter )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Filter is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_filter->taps )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_filter->taps ) );
+    }
+    
+    if( NULL != io_filter->spectrum )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_filter->spectrum ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_filter );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+convolve_with_filter  (
+                       csignal_convolution_filter* io_filter,
+                       USIZE                       in_signal_length,
+                       FLOAT64*                    in_signal,
+                       csignal_convolution_method  in_method,
+                       USIZE                       in_first_output,
+                       USIZE                       in_decimation,
+                       USIZE                       in_number_of_outputs,
+                       FLOAT64*                    out_signal
+                       )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_filter || NULL == in_signal || NULL == out_signal )
+  {
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+    
+    CPC_ERROR (
+               "Filter (0x%x), signal (0x%x), or out (0x%x) are null.",
+               io_filter,
+               in_signal,
+               out_signal
+               );
+  }
+  else if (
+           CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC != in_method
+           && CSIGNAL_CONVOLUTION_METHOD_DIRECT != in_method
+           && CSIGNAL_CONVOLUTION_METHOD_FFT != in_method
+           )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR( "Convolution method (%d) is unknown.", in_method );
+  }
+  else if( 0 == in_decimation )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR( "Decimation (%d) must be greater than zero.", in_decimation );
+  }
+  else
+  {
+    //  An empty signal has nothing to transform
+    CPC_BOOL use_fft =
+      (
+       0 < in_signal_length
+       && (
+           CSIGNAL_CONVOLUTION_METHOD_FFT == in_method
+           || (
+               CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC == in_method
+               && csignal_convolve_prefers_fft  (
+                                                 in_signal_length,
+                                                 io_filter->number_of_taps,
+                                                 in_number_of_outputs
+                                                 * in_decimation,
+                                                 in_decimation
+                                                 )
+               )
+           )
+       );
+    
+    return_value =
+      csignal_convolve_partitioned  (
+                                     in_signal_length,
+                                     in_signal,
+                                     io_filter->number_of_taps,
+                                     io_filter->taps,
+                                     io_filter,
+                                     CPC_FALSE,
+                                     in_first_output,
+                                     in_decimation,
+                                     in_number_of_outputs,
+                                     use_fft,
+                                     out_signal
+                                     );
+    
+    if( CPC_ERROR_CODE_NO_ERROR != return_value )
+    {
+      CPC_ERROR( "Could not convolve signal: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_set_convolution_grain_size  (
+                                     USIZE in_grain_size
+                                     )
+{
+  csignal_convolution_grain_size = in_grain_size;
+}
+
+USIZE
+csignal_get_convolution_grain_size( void )
+{
+  return( csignal_convolution_grain_size );
+}
+
+CPC_BOOL
+csignal_convolve_prefers_fft  (
+                               USIZE in_signal_one_length,
+                               USIZE in_signal_two_length,
+                               USIZE in_number_of_outputs,
+                               USIZE in_decimation
+                               )
+{
+  USIZE shorter_length =
+    CPC_MIN( USIZE, in_signal_one_length, in_signal_two_length );
+  USIZE fft_length  = in_number_of_outputs + shorter_length - 1;
+  USIZE log_length  = 0;
+  
+  //  Long convolutions are calculated in pieces (see
+  //  csignal_convolve_partitioned) whose FFT length depends on the grain size
+  if( 0 != csignal_convolution_grain_size )
+  {
+    fft_length =
+      CPC_MIN (
+               USIZE,
+               CPC_MAX( USIZE, csignal_convolution_grain_size, shorter_length )
+               + shorter_length - 1,
+               fft_length
+               );
+  }
+  
+  fft_length = csignal_calculate_closest_power_of_two( fft_length );
+  
+  while( 1 < ( fft_length >> log_length ) )
+  {
+    log_length++;
+  }
+  
+  return  (
+           CSIGNAL_CONVOLUTION_FFT_CROSSOVER_FACTOR * log_length * in_decimation
+           <= shorter_length
+           );
+}
+
+csignal_error_code
+csignal_convolve_partitioned  (
+                               USIZE                       in_signal_one_length,
+                               FLOAT64*                    in_signal_one,
+                               USIZE                       in_signal_two_length,
+                               FLOAT64*                    in_signal_two,
+                               csignal_convolution_filter* io_filter,
+                               CPC_BOOL                    in_symmetric,
+                               USIZE                       in_first_output,
+                               USIZE                       in_decimation,
+                               USIZE                       in_number_of_outputs,
+                               CPC_BOOL                    in_use_fft,
+                               FLOAT64*                    out_signal
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  csignal_thread_pool* pool = csignal_get_thread_pool();
+  
+  csignal_convolution_job job;
+  
+  USIZE convolution_length  = 0;
+  USIZE fft_length          = 0;
+  
+  //  The shorter signal is the filter so the vectorized interior of the
+  //  direct kernels and the pieces of the FFT method are as long as possible,
+  //  unless the spectrum of signal two is cached
+  if( NULL != io_filter || in_signal_two_length <= in_signal_one_length )
+  {
+    job.signal_length = in_signal_one_length;
+    job.signal        = in_signal_one;
+    job.filter_length = in_signal_two_length;
+    job.filter        = in_signal_two;
+    job.symmetric     = in_symmetric;
+  }
+  else
+  {
+    job.signal_length = in_signal_two_length;
+    job.signal        = in_signal_two;
+    job.filter_length = in_signal_one_length;
+    job.filter        = in_signal_one;
+    job.symmetric     = CPC_FALSE;
+  }
+  
+  if( 0 < job.filter_length )
+  {
+    convolution_length = job.signal_length + job.filter_length - 1;
+  }
+  
+  //  Only outputs inside the convolution are calculated, the rest are zero
+  job.first_output  = in_first_output;
+  job.decimation    = in_decimation;
+  job.output_length =
+    ( in_first_output < convolution_length )
+    ? CPC_MIN (
+               USIZE,
+               in_number_of_outputs,
+               ( convolution_length - 1 - in_first_output ) / in_decimation
+               + 1
+               )
+    : 0;
+  
+  for( USIZE i = job.output_length; i < in_number_of_outputs; i++ )
+  {
+    out_signal[ i ] = 0.0;
+  }
+  
+  job.chunk_length    =
+    ( 0 == csignal_convolution_grain_size )
+    ? job.output_length : csignal_convolution_grain_size;
+  job.plan            = NULL;
+  job.filter_spectrum = NULL;
+  job.buffers         = NULL;
+  job.scratch         = NULL;
+  job.scratch_length  = 0;
+  job.out_signal      = out_signal;
+  
+  if( in_use_fft )
+  {
+    //  With overlap-save a piece spanning S samples of the convolution needs
+    //  S + filter_length - 1 inputs, so the span is grown to fill the power
+    //  of two FFT. The span, and with it the FFT length, does not depend on
+    //  the decimation, a piece of B outputs spans ( B - 1 ) * decimation + 1
+    //  samples.
+    USIZE piece_length =
+      CPC_MAX( USIZE, job.chunk_length, job.filter_length );
+    
+    fft_length =
+      csignal_calculate_closest_power_of_two  (
+                                               CPC_MAX  (
+                                                         USIZE,
+                                                         piece_length
+                                                         + job.filter_length
+                                                         - 1,
+                                                         2
+                                                         )
+                                               );
+    
+    job.chunk_length = ( fft_length - job.filter_length ) / in_decimation + 1;
+  }
+  
+  job.chunk_length      = CPC_MAX( USIZE, job.chunk_length, 1 );
+  job.number_of_chunks  =
+    ( job.output_length + job.chunk_length - 1 ) / job.chunk_length;
+  
+  if( in_use_fft && 1 == job.number_of_chunks )
+  {
+    //  A single piece only needs to hold the convolution of the inputs it
+    //  covers, e.g., the whole signal for the full convolution
+    USIZE first_input =
+      ( in_first_output >= job.filter_length - 1 )
+      ? in_first_output - ( job.filter_length - 1 ) : 0;
+    USIZE last_input  =
+      CPC_MIN (
+               USIZE,
+               in_first_output + ( job.output_length - 1 ) * in_decimation + 1,
+               job.signal_length
+               );
+    
+    fft_length =
+      csignal_calculate_closest_power_of_two  (
+                                               CPC_MAX  (
+                                                         USIZE,
+                                                         last_input
+                                                         - first_input
+                                                         + job.filter_length
+                                                         - 1,
+                                                         2
+                                                         )
+                                               );
+  }
+  
+  if( in_use_fft && 0 < job.number_of_chunks )
+  {
+    return_value = csignal_get_real_fft_plan( fft_length, &job.plan );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      //  A six-step transform already runs on the pool and must not be
+      //  called from one of its tasks
+      if( NULL != job.plan->complex_plan->row_plan )
+      {
+        pool = NULL;
+      }
+      
+      if( NULL == io_filter )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &job.filter_spectrum,
+                           sizeof( FLOAT64 ) * ( fft_length + 2 )
+                           );
+      }
+      else if( fft_length != io_filter->fft_length )
+      {
+        //  The cached spectrum is for another FFT length
+        if( NULL != io_filter->spectrum )
+        {
+          cpc_safe_free( ( void** ) &( io_filter->spectrum ) );
+        }
+        
+        io_filter->fft_length = 0;
+        
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( io_filter->spectrum ),
+                           sizeof( FLOAT64 ) * ( fft_length + 2 )
+                           );
+      }
+    }
+  }
+  
+  job.number_of_tasks =
+    CPC_MAX (
+             USIZE,
+             CPC_MIN  (
+                       USIZE,
+                       csignal_thread_pool_get_number_of_threads( pool ),
+                       job.number_of_chunks
+                       ),
+             1
+             );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value && NULL != job.plan )
+  {
+    job.scratch_length = csignal_get_real_fft_scratch_length( job.plan );
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) &job.buffers,
+                       sizeof( FLOAT64 ) * ( fft_length + 2 )
+                       * job.number_of_tasks
+                       );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value && 0 < job.scratch_length )
+  {
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) &job.scratch,
+                       sizeof( FLOAT64 ) * job.scratch_length
+                       * job.number_of_tasks
+                       );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value )
+  {
+    FLOAT64* spectrum =
+      ( NULL == io_filter ) ? job.filter_spectrum : io_filter->spectrum;
+    
+    if  (
+         NULL != job.plan
+         && ( NULL == io_filter || fft_length != io_filter->fft_length )
+         )
+    {
+      FLOAT64 scale = 1.0 / ( fft_length * 1.0 );
+      
+      for( USIZE i = 0; i < fft_length; i++ )
+      {
+        spectrum[ i ] =
+          ( i < job.filter_length ? scale * job.filter[ i ] : 0.0 );
+      }
+      
+      csignal_execute_real_FFT_with_scratch (
+                                             job.plan,
+                                             job.scratch,
+                                             spectrum,
+                                             spectrum
+                                             );
+      
+      if( NULL != io_filter )
+      {
+        io_filter->fft_length = fft_length;
+      }
+    }
+    
+    job.filter_spectrum = spectrum;
+    
+    csignal_thread_pool_run (
+                             pool,
+                             job.number_of_tasks,
+                             csignal_convolution_task,
+                             &job
+                             );
+  }
+  
+  if( NULL == io_filter && NULL != job.filter_spectrum )
+  {
+    cpc_safe_free( ( void** ) &job.filter_spectrum );
+  }
+  
+  if( NULL != job.buffers )
+  {
+    cpc_safe_free( ( void** ) &job.buffers );
+  }
+  
+  if( NULL != job.scratch )
+  {
+    cpc_safe_free( ( void** ) &job.scratch );
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_convolution_task  (
+                           void* in_job,
+                           USIZE in_index
+                           )
+{
+  csignal_convolution_job* job = ( csignal_convolution_job* ) in_job;
+  
+  USIZE first_chunk =
+    ( job->number_of_chunks * in_index ) / job->number_of_tasks;
+  USIZE last_chunk  =
+    ( job->number_of_chunks * ( in_index + 1 ) ) / job->number_of_tasks;
+  
+  for( USIZE c = first_chunk; c < last_chunk; c++ )
+  {
+    USIZE offset            = c * job->chunk_length;
+    USIZE first_output      = job->first_output + offset * job->decimation;
+    USIZE number_of_outputs =
+      CPC_MIN (
+               USIZE,
+               job->chunk_length,
+               job->output_length - offset
+               );
+    
+    if( NULL == job->plan && job->symmetric )
+    {
+      csignal_conv_run_symmetric_kernel (
+                                         job->signal_length,
+                                         job->signal,
+                                         job->filter_length,
+                                         job->filter,
+                                         first_output,
+                                         job->decimation,
+                                         number_of_outputs,
+                                         job->out_signal + offset
+                                         );
+    }
+    else if( NULL == job->plan )
+    {
+      csignal_conv_run_strided_kernel (
+                                       job->signal_length,
+                                       job->signal,
+                                       job->filter_length,
+                                       job->filter,
+                                       first_output,
+                                       job->decimation,
+                                       number_of_outputs,
+                                       job->out_signal + offset
+                                       );
+    }
+    else
+    {
+      USIZE fft_length  = job->plan->signal_length;
+      USIZE delay       = job->filter_length - 1;
+      
+      //  The inputs the outputs of the piece depend on. Anything the circular
+      //  convolution wraps around lands before the first output.
+      USIZE first_input =
+        ( first_output >= delay ) ? first_output - delay : 0;
+      USIZE last_input  =
+        CPC_MIN (
+                 USIZE,
+                 first_output + ( number_of_outputs - 1 ) * job->decimation + 1,
+                 job->signal_length
+                 );
+      
+      FLOAT64* buffer   = job->buffers + in_index * ( fft_length + 2 );
+      FLOAT64* scratch  = NULL;
+      FLOAT64* h        = job->filter_spectrum;
+      
+      if( NULL != job->scratch )
+      {
+        scratch = job->scratch + in_index * job->scratch_length;
+      }
+      
+      for( USIZE t = 0; t < fft_length; t++ )
+      {
+        buffer[ t ] =
+          ( first_input + t < last_input )
+          ? job->signal[ first_input + t ] : 0.0;
+      }
+      
+      csignal_execute_real_FFT_with_scratch (
+                                             job->plan,
+                                             scratch,
+                                             buffer,
+                                             buffer
+                                             );
+      
+      for( USIZE k = 0; k <= fft_length / 2; k++ )
+      {
+        FLOAT64 ar = buffer[ 2 * k ];
+        FLOAT64 ai = buffer[ 2 * k + 1 ];
+        
+        buffer[ 2 * k ]     = ar * h[ 2 * k ] - ai * h[ 2 * k + 1 ];
+        buffer[ 2 * k + 1 ] = ar * h[ 2 * k + 1 ] + ai * h[ 2 * k ];
+      }
+      
+      csignal_execute_real_IFFT_with_scratch  (
+                                               job->plan,
+                                               scratch,
+                                               buffer,
+                                               buffer
+                                               );
+      
+      for( USIZE s = 0; s < number_of_outputs; s++ )
+      {
+        job->out_signal[ offset + s ] =
+          buffer[ first_output + s * job->decimation - first_input ];
+      }
+    }
+  }
+}
@@ -0,0 +1,1450 @@
+/*! \file   conv_kernels.c
+    \brief  Scalar and vectorized direct-form convolution kernels.
+ 
+    \author Brent Carrara
+ */
+#include "conv_kernels.h"
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+
+#include <immintrin.h>
+
+/*! \def    CSIGNAL_CONV_SSE2
+    \brief  Defined when the SSE2 kernel is compiled in.
+ */
+#define CSIGNAL_CONV_SSE2
+
+/*! \def    CSIGNAL_CONV_AVX2
+    \brief  Defined when the AVX2 kernel is compiled in.
+ */
+#define CSIGNAL_CONV_AVX2
+
+/*! \def    CSIGNAL_TARGET_SSE2
+    \brief  Compiles a function for SSE2 regardless of the compiler flags.
+ */
+#define CSIGNAL_TARGET_SSE2 __attribute__( ( target( "sse2" ) ) )
+
+/*! \def    CSIGNAL_TARGET_AVX2
+    \brief  Compiles a function for AVX2 and FMA regardless of the compiler
+            flags. Such functions must only be called after checking the CPU.
+ */
+#define CSIGNAL_TARGET_AVX2 __attribute__( ( target( "avx2,fma" ) ) )
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_AMD64 ) )
+
+#include <emmintrin.h>
+
+#define CSIGNAL_CONV_SSE2
+#define CSIGNAL_TARGET_SSE2
+
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+
+#include <arm_neon.h>
+
+/*! \def    CSIGNAL_CONV_NEON
+    \brief  Defined when the NEON kernel is compiled in.
+ */
+#define CSIGNAL_CONV_NEON
+
+#endif
+
+/*! \var    csignal_conv_interior_kernel
+    \brief  Function type of the kernels that calculate interior outputs, i.e.,
+            outputs for which every tap of the filter overlaps the signal.
+ */
+typedef void ( *csignal_conv_interior_kernel )  (
+                                                 FLOAT64*,
+                                                 USIZE,
+                                                 FLOAT64*,
+                                                 USIZE,
+                                                 USIZE,
+                                                 FLOAT64*
+                                                 );
+
+/*! \var    csignal_conv_strided_kernel
+    \brief  Function type of the kernels that calculate every stride-th
+            interior output.
+ */
+typedef void ( *csignal_conv_strided_kernel ) (
+                                               FLOAT64*,
+                                               USIZE,
+                                               FLOAT64*,
+                                               USIZE,
+                                               USIZE,
+                                               USIZE,
+                                               FLOAT64*
+                                               );
+
+/*! \fn     void csignal_conv_edge_scalar (
+              USIZE     in_signal_length,
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  Calculates every in_stride-th output of the convolution with the
+            tap range clipped to the signal for every output. Used for the
+            edges.
+ 
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of taps in in_filter.
+    \param  in_filter The filter taps.
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_stride The distance between consecutive outputs.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  out_signal  The in_number_of_outputs outputs.
+ */
+void
+csignal_conv_edge_scalar  (
+                           USIZE     in_signal_length,
+                           FLOAT64*  in_signal,
+                           USIZE     in_filter_length,
+                           FLOAT64*  in_filter,
+                           USIZE     in_first_output,
+                           USIZE     in_stride,
+                           USIZE     in_number_of_outputs,
+                           FLOAT64*  out_signal
+                           );
+
+/*! \fn     void csignal_conv_interior_scalar (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  Calculates every in_stride-th interior output of the convolution
+            without any bounds checks. The caller guarantees that
+            in_filter_length - 1 <= in_first_output and that the last output is
+            smaller than the signal length.
+ 
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of taps in in_filter.
+    \param  in_filter The filter taps.
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_stride The distance between consecutive outputs.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  out_signal  The in_number_of_outputs outputs.
+ */
+void
+csignal_conv_interior_scalar  (
+                               FLOAT64*  in_signal,
+                               USIZE     in_filter_length,
+                               FLOAT64*  in_filter,
+                               USIZE     in_first_output,
+                               USIZE     in_stride,
+                               USIZE     in_number_of_outputs,
+                               FLOAT64*  out_signal
+                               );
+
+/*! \fn     void csignal_conv_symmetric_scalar (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  Calculates every in_stride-th interior output of the convolution
+            with a symmetric filter, see csignal_conv_run_symmetric_kernel. The
+            two samples a pair of mirrored taps applies to are added first, so
+            there is one multiply per pair. The caller guarantees the same
+            bounds as for csignal_conv_interior_scalar.
+ 
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of taps in in_filter.
+    \param  in_filter The symmetric filter taps.
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_stride The distance between consecutive outputs.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  out_signal  The in_number_of_outputs outputs.
+ */
+void
+csignal_conv_symmetric_scalar (
+                               FLOAT64*  in_signal,
+                               USIZE     in_filter_length,
+                               FLOAT64*  in_filter,
+                               USIZE     in_first_output,
+                               USIZE     in_stride,
+                               USIZE     in_number_of_outputs,
+                               FLOAT64*  out_signal
+                               );
+
+/*! \fn     void csignal_conv_run_kernels (
+              USIZE                         in_signal_length,
+              FLOAT64*                      in_signal,
+              USIZE                         in_filter_length,
+              FLOAT64*                      in_filter,
+              USIZE                         in_first_output,
+              USIZE                         in_stride,
+              USIZE                         in_number_of_outputs,
+              csignal_conv_interior_kernel  in_interior,
+              csignal_conv_strided_kernel   in_strided,
+              FLOAT64*                      out_signal
+            )
+    \brief  Splits the outputs into the edges, which are calculated with
+            csignal_conv_edge_scalar, and the interior, which is calculated
+            with in_interior for a stride of one and with in_strided
+            otherwise.
+ 
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of taps in in_filter.
+    \param  in_filter The filter taps.
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_stride The distance between consecutive outputs, at least one.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  in_interior The unit-stride interior kernel, or null to use
+                        in_strided for every stride.
+    \param  in_strided  The strided interior kernel.
+    \param  out_signal  The in_number_of_outputs outputs.
+ */
+void
+csignal_conv_run_kernels (
+                          USIZE                         in_signal_length,
+                          FLOAT64*                      in_signal,
+                          USIZE                         in_filter_length,
+                          FLOAT64*                      in_filter,
+                          USIZE                         in_first_output,
+                          USIZE                         in_stride,
+                          USIZE                         in_number_of_outputs,
+                          csignal_conv_interior_kernel  in_interior,
+                          csignal_conv_strided_kernel   in_strided,
+                          FLOAT64*                      out_signal
+                          );
+
+#ifdef CSIGNAL_CONV_SSE2
+
+/*! \fn     void csignal_conv_interior_sse2 (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  SSE2 version of csignal_conv_interior_scalar, eight outputs per
+            pass over the taps in four registers.
+ */
+void
+csignal_conv_interior_sse2  (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             );
+
+
+/*! \fn     void csignal_conv_strided_sse2 (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  SSE2 version of csignal_conv_interior_scalar for strides larger
+            than one. Each output is a dot product vectorized across the taps,
+            two taps per register and four outputs per pass, with the taps
+            reversed in-register so that the signal loads stay contiguous.
+ */
+void
+csignal_conv_strided_sse2  (
+                            FLOAT64*  in_signal,
+                            USIZE     in_filter_length,
+                            FLOAT64*  in_filter,
+                            USIZE     in_first_output,
+                            USIZE     in_stride,
+                            USIZE     in_number_of_outputs,
+                            FLOAT64*  out_signal
+                            );
+
+
+/*! \fn     void csignal_conv_symmetric_sse2 (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  SSE2 version of csignal_conv_symmetric_scalar for a stride of
+            one, eight outputs per pass over the tap pairs in four registers.
+ */
+void
+csignal_conv_symmetric_sse2 (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             );
+
+#endif
+
+#ifdef CSIGNAL_CONV_AVX2
+
+/*! \fn     void csignal_conv_interior_avx2 (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  AVX2 version of csignal_conv_interior_scalar, sixteen outputs per
+            pass over the taps in four registers using fused multiply-add.
+ */
+void
+csignal_conv_interior_avx2  (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             );
+
+
+/*! \fn     void csignal_conv_strided_avx2 (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  AVX2 version of csignal_conv_strided_sse2, four taps per
+            register using fused multiply-add.
+ */
+void
+csignal_conv_strided_avx2  (
+                            FLOAT64*  in_signal,
+                            USIZE     in_filter_length,
+                            FLOAT64*  in_filter,
+                            USIZE     in_first_output,
+                            USIZE     in_stride,
+                            USIZE     in_number_of_outputs,
+                            FLOAT64*  out_signal
+                            );
+
+
+/*! \fn     void csignal_conv_symmetric_avx2 (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  AVX2 version of csignal_conv_symmetric_sse2, sixteen outputs per
+            pass using fused multiply-add.
+ */
+void
+csignal_conv_symmetric_avx2 (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             );
+
+#endif
+
+#ifdef CSIGNAL_CONV_NEON
+
+/*! \fn     void csignal_conv_interior_neon (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  NEON version of csignal_conv_interior_scalar, eight outputs per
+            pass over the taps in four registers using fused multiply-add.
+ */
+void
+csignal_conv_interior_neon  (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             );
+
+
+/*! \fn     void csignal_conv_strided_neon (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  NEON version of csignal_conv_strided_sse2 using fused
+            multiply-add.
+ */
+void
+csignal_conv_strided_neon  (
+                            FLOAT64*  in_signal,
+                            USIZE     in_filter_length,
+                            FLOAT64*  in_filter,
+                            USIZE     in_first_output,
+                            USIZE     in_stride,
+                            USIZE     in_number_of_outputs,
+                            FLOAT64*  out_signal
+                            );
+
+
+/*! \fn     void csignal_conv_symmetric_neon (
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  NEON version of csignal_conv_symmetric_sse2 using fused
+            multiply-add.
+ */
+void
+csignal_conv_symmetric_neon (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             );
+
+#endif
+
+void
+csignal_conv_run_kernel (
+                         USIZE     in_signal_length,
+                         FLOAT64*  in_signal,
+                         USIZE     in_filter_length,
+                         FLOAT64*  in_filter,
+                         USIZE     in_first_output,
+                         USIZE     in_number_of_outputs,
+                         FLOAT64*  out_signal
+                         )
+{
+  csignal_conv_run_strided_kernel (
+                                   in_signal_length,
+                                   in_signal,
+                                   in_filter_length,
+                                   in_filter,
+                                   in_first_output,
+                                   1,
+                                   in_number_of_outputs,
+                                   out_signal
+                                   );
+}
+
+void
+csignal_conv_run_strided_kernel (
+                                 USIZE     in_signal_length,
+                                 FLOAT64*  in_signal,
+                                 USIZE     in_filter_length,
+                                 FLOAT64*  in_filter,
+                                 USIZE     in_first_output,
+                                 USIZE     in_stride,
+                                 USIZE     in_number_of_outputs,
+                                 FLOAT64*  out_signal
+                                 )
+{
+  csignal_conv_interior_kernel interior = NULL;
+  csignal_conv_strided_kernel strided   = csignal_conv_interior_scalar;
+  
+  switch( csignal_fft_get_kernel() )
+  {
+#ifdef CSIGNAL_CONV_SSE2
+    case CSIGNAL_FFT_KERNEL_SSE2:
+      interior  = csignal_conv_interior_sse2;
+      strided   = csignal_conv_strided_sse2;
+      break;
+#endif
+#ifdef CSIGNAL_CONV_AVX2
+    case CSIGNAL_FFT_KERNEL_AVX2:
+      interior  = csignal_conv_interior_avx2;
+      strided   = csignal_conv_strided_avx2;
+      break;
+#endif
+#ifdef CSIGNAL_CONV_NEON
+    case CSIGNAL_FFT_KERNEL_NEON:
+      interior  = csignal_conv_interior_neon;
+      strided   = csignal_conv_strided_neon;
+      break;
+#endif
+    default:
+      break;
+  }
+  
+  csignal_conv_run_kernels  (
+                             in_signal_length,
+                             in_signal,
+                             in_filter_length,
+                             in_filter,
+                             in_first_output,
+                             in_stride,
+                             in_number_of_outputs,
+                             interior,
+                             strided,
+                             out_signal
+                             );
+}
+
+void
+csignal_conv_run_symmetric_kernel (
+                                   USIZE     in_signal_length,
+                                   FLOAT64*  in_signal,
+                                   USIZE     in_filter_length,
+                                   FLOAT64*  in_filter,
+                                   USIZE     in_first_output,
+                                   USIZE     in_stride,
+                                   USIZE     in_number_of_outputs,
+                                   FLOAT64*  out_signal
+                                   )
+{
+  //  Folding does not pay off for the strided vector kernels, which are
+  //  vectorized across the taps and would have to reverse the signal instead
+  //  of the taps, so only the unit-stride interior and the scalar kernel fold
+  csignal_conv_interior_kernel interior = NULL;
+  csignal_conv_strided_kernel strided   = csignal_conv_symmetric_scalar;
+  
+  switch( csignal_fft_get_kernel() )
+  {
+#ifdef CSIGNAL_CONV_SSE2
+    case CSIGNAL_FFT_KERNEL_SSE2:
+      interior  = csignal_conv_symmetric_sse2;
+      strided   = csignal_conv_strided_sse2;
+      break;
+#endif
+#ifdef CSIGNAL_CONV_AVX2
+    case CSIGNAL_FFT_KERNEL_AVX2:
+      interior  = csignal_conv_symmetric_avx2;
+      strided   = csignal_conv_strided_avx2;
+      break;
+#endif
+#ifdef CSIGNAL_CONV_NEON
+    case CSIGNAL_FFT_KERNEL_NEON:
+      interior  = csignal_conv_symmetric_neon;
+      strided   = csignal_conv_strided_neon;
+      break;
+#endif
+    default:
+      break;
+  }
+  
+  csignal_conv_run_kernels  (
+                             in_signal_length,
+                             in_signal,
+                             in_filter_length,
+                             in_filter,
+                             in_first_output,
+                             in_stride,
+                             in_number_of_outputs,
+                             interior,
+                             strided,
+                             out_signal
+                             );
+}
+
+void
+csignal_conv_run_kernels (
+                          USIZE                         in_signal_length,
+                          FLOAT64*                      in_signal,
+                          USIZE                         in_filter_length,
+                          FLOAT64*                      in_filter,
+                          USIZE                         in_first_output,
+                          USIZE                         in_stride,
+                          USIZE                         in_number_of_outputs,
+                          csignal_conv_interior_kernel  in_interior,
+                          csignal_conv_strided_kernel   in_strided,
+                          FLOAT64*                      out_signal
+                          )
+{
+  USIZE interior_first  = in_number_of_outputs;
+  USIZE interior_last   = in_number_of_outputs;
+  
+  //  The interior is [ filter_length - 1, signal_length ) in samples of the
+  //  convolution, interior_first and interior_last are the indices k of the
+  //  outputs that fall into it. It is empty when the filter is longer than the
+  //  signal or either is empty.
+  if( 0 < in_filter_length && in_filter_length <= in_signal_length )
+  {
+    USIZE first_sample  = in_filter_length - 1;
+    USIZE last_sample   = in_signal_length - 1;
+    
+    interior_first =
+      ( in_first_output >= first_sample )
+      ? 0
+      : ( first_sample - in_first_output + in_stride - 1 ) / in_stride;
+    interior_last =
+      ( in_first_output > last_sample )
+      ? 0
+      : ( last_sample - in_first_output ) / in_stride + 1;
+    
+    interior_first =
+      CPC_MIN( USIZE, interior_first, in_number_of_outputs );
+    interior_last =
+      CPC_MAX (
+               USIZE,
+               CPC_MIN( USIZE, interior_last, in_number_of_outputs ),
+               interior_first
+               );
+  }
+  
+  csignal_conv_edge_scalar  (
+                             in_signal_length,
+                             in_signal,
+                             in_filter_length,
+                             in_filter,
+                             in_first_output,
+                             in_stride,
+                             interior_first,
+                             out_signal
+                             );
+  
+  if( interior_last > interior_first )
+  {
+    USIZE first_sample = in_first_output + interior_first * in_stride;
+    
+    if( 1 == in_stride && NULL != in_interior )
+    {
+      in_interior (
+                   in_signal,
+                   in_filter_length,
+                   in_filter,
+                   first_sample,
+                   interior_last - interior_first,
+                   out_signal + interior_first
+                   );
+    }
+    else
+    {
+      in_strided  (
+                   in_signal,
+                   in_filter_length,
+                   in_filter,
+                   first_sample,
+                   in_stride,
+                   interior_last - interior_first,
+                   out_signal + interior_first
+                   );
+    }
+  }
+  
+  csignal_conv_edge_scalar  (
+                             in_signal_length,
+                             in_signal,
+                             in_filter_length,
+                             in_filter,
+                             in_first_output + interior_last * in_stride,
+                             in_stride,
+                             in_number_of_outputs - interior_last,
+                             out_signal + interior_last
+                             );
+}
+
+void
+csignal_conv_edge_scalar  (
+                           USIZE     in_signal_length,
+                           FLOAT64*  in_signal,
+                           USIZE     in_filter_length,
+                           FLOAT64*  in_filter,
+                           USIZE     in_first_output,
+                           USIZE     in_stride,
+                           USIZE     in_number_of_outputs,
+                           FLOAT64*  out_signal
+                           )
+{
+  for( USIZE k = 0; k < in_number_of_outputs; k++ )
+  {
+    USIZE i = in_first_output + k * in_stride;
+    
+    //  Taps j with 0 <= i - j < signal_length
+    USIZE first_tap =
+      ( i >= in_signal_length ) ? i - ( in_signal_length - 1 ) : 0;
+    USIZE last_tap  = CPC_MIN( USIZE, i + 1, in_filter_length );
+    
+    FLOAT64 value = 0.0;
+    
+    if( 0 == in_signal_length )
+    {
+      last_tap = 0;
+    }
+    
+    for( USIZE j = first_tap; j < last_tap; j++ )
+    {
+      value += in_filter[ j ] * in_signal[ i - j ];
+    }
+    
+    out_signal[ k ] = value;
+  }
+}
+
+void
+csignal_conv_interior_scalar  (
+                               FLOAT64*  in_signal,
+                               USIZE     in_filter_length,
+                               FLOAT64*  in_filter,
+                               USIZE     in_first_output,
+                               USIZE     in_stride,
+                               USIZE     in_number_of_outputs,
+                               FLOAT64*  out_signal
+                               )
+{
+  for( USIZE k = 0; k < in_number_of_outputs; k++ )
+  {
+    FLOAT64* x = in_signal + in_first_output + k * in_stride;
+    
+    FLOAT64 value = 0.0;
+    
+    for( USIZE j = 0; j < in_filter_length; j++ )
+    {
+      value += in_filter[ j ] * *( x - j );
+    }
+    
+    out_signal[ k ] = value;
+  }
+}
+
+void
+csignal_conv_symmetric_scalar (
+                               FLOAT64*  in_signal,
+                               USIZE     in_filter_length,
+                               FLOAT64*  in_filter,
+                               USIZE     in_first_output,
+                               USIZE     in_stride,
+                               USIZE     in_number_of_outputs,
+                               FLOAT64*  out_signal
+                               )
+{
+  USIZE pairs = in_filter_length / 2;
+  
+  for( USIZE k = 0; k < in_number_of_outputs; k++ )
+  {
+    //  Tap j applies to x[ -j ] and its mirror, tap filter_length - 1 - j, to
+    //  y[ j ]
+    FLOAT64* x = in_signal + in_first_output + k * in_stride;
+    FLOAT64* y = x - ( in_filter_length - 1 );
+    
+    FLOAT64 value = 0.0;
+    
+    for( USIZE j = 0; j < pairs; j++ )
+    {
+      value += in_filter[ j ] * ( *( x - j ) + y[ j ] );
+    }
+    
+    if( 1 == in_filter_length % 2 )
+    {
+      value += in_filter[ pairs ] * *( x - pairs );
+    }
+    
+    out_signal[ k ] = value;
+  }
+}
+
+#ifdef CSIGNAL_CONV_SSE2
+
+CSIGNAL_TARGET_SSE2 void
+csignal_conv_interior_sse2  (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             )
+{
+  USIZE k = 0;
+  
+  for( ; k + 8 <= in_number_of_outputs; k += 8 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d sum2 = _mm_setzero_pd();
+    __m128d sum3 = _mm_setzero_pd();
+    
+    for( USIZE j = 0; j < in_filter_length; j++ )
+    {
+      __m128d h = _mm_set1_pd( in_filter[ j ] );
+      
+      sum0 = _mm_add_pd( sum0, _mm_mul_pd( h, _mm_loadu_pd( x - j ) ) );
+      sum1 = _mm_add_pd( sum1, _mm_mul_pd( h, _mm_loadu_pd( x - j + 2 ) ) );
+      sum2 = _mm_add_pd( sum2, _mm_mul_pd( h, _mm_loadu_pd( x - j + 4 ) ) );
+      sum3 = _mm_add_pd( sum3, _mm_mul_pd( h, _mm_loadu_pd( x - j + 6 ) ) );
+    }
+    
+    _mm_storeu_pd( out_signal + k, sum0 );
+    _mm_storeu_pd( out_signal + k + 2, sum1 );
+    _mm_storeu_pd( out_signal + k + 4, sum2 );
+    _mm_storeu_pd( out_signal + k + 6, sum3 );
+  }
+  
+  for( ; k + 2 <= in_number_of_outputs; k += 2 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    
+    __m128d sum = _mm_setzero_pd();
+    
+    for( USIZE j = 0; j < in_filter_length; j++ )
+    {
+      sum =
+        _mm_add_pd  (
+                     sum,
+                     _mm_mul_pd (
+                                 _mm_set1_pd( in_filter[ j ] ),
+                                 _mm_loadu_pd( x - j )
+                                 )
+                     );
+    }
+    
+    _mm_storeu_pd( out_signal + k, sum );
+  }
+  
+  csignal_conv_interior_scalar  (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k,
+                                 1,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_conv_strided_sse2  (
+                            FLOAT64*  in_signal,
+                            USIZE     in_filter_length,
+                            FLOAT64*  in_filter,
+                            USIZE     in_first_output,
+                            USIZE     in_stride,
+                            USIZE     in_number_of_outputs,
+                            FLOAT64*  out_signal
+                            )
+{
+  USIZE taps  = in_filter_length - ( in_filter_length % 2 );
+  USIZE k     = 0;
+  
+  for( ; k + 4 <= in_number_of_outputs; k += 4 )
+  {
+    FLOAT64* x0 = in_signal + in_first_output + k * in_stride;
+    FLOAT64* x1 = x0 + in_stride;
+    FLOAT64* x2 = x1 + in_stride;
+    FLOAT64* x3 = x2 + in_stride;
+    
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d sum2 = _mm_setzero_pd();
+    __m128d sum3 = _mm_setzero_pd();
+    
+    USIZE j = 0;
+    
+    for( ; j < taps; j += 2 )
+    {
+      //  ( h[ j + 1 ], h[ j ] ) lines up with ( x[ i - j - 1 ], x[ i - j ] )
+      __m128d h = _mm_loadu_pd( in_filter + j );
+      
+      h = _mm_shuffle_pd( h, h, 1 );
+      
+      sum0 = _mm_add_pd( sum0, _mm_mul_pd( h, _mm_loadu_pd( x0 - j - 1 ) ) );
+      sum1 = _mm_add_pd( sum1, _mm_mul_pd( h, _mm_loadu_pd( x1 - j - 1 ) ) );
+      sum2 = _mm_add_pd( sum2, _mm_mul_pd( h, _mm_loadu_pd( x2 - j - 1 ) ) );
+      sum3 = _mm_add_pd( sum3, _mm_mul_pd( h, _mm_loadu_pd( x3 - j - 1 ) ) );
+    }
+    
+    //  Horizontal sums, ( sum0, sum1 ) and ( sum2, sum3 ) in one register
+    sum0 =
+      _mm_add_pd  (
+                   _mm_unpacklo_pd( sum0, sum1 ),
+                   _mm_unpackhi_pd( sum0, sum1 )
+                   );
+    sum2 =
+      _mm_add_pd  (
+                   _mm_unpacklo_pd( sum2, sum3 ),
+                   _mm_unpackhi_pd( sum2, sum3 )
+                   );
+    
+    if( j < in_filter_length )
+    {
+      __m128d h = _mm_set1_pd( in_filter[ j ] );
+      
+      sum0 =
+        _mm_add_pd  (
+                     sum0,
+                     _mm_mul_pd( h, _mm_set_pd( *( x1 - j ), *( x0 - j ) ) )
+                     );
+      sum2 =
+        _mm_add_pd  (
+                     sum2,
+                     _mm_mul_pd( h, _mm_set_pd( *( x3 - j ), *( x2 - j ) ) )
+                     );
+    }
+    
+    _mm_storeu_pd( out_signal + k, sum0 );
+    _mm_storeu_pd( out_signal + k + 2, sum2 );
+  }
+  
+  csignal_conv_interior_scalar  (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k * in_stride,
+                                 in_stride,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_conv_symmetric_sse2 (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             )
+{
+  USIZE pairs = in_filter_length / 2;
+  USIZE k     = 0;
+  
+  for( ; k + 8 <= in_number_of_outputs; k += 8 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    FLOAT64* y = x - ( in_filter_length - 1 );
+    
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d sum2 = _mm_setzero_pd();
+    __m128d sum3 = _mm_setzero_pd();
+    
+    for( USIZE j = 0; j < pairs; j++ )
+    {
+      __m128d h = _mm_set1_pd( in_filter[ j ] );
+      
+      __m128d x0 =
+        _mm_add_pd( _mm_loadu_pd( x - j ), _mm_loadu_pd( y + j ) );
+      __m128d x1 =
+        _mm_add_pd( _mm_loadu_pd( x - j + 2 ), _mm_loadu_pd( y + j + 2 ) );
+      __m128d x2 =
+        _mm_add_pd( _mm_loadu_pd( x - j + 4 ), _mm_loadu_pd( y + j + 4 ) );
+      __m128d x3 =
+        _mm_add_pd( _mm_loadu_pd( x - j + 6 ), _mm_loadu_pd( y + j + 6 ) );
+      
+      sum0 = _mm_add_pd( sum0, _mm_mul_pd( h, x0 ) );
+      sum1 = _mm_add_pd( sum1, _mm_mul_pd( h, x1 ) );
+      sum2 = _mm_add_pd( sum2, _mm_mul_pd( h, x2 ) );
+      sum3 = _mm_add_pd( sum3, _mm_mul_pd( h, x3 ) );
+    }
+    
+    if( 1 == in_filter_length % 2 )
+    {
+      __m128d h = _mm_set1_pd( in_filter[ pairs ] );
+      
+      sum0 = _mm_add_pd( sum0, _mm_mul_pd( h, _mm_loadu_pd( x - pairs ) ) );
+      sum1 =
+        _mm_add_pd( sum1, _mm_mul_pd( h, _mm_loadu_pd( x - pairs + 2 ) ) );
+      sum2 =
+        _mm_add_pd( sum2, _mm_mul_pd( h, _mm_loadu_pd( x - pairs + 4 ) ) );
+      sum3 =
+        _mm_add_pd( sum3, _mm_mul_pd( h, _mm_loadu_pd( x - pairs + 6 ) ) );
+    }
+    
+    _mm_storeu_pd( out_signal + k, sum0 );
+    _mm_storeu_pd( out_signal + k + 2, sum1 );
+    _mm_storeu_pd( out_signal + k + 4, sum2 );
+    _mm_storeu_pd( out_signal + k + 6, sum3 );
+  }
+  
+  csignal_conv_symmetric_scalar (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k,
+                                 1,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+#endif
+
+#ifdef CSIGNAL_CONV_AVX2
+
+CSIGNAL_TARGET_AVX2 void
+csignal_conv_interior_avx2  (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             )
+{
+  USIZE k = 0;
+  
+  for( ; k + 16 <= in_number_of_outputs; k += 16 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+    
+    for( USIZE j = 0; j < in_filter_length; j++ )
+    {
+      __m256d h = _mm256_broadcast_sd( in_filter + j );
+      
+      sum0 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - j ), sum0 );
+      sum1 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - j + 4 ), sum1 );
+      sum2 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - j + 8 ), sum2 );
+      sum3 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - j + 12 ), sum3 );
+    }
+    
+    _mm256_storeu_pd( out_signal + k, sum0 );
+    _mm256_storeu_pd( out_signal + k + 4, sum1 );
+    _mm256_storeu_pd( out_signal + k + 8, sum2 );
+    _mm256_storeu_pd( out_signal + k + 12, sum3 );
+  }
+  
+  for( ; k + 4 <= in_number_of_outputs; k += 4 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    
+    __m256d sum = _mm256_setzero_pd();
+    
+    for( USIZE j = 0; j < in_filter_length; j++ )
+    {
+      sum =
+        _mm256_fmadd_pd (
+                         _mm256_broadcast_sd( in_filter + j ),
+                         _mm256_loadu_pd( x - j ),
+                         sum
+                         );
+    }
+    
+    _mm256_storeu_pd( out_signal + k, sum );
+  }
+  
+  csignal_conv_interior_scalar  (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k,
+                                 1,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+CSIGNAL_TARGET_AVX2 void
+csignal_conv_strided_avx2  (
+                            FLOAT64*  in_signal,
+                            USIZE     in_filter_length,
+                            FLOAT64*  in_filter,
+                            USIZE     in_first_output,
+                            USIZE     in_stride,
+                            USIZE     in_number_of_outputs,
+                            FLOAT64*  out_signal
+                            )
+{
+  USIZE taps  = in_filter_length - ( in_filter_length % 4 );
+  USIZE k     = 0;
+  
+  for( ; k + 4 <= in_number_of_outputs; k += 4 )
+  {
+    FLOAT64* x0 = in_signal + in_first_output + k * in_stride;
+    FLOAT64* x1 = x0 + in_stride;
+    FLOAT64* x2 = x1 + in_stride;
+    FLOAT64* x3 = x2 + in_stride;
+    
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+    
+    __m256d low   = _mm256_setzero_pd();
+    __m256d high  = _mm256_setzero_pd();
+    
+    USIZE j = 0;
+    
+    for( ; j < taps; j += 4 )
+    {
+      //  h[ j + 3 ] ... h[ j ] lines up with x[ i - j - 3 ] ... x[ i - j ]
+      __m256d h =
+        _mm256_permute4x64_pd( _mm256_loadu_pd( in_filter + j ), 0x1B );
+      
+      sum0 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x0 - j - 3 ), sum0 );
+      sum1 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x1 - j - 3 ), sum1 );
+      sum2 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x2 - j - 3 ), sum2 );
+      sum3 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x3 - j - 3 ), sum3 );
+    }
+    
+    //  Horizontal sums, ( sum0, sum1, sum2, sum3 ) in one register
+    sum0  = _mm256_hadd_pd( sum0, sum1 );
+    sum2  = _mm256_hadd_pd( sum2, sum3 );
+    low   = _mm256_permute2f128_pd( sum0, sum2, 0x20 );
+    high  = _mm256_permute2f128_pd( sum0, sum2, 0x31 );
+    sum0  = _mm256_add_pd( low, high );
+    
+    for( ; j < in_filter_length; j++ )
+    {
+      sum0 =
+        _mm256_fmadd_pd (
+                         _mm256_broadcast_sd( in_filter + j ),
+                         _mm256_set_pd  (
+                                         *( x3 - j ),
+                                         *( x2 - j ),
+                                         *( x1 - j ),
+                                         *( x0 - j )
+                                         ),
+                         sum0
+                         );
+    }
+    
+    _mm256_storeu_pd( out_signal + k, sum0 );
+  }
+  
+  csignal_conv_interior_scalar  (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k * in_stride,
+                                 in_stride,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+CSIGNAL_TARGET_AVX2 void
+csignal_conv_symmetric_avx2 (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             )
+{
+  USIZE pairs = in_filter_length / 2;
+  USIZE k     = 0;
+  
+  for( ; k + 16 <= in_number_of_outputs; k += 16 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    FLOAT64* y = x - ( in_filter_length - 1 );
+    
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+    
+    for( USIZE j = 0; j < pairs; j++ )
+    {
+      __m256d h = _mm256_broadcast_sd( in_filter + j );
+      
+      __m256d x0 =
+        _mm256_add_pd( _mm256_loadu_pd( x - j ), _mm256_loadu_pd( y + j ) );
+      __m256d x1 =
+        _mm256_add_pd (
+                       _mm256_loadu_pd( x - j + 4 ),
+                       _mm256_loadu_pd( y + j + 4 )
+                       );
+      __m256d x2 =
+        _mm256_add_pd (
+                       _mm256_loadu_pd( x - j + 8 ),
+                       _mm256_loadu_pd( y + j + 8 )
+                       );
+      __m256d x3 =
+        _mm256_add_pd (
+                       _mm256_loadu_pd( x - j + 12 ),
+                       _mm256_loadu_pd( y + j + 12 )
+                       );
+      
+      sum0 = _mm256_fmadd_pd( h, x0, sum0 );
+      sum1 = _mm256_fmadd_pd( h, x1, sum1 );
+      sum2 = _mm256_fmadd_pd( h, x2, sum2 );
+      sum3 = _mm256_fmadd_pd( h, x3, sum3 );
+    }
+    
+    if( 1 == in_filter_length % 2 )
+    {
+      __m256d h = _mm256_broadcast_sd( in_filter + pairs );
+      
+      sum0 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - pairs ), sum0 );
+      sum1 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - pairs + 4 ), sum1 );
+      sum2 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - pairs + 8 ), sum2 );
+      sum3 = _mm256_fmadd_pd( h, _mm256_loadu_pd( x - pairs + 12 ), sum3 );
+    }
+    
+    _mm256_storeu_pd( out_signal + k, sum0 );
+    _mm256_storeu_pd( out_signal + k + 4, sum1 );
+    _mm256_storeu_pd( out_signal + k + 8, sum2 );
+    _mm256_storeu_pd( out_signal + k + 12, sum3 );
+  }
+  
+  for( ; k + 4 <= in_number_of_outputs; k += 4 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    FLOAT64* y = x - ( in_filter_length - 1 );
+    
+    __m256d sum = _mm256_setzero_pd();
+    
+    for( USIZE j = 0; j < pairs; j++ )
+    {
+      sum =
+        _mm256_fmadd_pd (
+                         _mm256_broadcast_sd( in_filter + j ),
+                         _mm256_add_pd  (
+                                         _mm256_loadu_pd( x - j ),
+                                         _mm256_loadu_pd( y + j )
+                                         ),
+                         sum
+                         );
+    }
+    
+    if( 1 == in_filter_length % 2 )
+    {
+      sum =
+        _mm256_fmadd_pd (
+                         _mm256_broadcast_sd( in_filter + pairs ),
+                         _mm256_loadu_pd( x - pairs ),
+                         sum
+                         );
+    }
+    
+    _mm256_storeu_pd( out_signal + k, sum );
+  }
+  
+  csignal_conv_symmetric_scalar (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k,
+                                 1,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+#endif
+
+#ifdef CSIGNAL_CONV_NEON
+
+void
+csignal_conv_interior_neon  (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             )
+{
+  USIZE k = 0;
+  
+  for( ; k + 8 <= in_number_of_outputs; k += 8 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    
+    float64x2_t sum0 = vdupq_n_f64( 0.0 );
+    float64x2_t sum1 = vdupq_n_f64( 0.0 );
+    float64x2_t sum2 = vdupq_n_f64( 0.0 );
+    float64x2_t sum3 = vdupq_n_f64( 0.0 );
+    
+    for( USIZE j = 0; j < in_filter_length; j++ )
+    {
+      float64x2_t h = vld1q_dup_f64( in_filter + j );
+      
+      sum0 = vfmaq_f64( sum0, h, vld1q_f64( x - j ) );
+      sum1 = vfmaq_f64( sum1, h, vld1q_f64( x - j + 2 ) );
+      sum2 = vfmaq_f64( sum2, h, vld1q_f64( x - j + 4 ) );
+      sum3 = vfmaq_f64( sum3, h, vld1q_f64( x - j + 6 ) );
+    }
+    
+    vst1q_f64( out_signal + k, sum0 );
+    vst1q_f64( out_signal + k + 2, sum1 );
+    vst1q_f64( out_signal + k + 4, sum2 );
+    vst1q_f64( out_signal + k + 6, sum3 );
+  }
+  
+  csignal_conv_interior_scalar  (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k,
+                                 1,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+void
+csignal_conv_strided_neon  (
+                            FLOAT64*  in_signal,
+                            USIZE     in_filter_length,
+                            FLOAT64*  in_filter,
+                            USIZE     in_first_output,
+                            USIZE     in_stride,
+                            USIZE     in_number_of_outputs,
+                            FLOAT64*  out_signal
+                            )
+{
+  USIZE taps  = in_filter_length - ( in_filter_length % 2 );
+  USIZE k     = 0;
+  
+  for( ; k + 4 <= in_number_of_outputs; k += 4 )
+  {
+    FLOAT64* x0 = in_signal + in_first_output + k * in_stride;
+    FLOAT64* x1 = x0 + in_stride;
+    FLOAT64* x2 = x1 + in_stride;
+    FLOAT64* x3 = x2 + in_stride;
+    
+    float64x2_t sum0 = vdupq_n_f64( 0.0 );
+    float64x2_t sum1 = vdupq_n_f64( 0.0 );
+    float64x2_t sum2 = vdupq_n_f64( 0.0 );
+    float64x2_t sum3 = vdupq_n_f64( 0.0 );
+    
+    FLOAT64 value0 = 0.0;
+    FLOAT64 value1 = 0.0;
+    FLOAT64 value2 = 0.0;
+    FLOAT64 value3 = 0.0;
+    
+    USIZE j = 0;
+    
+    for( ; j < taps; j += 2 )
+    {
+      //  ( h[ j + 1 ], h[ j ] ) lines up with ( x[ i - j - 1 ], x[ i - j ] )
+      float64x2_t h = vld1q_f64( in_filter + j );
+      
+      h = vextq_f64( h, h, 1 );
+      
+      sum0 = vfmaq_f64( sum0, h, vld1q_f64( x0 - j - 1 ) );
+      sum1 = vfmaq_f64( sum1, h, vld1q_f64( x1 - j - 1 ) );
+      sum2 = vfmaq_f64( sum2, h, vld1q_f64( x2 - j - 1 ) );
+      sum3 = vfmaq_f64( sum3, h, vld1q_f64( x3 - j - 1 ) );
+    }
+    
+    value0 = vaddvq_f64( sum0 );
+    value1 = vaddvq_f64( sum1 );
+    value2 = vaddvq_f64( sum2 );
+    value3 = vaddvq_f64( sum3 );
+    
+    if( j < in_filter_length )
+    {
+      value0 += in_filter[ j ] * *( x0 - j );
+      value1 += in_filter[ j ] * *( x1 - j );
+      value2 += in_filter[ j ] * *( x2 - j );
+      value3 += in_filter[ j ] * *( x3 - j );
+    }
+    
+    out_signal[ k ]     = value0;
+    out_signal[ k + 1 ] = value1;
+    out_signal[ k + 2 ] = value2;
+    out_signal[ k + 3 ] = value3;
+  }
+  
+  csignal_conv_interior_scalar  (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k * in_stride,
+                                 in_stride,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+void
+csignal_conv_symmetric_neon (
+                             FLOAT64*  in_signal,
+                             USIZE     in_filter_length,
+                             FLOAT64*  in_filter,
+                             USIZE     in_first_output,
+                             USIZE     in_number_of_outputs,
+                             FLOAT64*  out_signal
+                             )
+{
+  USIZE pairs = in_filter_length / 2;
+  USIZE k     = 0;
+  
+  for( ; k + 8 <= in_number_of_outputs; k += 8 )
+  {
+    FLOAT64* x = in_signal + in_first_output + k;
+    FLOAT64* y = x - ( in_filter_length - 1 );
+    
+    float64x2_t sum0 = vdupq_n_f64( 0.0 );
+    float64x2_t sum1 = vdupq_n_f64( 0.0 );
+    float64x2_t sum2 = vdupq_n_f64( 0.0 );
+    float64x2_t sum3 = vdupq_n_f64( 0.0 );
+    
+    for( USIZE j = 0; j < pairs; j++ )
+    {
+      float64x2_t h = vld1q_dup_f64( in_filter + j );
+      
+      float64x2_t x0 = vaddq_f64( vld1q_f64( x - j ), vld1q_f64( y + j ) );
+      float64x2_t x1 =
+        vaddq_f64( vld1q_f64( x - j + 2 ), vld1q_f64( y + j + 2 ) );
+      float64x2_t x2 =
+        vaddq_f64( vld1q_f64( x - j + 4 ), vld1q_f64( y + j + 4 ) );
+      float64x2_t x3 =
+        vaddq_f64( vld1q_f64( x - j + 6 ), vld1q_f64( y + j + 6 ) );
+      
+      sum0 = vfmaq_f64( sum0, h, x0 );
+      sum1 = vfmaq_f64( sum1, h, x1 );
+      sum2 = vfmaq_f64( sum2, h, x2 );
+      sum3 = vfmaq_f64( sum3, h, x3 );
+    }
+    
+    if( 1 == in_filter_length % 2 )
+    {
+      float64x2_t h = vld1q_dup_f64( in_filter + pairs );
+      
+      sum0 = vfmaq_f64( sum0, h, vld1q_f64( x - pairs ) );
+      sum1 = vfmaq_f64( sum1, h, vld1q_f64( x - pairs + 2 ) );
+      sum2 = vfmaq_f64( sum2, h, vld1q_f64( x - pairs + 4 ) );
+      sum3 = vfmaq_f64( sum3, h, vld1q_f64( x - pairs + 6 ) );
+    }
+    
+    vst1q_f64( out_signal + k, sum0 );
+    vst1q_f64( out_signal + k + 2, sum1 );
+    vst1q_f64( out_signal + k + 4, sum2 );
+    vst1q_f64( out_signal + k + 6, sum3 );
+  }
+  
+  csignal_conv_symmetric_scalar (
+                                 in_signal,
+                                 in_filter_length,
+                                 in_filter,
+                                 in_first_output + k,
+                                 1,
+                                 in_number_of_outputs - k,
+                                 out_signal + k
+                                 );
+}
+
+#endif
@@ -0,0 +1,507 @@
+/*! \file   correlate.c
+    \brief  The implementation of the cross-correlation.
+ 
+    \author Brent Carrara
+ */
+#include "correlate.h"
+
+#include <math.h>
+
+/*! \fn     void csignal_correlator_normalize (
+              csignal_correlator* in_correlator,
+              USIZE               in_signal_length,
+              FLOAT64*            in_signal,
+              FLOAT64*            io_correlation
+            )
+    \brief  Divides the in_signal_length - reference_length + 1 valid lags in
+            io_correlation by the norms of the reference and of the signal
+            samples each lag overlaps.
+ 
+            The energy of the overlapped samples is updated by adding the
+            square of the sample entering the window and subtracting the one
+            leaving it, and calculated from scratch every reference_length
+            lags so that the rounding errors of the updates do not accumulate
+            over long signals. The cost stays linear in the signal length.
+            Both are summed with compensation (see
+            csignal_correlator_accumulate) because the rounding errors of a
+            loud burst would otherwise be far larger than the energy of the
+            quiet samples that follow it in the window.
+ 
+            The updated energy of a window that only holds zeros is the
+            rounding error left by the samples that passed through it, so the
+            nonzero samples in the window are counted to test for a silent
+            window exactly. The results are clamped to [ -1, 1 ] because the
+            rounding errors can also push them slightly past it.
+ 
+    \param  in_correlator The correlator whose reference was correlated.
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The correlated signal.
+    \param  io_correlation  The valid lags, normalized in place.
+ */
+void
+csignal_correlator_normalize  (
+                               csignal_correlator* in_correlator,
+                               USIZE               in_signal_length,
+                               FLOAT64*            in_signal,
+                               FLOAT64*            io_correlation
+                               );
+
+/*! \fn     void csignal_correlator_accumulate (
+              FLOAT64* io_sum,
+              FLOAT64* io_compensation,
+              FLOAT64  in_value
+            )
+    \brief  Adds in_value to the running sum io_sum using Neumaier's
+            compensated summation: the rounding error of the addition is
+            accumulated in io_compensation, and io_sum + io_compensation is
+            the sum of every value added so far to within about one rounding
+            error of the largest of them.
+ 
+    \param  io_sum  The running sum.
+    \param  io_compensation The rounding errors of the additions into io_sum.
+    \param  in_value  The value to add.
+ */
+void
+csignal_correlator_accumulate (
+                               FLOAT64* io_sum,
+                               FLOAT64* io_compensation,
+                               FLOAT64  in_value
+                               );
+
+csignal_error_code
+csignal_initialize_correlator (
+                               USIZE                in_reference_length,
+                               FLOAT64*             in_reference,
+                               csignal_correlator** out_correlator
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_reference || NULL == out_correlator )
+  {
+    CPC_ERROR (
+               "Reference (0x%x) or correlator (0x%x) are null.",
+               in_reference,
+               out_correlator
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_reference_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Reference must not be empty." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    FLOAT64* reversed = NULL;
+    
+    *out_correlator = NULL;
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) out_correlator,
+                       sizeof( csignal_correlator )
+                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_correlator* correlator = *out_correlator;
+      
+      correlator->reference_length  = in_reference_length;
+      correlator->reference_energy  = 0.0;
+      correlator->filter            = NULL;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &reversed,
+                         sizeof( FLOAT64 ) * in_reference_length
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        //  Correlating with the reference is convolving with it reversed
+        for( USIZE i = 0; i < in_reference_length; i++ )
+        {
+          reversed[ i ] = in_reference[ in_reference_length - 1 - i ];
+          
+          correlator->reference_energy +=
+            in_reference[ i ] * in_reference[ i ];
+        }
+        
+        return_value =
+          csignal_initialize_convolution_filter (
+                                                 in_reference_length,
+                                                 reversed,
+                                                 &( correlator->filter )
+                                                 );
+        
+        cpc_safe_free( ( void** ) &reversed );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not initialize correlator: 0x%x.", return_value );
+        
+        csignal_destroy_correlator( *out_correlator );
+        
+        *out_correlator = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc correlator: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_correlator  (
+                             csignal_correlator* io_correlator
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_correlator )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Correlator is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_correlator->filter )
+    {
+      return_value =
+        csignal_destroy_convolution_filter( io_correlator->filter );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_correlator );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_correlate (
+                   csignal_correlator*       io_correlator,
+                   csignal_correlation_mode  in_mode,
+                   USIZE                     in_signal_length,
+                   FLOAT64*                  in_signal,
+                   USIZE*                    out_correlation_length,
+                   FLOAT64**                 out_correlation
+                   )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  USIZE first_output      = 0;
+  USIZE number_of_outputs = 0;
+  
+  if  (
+       NULL == io_correlator
+       || NULL == in_signal
+       || NULL == out_correlation_length
+       || NULL == out_correlation
+       )
+  {
+    CPC_ERROR (
+               "Correlator (0x%x), signal (0x%x), correlation length (0x%x),"
+               " or correlation (0x%x) are null.",
+               io_correlator,
+               in_signal,
+               out_correlation_length,
+               out_correlation
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           CSIGNAL_CORRELATION_MODE_FULL != in_mode
+           && CSIGNAL_CORRELATION_MODE_VALID != in_mode
+           && CSIGNAL_CORRELATION_MODE_NORMALIZED != in_mode
+           )
+  {
+    CPC_ERROR( "Correlation mode (%d) is unknown.", in_mode );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if (
+           0 == in_signal_length
+           || (
+               CSIGNAL_CORRELATION_MODE_FULL != in_mode
+               && io_correlator->reference_length > in_signal_length
+               )
+           )
+  {
+    CPC_ERROR (
+               "Signal length (%d) must be non-zero and, in mode %d, at least"
+               " the reference length (%d).",
+               in_signal_length,
+               in_mode,
+               io_correlator->reference_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    //  Lag l is output l + reference_length - 1 of the convolution with the
+    //  reversed reference
+    if( CSIGNAL_CORRELATION_MODE_FULL == in_mode )
+    {
+      first_output      = 0;
+      number_of_outputs =
+        in_signal_length + io_correlator->reference_length - 1;
+    }
+    else
+    {
+      first_output      = io_correlator->reference_length - 1;
+      number_of_outputs =
+        in_signal_length - io_correlator->reference_length + 1;
+    }
+    
+    if  (
+         0 != *out_correlation_length
+         && (
+             number_of_outputs > *out_correlation_length
+             || NULL == *out_correlation
+             )
+         )
+    {
+      CPC_ERROR (
+                 "Correlation length (%d) must be at least %d and correlation"
+                 " (0x%x) must not be null.",
+                 *out_correlation_length,
+                 number_of_outputs,
+                 *out_correlation
+                 );
+      
+      return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    }
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value )
+  {
+    CPC_BOOL allocated = CPC_FALSE;
+    
+    if( NULL == *out_correlation )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_correlation,
+                         sizeof( FLOAT64 ) * number_of_outputs
+                         );
+      
+      allocated = CPC_TRUE;
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value =
+        convolve_with_filter  (
+                               io_correlator->filter,
+                               in_signal_length,
+                               in_signal,
+                               CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC,
+                               first_output,
+                               1,
+                               number_of_outputs,
+                               *out_correlation
+                               );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      *out_correlation_length = number_of_outputs;
+      
+      if( CSIGNAL_CORRELATION_MODE_NORMALIZED == in_mode )
+      {
+        csignal_correlator_normalize  (
+                                       io_correlator,
+                                       in_signal_length,
+                                       in_signal,
+                                       *out_correlation
+                                       );
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not correlate signal: 0x%x.", return_value );
+      
+      if( allocated && NULL != *out_correlation )
+      {
+        cpc_safe_free( ( void** ) out_correlation );
+      }
+      
+      *out_correlation_length = 0;
+      *out_correlation        = NULL;
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_cross_correlate (
+                         USIZE                     in_signal_length,
+                         FLOAT64*                  in_signal,
+                         USIZE                     in_reference_length,
+                         FLOAT64*                  in_reference,
+                         csignal_correlation_mode  in_mode,
+                         USIZE*                    out_correlation_length,
+                         FLOAT64**                 out_correlation
+                         )
+{
+  csignal_correlator* correlator = NULL;
+  
+  csignal_error_code return_value =
+    csignal_initialize_correlator (
+                                   in_reference_length,
+                                   in_reference,
+                                   &correlator
+                                   );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value )
+  {
+    return_value =
+      csignal_correlate (
+                         correlator,
+                         in_mode,
+                         in_signal_length,
+                         in_signal,
+                         out_correlation_length,
+                         out_correlation
+                         );
+    
+    csignal_destroy_correlator( correlator );
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_correlator_normalize  (
+                               csignal_correlator* in_correlator,
+                               USIZE               in_signal_length,
+                               FLOAT64*            in_signal,
+                               FLOAT64*            io_correlation
+                               )
+{
+  USIZE length            = in_correlator->reference_length;
+  USIZE number_of_lags    = in_signal_length - length + 1;
+  USIZE nonzero_samples   = 0;
+  
+  FLOAT64 window_energy = 0.0;
+  FLOAT64 compensation  = 0.0;
+  
+  for( USIZE l = 0; l < number_of_lags; l++ )
+  {
+    FLOAT64 norm = 0.0;
+    
+    if( 0 == ( l % length ) )
+    {
+      window_energy   = 0.0;
+      compensation    = 0.0;
+      nonzero_samples = 0;
+      
+      for( USIZE j = 0; j < length; j++ )
+      {
+        csignal_correlator_accumulate (
+                                       &window_energy,
+                                       &compensation,
+                                       in_signal[ l + j ] * in_signal[ l + j ]
+                                       );
+        
+        if( 0.0 != in_signal[ l + j ] )
+        {
+          nonzero_samples++;
+        }
+      }
+    }
+    else
+    {
+      csignal_correlator_accumulate (
+                                     &window_energy,
+                                     &compensation,
+                                     in_signal[ l + length - 1 ]
+                                     * in_signal[ l + length - 1 ]
+                                     );
+      
+      csignal_correlator_accumulate (
+                                     &window_energy,
+                                     &compensation,
+                                     -in_signal[ l - 1 ] * in_signal[ l - 1 ]
+                                     );
+      
+      if( 0.0 != in_signal[ l + length - 1 ] )
+      {
+        nonzero_samples++;
+      }
+      
+      if( 0.0 != in_signal[ l - 1 ] )
+      {
+        nonzero_samples--;
+      }
+      
+      //  Start over from exactly zero instead of carrying the rounding
+      //  errors of the samples that left the window into the next burst
+      if( 0 == nonzero_samples )
+      {
+        window_energy = 0.0;
+        compensation  = 0.0;
+      }
+    }
+    
+    norm =
+      sqrt  (
+             in_correlator->reference_energy
+             * ( window_energy + compensation )
+             );
+    
+    if  (
+         0 == nonzero_samples
+         || 0.0 >= window_energy + compensation
+         || 0.0 >= norm
+         )
+    {
+      io_correlation[ l ] = 0.0;
+    }
+    else
+    {
+      io_correlation[ l ] =
+        CPC_MAX (
+                 FLOAT64,
+                 -1.0,
+                 CPC_MIN( FLOAT64, 1.0, io_correlation[ l ] / norm )
+                 );
+    }
+  }
+}
+
+void
+csignal_correlator_accumulate (
+                               FLOAT64* io_sum,
+                               FLOAT64* io_compensation,
+                               FLOAT64  in_value
+                               )
+{
+  FLOAT64 sum = *io_sum + in_value;
+  
+  //  The low-order bits of the smaller operand are lost in the addition
+  if( fabs( *io_sum ) >= fabs( in_value ) )
+  {
+    *io_compensation += ( *io_sum - sum ) + in_value;
+  }
+  else
+  {
+    *io_compensation += ( in_value - sum ) + *io_sum;
+  }
+  
+  *io_sum = sum;
+}
@@ -51,11 +51,16 @@ csignal_initialize( void )
   {
     cpc_initialize();
   }
+  
+  csignal_fft_select_kernel();
 }
 
 void
 csignal_terminate( void )
 {
+  csignal_release_fft_plan_cache();
+  csignal_release_thread_pool();
+  
   if( cpc_is_initialized() )
   {
     cpc_terminate();
@@ -307,6 +312,111 @@ csignal_modulate_BFSK_symbol  (
   return( return_value );
 }
 
+csignal_error_code
+csignal_demodulate_BFSK_symbol  (
+                                 UINT32    in_samples_per_symbol,
+                                 UINT32    in_sample_rate,
+                                 FLOAT32   in_carrier_frequency,
+                                 UINT32    in_separation_intervals,
+                                 USIZE     in_signal_length,
+                                 FLOAT64*  in_signal,
+                                 UINT32*   out_symbol
+                                 )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_signal || NULL == out_symbol )
+  {
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+    
+    CPC_ERROR (
+               "Signal (0x%x) or symbol (0x%x) are null.",
+               in_signal,
+               out_symbol
+               );
+  }
+  else if( in_signal_length < in_samples_per_symbol )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Signal length (%d) must be at least samples per symbol (%d).",
+               in_signal_length,
+               in_samples_per_symbol
+               );
+  }
+  else
+  {
+    FLOAT64 symbol_0_frequency  = 0.0;
+    FLOAT64 symbol_1_frequency  = 0.0;
+    FLOAT64 delta_frequency     = 0.0;
+    FLOAT64 bandwidth           = 0.0;
+    
+    return_value =
+      csignal_BFSK_determine_frequencies  (
+                                           in_samples_per_symbol,
+                                           in_sample_rate,
+                                           in_carrier_frequency,
+                                           in_separation_intervals,
+                                           &symbol_0_frequency,
+                                           &symbol_1_frequency,
+                                           &delta_frequency,
+                                           &bandwidth
+                                           );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      FLOAT64 symbol_0_power = 0.0;
+      FLOAT64 symbol_1_power = 0.0;
+      
+      return_value =
+        csignal_calculate_goertzel_power  (
+                                           in_carrier_frequency
+                                           + symbol_0_frequency,
+                                           in_sample_rate,
+                                           in_samples_per_symbol,
+                                           in_signal,
+                                           &symbol_0_power
+                                           );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          csignal_calculate_goertzel_power  (
+                                             in_carrier_frequency
+                                             + symbol_1_frequency,
+                                             in_sample_rate,
+                                             in_samples_per_symbol,
+                                             in_signal,
+                                             &symbol_1_power
+                                             );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        *out_symbol = ( symbol_1_power > symbol_0_power ? 1 : 0 );
+        
+        CPC_LOG (
+                 CPC_LOG_LEVEL_DEBUG,
+                 "Symbol 0 power: %.02f\tSymbol 1 power: %.02f",
+                 symbol_0_power,
+                 symbol_1_power
+                 );
+      }
+      else
+      {
+        CPC_ERROR( "Could not calculate power: 0x%x.", return_value );
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not determine frequencies: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
 csignal_error_code
 csignal_modulate_symbol (
                          UINT32   in_symbol,
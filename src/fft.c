@@ -4,6 +4,7 @@
     \author Brent Carrara
  */
 #include "fft.h"
+#include "fft_kernels.h"
 
 /*! \var    CALCULATE_FFT
     \brief  Flag used by the FFT algorithm from Numerical Recipes to indicate 
@@ -17,11 +18,34 @@
  */
 #define CALCULATE_IFFT  -1
 
-/*! \def    SWAP
-    \brief  Swaps the values in in_a and in_b. Used by the Numerical Recipes
-            FFT algorithm.
+/*! \def    CSIGNAL_TWO_PI
+    \brief  2 * pi, used to calculate the twiddle factors of a plan.
  */
-#define SWAP( in_a, in_b ) tempr=(in_a); (in_a)=(in_b); (in_b)=tempr;
+#define CSIGNAL_TWO_PI  6.28318530717958647692
+
+/*! \var    csignal_fft_plan_cache
+    \brief  Linked list of the plans created by csignal_get_fft_plan. Released
+            by csignal_release_fft_plan_cache.
+ */
+static csignal_fft_plan* csignal_fft_plan_cache = NULL;
+
+/*! \var    csignal_real_fft_plan_cache
+    \brief  Linked list of the plans created by csignal_get_real_fft_plan.
+            Released by csignal_release_fft_plan_cache.
+ */
+static csignal_real_fft_plan* csignal_real_fft_plan_cache = NULL;
+
+/*! \var    csignal_exact_fft_plan_cache
+    \brief  Linked list of the plans created by csignal_get_exact_fft_plan.
+            Released by csignal_release_fft_plan_cache.
+ */
+static csignal_exact_fft_plan* csignal_exact_fft_plan_cache = NULL;
+
+/*! \var    csignal_fft_plan_float32_cache
+    \brief  Linked list of the plans created by csignal_get_fft_plan_float32.
+            Released by csignal_release_fft_plan_cache.
+ */
+static csignal_fft_plan_float32* csignal_fft_plan_float32_cache = NULL;
 
 /*! \fn     csignal_error_code csignal_convert_real_array_to_complex_array (
               USIZE    in_real_signal_length,
@@ -59,26 +83,698 @@ csignal_convert_real_array_to_complex_array (
                                              FLOAT64* in_complex_signal
                                              );
 
-/*! \fn     void csignal_fft (
+/*! \fn     csignal_error_code csignal_fft (
               FLOAT64* io_data,
               USIZE    in_data_length,
               CHAR     in_sign
             )
-    \brief  The Numerical Recipes implementation of the FFT algorithm.
+    \brief  Calculates the FFT (or IFFT) of io_data in place using the cached
+            plan for in_data_length and scratch space allocated for the call.
  
     \param  io_data The compex-valued signal whose FFT (or IFFT) will be
                     calculated.
-    \param  in_data_length  The number of elements in io_data.
+    \param  in_data_length  The number of complex elements in io_data.
     \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
                     calculated.
+    \return Returns NO_ERROR upon succesful exection or one of the errors of
+            csignal_get_fft_plan or cpc_safe_malloc.
  */
-void
+csignal_error_code
 csignal_fft (
              FLOAT64* io_data,
              USIZE    in_data_length,
              CHAR     in_sign
              );
 
+/*! \fn     void csignal_calculate_bit_reversal (
+              USIZE  in_fft_length,
+              USIZE* out_bit_reversal
+            )
+    \brief  Fills out_bit_reversal with the bit-reversal permutation of
+            in_fft_length points. Shared by the FLOAT64 and FLOAT32 plans.
+ 
+    \param  in_fft_length The number of points. Must be a power of two.
+    \param  out_bit_reversal  in_fft_length elements, out_bit_reversal[ i ] is
+                              set to the index whose bits are the reverse of
+                              i's bits.
+ */
+void
+csignal_calculate_bit_reversal  (
+                                 USIZE  in_fft_length,
+                                 USIZE* out_bit_reversal
+                                 );
+
+/*! \var    CSIGNAL_SIX_STEP_TILE_SIZE
+    \brief  The transposes of the six-step algorithm move tiles of this many
+            rows and columns so that the rows read and written by a tile stay
+            in the L1 cache.
+ */
+#define CSIGNAL_SIX_STEP_TILE_SIZE  16
+
+/*! \var    csignal_six_step_job
+    \brief  The state shared by the tasks of one stage of the six-step
+            algorithm (see csignal_six_step_fft).
+ */
+typedef struct csignal_six_step_job_t
+{
+  /*! \var    plan
+      \brief  The six-step plan being executed.
+   */
+  csignal_fft_plan* plan;
+  
+  /*! \var    source
+      \brief  The matrix read by a transpose.
+   */
+  FLOAT64*          source;
+  
+  /*! \var    destination
+      \brief  The matrix written by a transpose or transformed by the sub-FFTs.
+   */
+  FLOAT64*          destination;
+  
+  /*! \var    number_of_rows
+      \brief  The number of rows of source (transposes) or destination
+              (sub-FFTs).
+   */
+  USIZE             number_of_rows;
+  
+  /*! \var    number_of_columns
+      \brief  The number of complex columns of source (transposes) or
+              destination (sub-FFTs).
+   */
+  USIZE             number_of_columns;
+  
+  /*! \var    twiddle_block_size
+      \brief  The twiddle factor W^( n2 * k1 ) is calculated as the product of
+              W^( n2 * ( k1 - k1 % twiddle_block_size ) ) and
+              W^( n2 * ( k1 % twiddle_block_size ) ), which only touches
+              2 * sqrt( N1 ) entries of the twiddle table per row instead of N1
+              entries spread over the whole table.
+   */
+  USIZE             twiddle_block_size;
+  
+  /*! \var    sign
+      \brief  +1 for the FFT, -1 for the IFFT.
+   */
+  CHAR              sign;
+  
+} csignal_six_step_job;
+
+/*! \fn     void csignal_fft_plan_transform (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          in_scratch,
+              FLOAT64*          in_data,
+              FLOAT64*          out_data,
+              CHAR              in_sign
+            )
+    \brief  Calculates the FFT (or IFFT) of in_data into out_data, which may
+            be the same buffer, using the kernel selected in fft_kernels.c or
+            the six-step algorithm with the shared thread pool for six-step
+            plans.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_scratch  The work space of a six-step transform, the plan's
+                        scratch or a buffer of the same size (see
+                        csignal_fft_scratch_length). May be null for other
+                        plans.
+    \param  in_data The compex-valued signal whose FFT (or IFFT) will be
+                    calculated.
+    \param  out_data  The FFT (or IFFT) of in_data.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_fft_plan_transform (
+                            csignal_fft_plan* in_plan,
+                            FLOAT64*          in_scratch,
+                            FLOAT64*          in_data,
+                            FLOAT64*          out_data,
+                            CHAR              in_sign
+                            );
+
+/*! \fn     void csignal_fft_plan_execute (
+              csignal_fft_plan*    in_plan,
+              csignal_thread_pool* in_pool,
+              FLOAT64*             in_scratch,
+              FLOAT64*             in_data,
+              FLOAT64*             out_data,
+              CHAR                 in_sign
+            )
+    \brief  See csignal_fft_plan_transform, six-step plans are executed with
+            in_pool, which may be null to execute them on the calling thread.
+ */
+void
+csignal_fft_plan_execute  (
+                           csignal_fft_plan*    in_plan,
+                           csignal_thread_pool* in_pool,
+                           FLOAT64*             in_scratch,
+                           FLOAT64*             in_data,
+                           FLOAT64*             out_data,
+                           CHAR                 in_sign
+                           );
+
+/*! \fn     USIZE csignal_fft_scratch_length (
+              csignal_fft_plan* in_plan
+            )
+    \brief  Returns the number of elements of work space a transform with
+            in_plan needs, 2 * fft_length for six-step plans and zero for the
+            others.
+ */
+USIZE
+csignal_fft_scratch_length  (
+                             csignal_fft_plan* in_plan
+                             );
+
+/*! \fn     void csignal_six_step_fft (
+              csignal_fft_plan*    in_plan,
+              csignal_thread_pool* in_pool,
+              FLOAT64*             in_scratch,
+              FLOAT64*             in_data,
+              FLOAT64*             out_data,
+              CHAR                 in_sign
+            )
+    \brief  Calculates the FFT (or IFFT) of in_data into out_data with the
+            six-step algorithm. With n = N2 * n1 + n2 and k = k1 + N1 * k2:
+ 
+            X[ k1 + N1 * k2 ] = sum_n2 W_N2^( n2 * k2 ) W_N^( n2 * k1 )
+                                  sum_n1 W_N1^( n1 * k1 ) x[ N2 * n1 + n2 ]
+ 
+            so the input, read as an N1 x N2 matrix, is transposed into
+            in_scratch, each of its N2 rows is transformed with the
+            column plan and multiplied by W_N^( n2 * k1 ), the result is
+            transposed into out_data, each of its N1 rows is transformed with
+            the row plan and a final transpose puts the bins in order. in_data
+            is only read by the first transpose so it may be out_data.
+ 
+    \param  in_plan The six-step plan.
+    \param  in_pool The pool the stages are spread over, or null.
+    \param  in_scratch  2 * fft_length elements of work space.
+    \param  in_data The compex-valued signal whose FFT (or IFFT) will be
+                    calculated.
+    \param  out_data  The FFT (or IFFT) of in_data.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_six_step_fft  (
+                       csignal_fft_plan*    in_plan,
+                       csignal_thread_pool* in_pool,
+                       FLOAT64*             in_scratch,
+                       FLOAT64*             in_data,
+                       FLOAT64*             out_data,
+                       CHAR                 in_sign
+                       );
+
+/*! \fn     void csignal_six_step_transpose_task (
+              void* in_job,
+              USIZE in_index
+            )
+    \brief  Transposes CSIGNAL_SIX_STEP_TILE_SIZE rows of the job's source
+            matrix, starting at row in_index * CSIGNAL_SIX_STEP_TILE_SIZE, into
+            the job's destination matrix.
+ 
+    \param  in_job  The csignal_six_step_job of the transpose.
+    \param  in_index  The block of rows to transpose.
+ */
+void
+csignal_six_step_transpose_task (
+                                 void* in_job,
+                                 USIZE in_index
+                                 );
+
+/*! \fn     void csignal_six_step_column_task (
+              void* in_job,
+              USIZE in_index
+            )
+    \brief  Transforms row n2 = in_index of the job's destination matrix with
+            the column plan and multiplies bin k1 by W_N^( n2 * k1 ).
+ 
+    \param  in_job  The csignal_six_step_job of the stage.
+    \param  in_index  The row to transform.
+ */
+void
+csignal_six_step_column_task  (
+                               void* in_job,
+                               USIZE in_index
+                               );
+
+/*! \fn     void csignal_six_step_row_task (
+              void* in_job,
+              USIZE in_index
+            )
+    \brief  Transforms row in_index of the job's destination matrix with the
+            row plan.
+ 
+    \param  in_job  The csignal_six_step_job of the stage.
+    \param  in_index  The row to transform.
+ */
+void
+csignal_six_step_row_task (
+                           void* in_job,
+                           USIZE in_index
+                           );
+
+/*! \fn     void csignal_six_step_twiddle (
+              csignal_fft_plan* in_plan,
+              USIZE             in_exponent,
+              CHAR              in_sign,
+              FLOAT64*          out_real,
+              FLOAT64*          out_imaginary
+            )
+    \brief  Looks up W^( in_sign * in_exponent ) in the half-circle twiddle
+            table of a six-step plan.
+ 
+    \param  in_plan The six-step plan.
+    \param  in_exponent The exponent, any value (it is reduced modulo the
+                        transform length).
+    \param  in_sign If -1 the conjugate of the twiddle factor is returned.
+    \param  out_real  The real component of the twiddle factor.
+    \param  out_imaginary The imaginary component of the twiddle factor.
+ */
+void
+csignal_six_step_twiddle  (
+                           csignal_fft_plan* in_plan,
+                           USIZE             in_exponent,
+                           CHAR              in_sign,
+                           FLOAT64*          out_real,
+                           FLOAT64*          out_imaginary
+                           );
+
+/*! \fn     void csignal_real_fft_split (
+              csignal_real_fft_plan* in_plan,
+              FLOAT64*               io_data,
+              CHAR                   in_sign
+            )
+    \brief  Converts the half-length complex FFT, Z, of the real signal packed
+            as z[ m ] = x[ 2m ] + i x[ 2m + 1 ] into the non-redundant bins of
+            the real signal's FFT, X, in place:
+ 
+            X[ k ] = E[ k ] + W^k O[ k ], where
+            E[ k ] = ( Z[ k ] + conj( Z[ M - k ] ) ) / 2 and
+            O[ k ] = ( Z[ k ] - conj( Z[ M - k ] ) ) / 2i.
+ 
+            Bins k and M - k are calculated together since they share their
+            inputs, which is what allows the conversion to be done in place.
+ 
+    \param  in_plan The real-input plan.
+    \param  io_data The half-length complex FFT (signal_length elements) on
+                    input and the signal_length / 2 + 1 bins on output
+                    (signal_length + 2 elements).
+    \param  in_sign +1 if Z is a forward FFT, -1 if it is an inverse FFT.
+ */
+void
+csignal_real_fft_split (
+                        csignal_real_fft_plan* in_plan,
+                        FLOAT64*               io_data,
+                        CHAR                   in_sign
+                        );
+
+/*! \fn     void csignal_real_fft_merge (
+              csignal_real_fft_plan* in_plan,
+              FLOAT64*               in_fft,
+              FLOAT64*               out_data,
+              CHAR                   in_sign
+            )
+    \brief  The inverse of csignal_real_fft_split. Combines the non-redundant
+            bins of a real signal's spectrum, X, into the spectrum, Z, of the
+            half-length complex signal, i.e., Z[ k ] = E[ k ] + i O[ k ] where
+            E[ k ] = X[ k ] + conj( X[ M - k ] ) and O[ k ] = ( X[ k ] -
+            conj( X[ M - k ] ) ) conj( W^k ). The factor of two left in E and O
+            makes the half-length unscaled IFFT return signal_length * x.
+ 
+    \param  in_plan The real-input plan.
+    \param  in_fft  The signal_length / 2 + 1 bins. May equal out_data.
+    \param  out_data  The signal_length / 2 complex values of Z.
+    \param  in_sign +1 if X is a forward FFT, -1 if it is an inverse FFT.
+ */
+void
+csignal_real_fft_merge (
+                        csignal_real_fft_plan* in_plan,
+                        FLOAT64*               in_fft,
+                        FLOAT64*               out_data,
+                        CHAR                   in_sign
+                        );
+
+/*! \fn     void csignal_real_fft_full_spectrum (
+              csignal_real_fft_plan* in_plan,
+              FLOAT64*               in_scratch,
+              USIZE                  in_signal_length,
+              FLOAT64*               in_signal,
+              FLOAT64*               out_fft
+            )
+    \brief  Calculates all signal_length bins of the FFT of the real-valued
+            in_signal zero-padded to the plan's signal length, i.e., the
+            non-redundant bins are calculated with the real-input plan and the
+            rest are filled in as their complex conjugates.
+ 
+    \param  in_plan The real-input plan.
+    \param  in_scratch  csignal_get_real_fft_scratch_length( in_plan ) elements
+                        of work space.
+    \param  in_signal_length  The number of samples in in_signal, at most the
+                              plan's signal length.
+    \param  in_signal The signal to transform.
+    \param  out_fft The 2 * signal_length elements of the FFT. Must not
+                    overlap in_signal.
+ */
+void
+csignal_real_fft_full_spectrum  (
+                                 csignal_real_fft_plan* in_plan,
+                                 FLOAT64*               in_scratch,
+                                 USIZE                  in_signal_length,
+                                 FLOAT64*               in_signal,
+                                 FLOAT64*               out_fft
+                                 );
+
+/*! \fn     void csignal_exact_fft_transform (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                in_scratch,
+              FLOAT64*                in_fft_scratch,
+              FLOAT64*                in_data,
+              FLOAT64*                out_data,
+              CHAR                    in_sign
+            )
+    \brief  Calculates the FFT (or IFFT) of in_data into out_data with the
+            algorithm selected by in_plan. Allocates no memory.
+ 
+    \param  in_plan The exact-length plan.
+    \param  in_scratch  The work space of the transform, the plan's scratch
+                        or a buffer of the same size (see
+                        csignal_exact_fft_scratch_length).
+    \param  in_fft_scratch  The work space of the power of two FFT of the
+                            plan, its scratch or a buffer of the same size
+                            (see csignal_fft_scratch_length). May be null if
+                            that is zero.
+    \param  in_data The complex-valued signal (2 * fft_length elements).
+    \param  out_data  The transform of in_data. May be the same buffer as
+                      in_data, but must not otherwise overlap it.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_exact_fft_transform (
+                             csignal_exact_fft_plan* in_plan,
+                             FLOAT64*                in_scratch,
+                             FLOAT64*                in_fft_scratch,
+                             FLOAT64*                in_data,
+                             FLOAT64*                out_data,
+                             CHAR                    in_sign
+                             );
+
+/*! \fn     void csignal_mixed_radix_pass (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                in_data,
+              FLOAT64*                out_data,
+              USIZE                   in_stride,
+              USIZE                   in_radix,
+              CHAR                    in_sign
+            )
+    \brief  One decimation in frequency pass of the Stockham FFT. The input
+            is viewed as in_stride interleaved sub-signals of length n =
+            fft_length / in_stride, each of which is split into in_radix
+            sub-signals of length m = n / in_radix:
+ 
+            out[ q + s( p * j + k ) ] =
+              W_n^( j * k ) sum_r in[ q + s( j + r * m ) ] W_p^( r * k )
+ 
+            where s = in_stride and p = in_radix. Writing the output in this
+            order is what makes the algorithm self-sorting, i.e., no
+            bit-reversal (digit-reversal) permutation is needed.
+ 
+    \param  in_plan The mixed-radix plan.
+    \param  in_data The input of the pass. Not modified.
+    \param  out_data  The output of the pass. Must not overlap in_data.
+    \param  in_stride The product of the radices of the previous passes.
+    \param  in_radix  The radix of this pass (2, 3, 4, 5 or 7).
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_mixed_radix_pass  (
+                           csignal_exact_fft_plan* in_plan,
+                           FLOAT64*                in_data,
+                           FLOAT64*                out_data,
+                           USIZE                   in_stride,
+                           USIZE                   in_radix,
+                           CHAR                    in_sign
+                           );
+
+/*! \fn     void csignal_bluestein_fft (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                in_scratch,
+              FLOAT64*                in_fft_scratch,
+              FLOAT64*                in_data,
+              FLOAT64*                out_data,
+              CHAR                    in_sign
+            )
+    \brief  Calculates the DFT of io_data using jk = ( j^2 + k^2 - ( k - j )^2
+            ) / 2, which turns it into X[ k ] = c[ k ] sum_j ( x[ j ] c[ j ] )
+            conj( c[ k - j ] ), i.e., a convolution with the conjugate chirp
+            that is calculated with power of two FFTs.
+ 
+    \param  in_plan The Bluestein plan.
+    \param  in_scratch  convolution_length complex points of work space.
+    \param  in_fft_scratch  The work space of the convolution FFTs (see
+                            csignal_fft_scratch_length).
+    \param  in_data The complex-valued signal (2 * fft_length elements).
+    \param  out_data  The transform of in_data. May be the same buffer as
+                      in_data.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_bluestein_fft (
+                       csignal_exact_fft_plan* in_plan,
+                       FLOAT64*                in_scratch,
+                       FLOAT64*                in_fft_scratch,
+                       FLOAT64*                in_data,
+                       FLOAT64*                out_data,
+                       CHAR                    in_sign
+                       );
+
+/*! \fn     USIZE csignal_exact_fft_scratch_length (
+              csignal_exact_fft_plan* in_plan
+            )
+    \brief  Returns the number of elements in the scratch space of in_plan,
+            zero for power of two plans, which need none. The work space of
+            the power of two FFT of the plan is not included.
+ */
+USIZE
+csignal_exact_fft_scratch_length  (
+                                   csignal_exact_fft_plan* in_plan
+                                   );
+
+/*! \fn     csignal_error_code csignal_exact_fft_calculate (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                in_data,
+              FLOAT64*                out_data,
+              CHAR                    in_sign
+            )
+    \brief  csignal_exact_fft_transform with scratch space allocated for the
+            call instead of the plan's, so that the one-shot functions can
+            execute a cached plan from several threads at the same time.
+ 
+    \param  in_plan The exact-length plan.
+    \param  in_data The complex-valued signal (2 * fft_length elements).
+    \param  out_data  The transform of in_data. May be the same buffer as
+                      in_data, but must not otherwise overlap it.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+    \return Returns NO_ERROR upon succesful exection or one of the errors of
+            cpc_safe_malloc.
+ */
+csignal_error_code
+csignal_exact_fft_calculate (
+                             csignal_exact_fft_plan* in_plan,
+                             FLOAT64*                in_data,
+                             FLOAT64*                out_data,
+                             CHAR                    in_sign
+                             );
+
+/*! \fn     void csignal_exact_fft_execute (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                in_data,
+              FLOAT64*                out_data,
+              CHAR                    in_sign
+            )
+    \brief  csignal_exact_fft_transform with the scratch space of in_plan and
+            of its power of two FFT, used by the execute functions.
+ 
+    \param  in_plan The exact-length plan.
+    \param  in_data The complex-valued signal (2 * fft_length elements).
+    \param  out_data  The transform of in_data. May be the same buffer as
+                      in_data, but must not otherwise overlap it.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_exact_fft_execute (
+                           csignal_exact_fft_plan* in_plan,
+                           FLOAT64*                in_data,
+                           FLOAT64*                out_data,
+                           CHAR                    in_sign
+                           );
+
+/*! \fn     void csignal_chirp_z_transform (
+              csignal_chirp_z_plan* in_plan,
+              FLOAT64*              in_signal,
+              CPC_BOOL              in_real,
+              FLOAT64*              out_bins
+            )
+    \brief  Calculates X[ k ] = w[ k ] sum_n ( x[ n ] a[ n ] ) conj( w[ k - n ]
+            ), where a is the input chirp and w the output chirp, with one
+            forward and one inverse power of two FFT.
+ 
+    \param  in_plan The chirp-z plan.
+    \param  in_signal The signal_length samples.
+    \param  in_real If CPC_TRUE in_signal holds real samples, otherwise it
+                    holds interleaved real and imaginary components.
+    \param  out_bins  The number_of_bins complex bins. May be the same buffer
+                      as in_signal.
+ */
+void
+csignal_chirp_z_transform (
+                           csignal_chirp_z_plan* in_plan,
+                           FLOAT64*              in_signal,
+                           CPC_BOOL              in_real,
+                           FLOAT64*              out_bins
+                           );
+
+csignal_error_code
+csignal_calculate_batch_FFT (
+                             USIZE      in_number_of_frames,
+                             USIZE      in_frame_length,
+                             FLOAT64*   in_signal,
+                             USIZE*     out_fft_length,
+                             FLOAT64**  out_fft
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  USIZE fft_points = csignal_calculate_closest_power_of_two( in_frame_length );
+  
+  if  (
+       NULL == in_signal
+       || NULL == out_fft_length
+       || NULL == out_fft
+       )
+  {
+    CPC_ERROR (
+               "Signal (0x%x), fft length (0x%x), or fft (0x%x) are null.",
+               in_signal,
+               out_fft_length,
+               out_fft
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_number_of_frames || 0 == in_frame_length )
+  {
+    CPC_ERROR (
+               "Number of frames (%d) or frame length (%d) is zero.",
+               in_number_of_frames,
+               in_frame_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if (
+           *out_fft_length != 0
+           && ( in_number_of_frames * 2 * fft_points ) > *out_fft_length
+           )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) must be greater or equal to %d frames of"
+               " %d elements.",
+               *out_fft_length,
+               in_number_of_frames,
+               2 * fft_points
+               );
+  }
+  else if( *out_fft_length != 0 && NULL == *out_fft )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) is set, but out fft (0x%x) is null.",
+               *out_fft_length,
+               *out_fft
+               );
+  }
+  else
+  {
+    USIZE frame_size = 2 * fft_points;
+    
+    *out_fft_length = in_number_of_frames * frame_size;
+    
+    if( NULL == *out_fft )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_fft,
+                         sizeof( FLOAT64 ) * *out_fft_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR != return_value )
+    {
+      CPC_ERROR( "Could not malloc fft: 0x%x.", return_value );
+    }
+    else if( 1 < fft_points )
+    {
+      csignal_real_fft_plan* plan = NULL;
+      FLOAT64* scratch            = NULL;
+      
+      return_value = csignal_get_real_fft_plan( fft_points, &plan );
+      
+      if  (
+           CPC_ERROR_CODE_NO_ERROR == return_value
+           && 0 < csignal_get_real_fft_scratch_length( plan )
+           )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &scratch,
+                           sizeof( FLOAT64 )
+                           * csignal_get_real_fft_scratch_length( plan )
+                           );
+      }
+      
+      for (
+           USIZE i = 0;
+           i < in_number_of_frames && CPC_ERROR_CODE_NO_ERROR == return_value;
+           i++
+           )
+      {
+        csignal_real_fft_full_spectrum  (
+                                         plan,
+                                         scratch,
+                                         in_frame_length,
+                                         in_signal + i * in_frame_length,
+                                         *out_fft + i * frame_size
+                                         );
+      }
+      
+      if( NULL != scratch )
+      {
+        cpc_safe_free( ( void** ) &scratch );
+      }
+    }
+    else
+    {
+      //  A one sample FFT is the sample itself
+      for( USIZE i = 0; i < in_number_of_frames; i++ )
+      {
+        ( *out_fft )[ 2 * i ]     = in_signal[ i ];
+        ( *out_fft )[ 2 * i + 1 ] = 0.0;
+      }
+    }
+  }
+  
+  return( return_value );
+}
+
 csignal_error_code
 csignal_calculate_FFT (
                        USIZE      in_signal_length,
@@ -152,7 +848,50 @@ csignal_calculate_FFT (
                          );
     }
     
-    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    if( CPC_ERROR_CODE_NO_ERROR == return_value && 2 < *out_fft_length )
+    {
+      //  The input is real so only the first N / 2 + 1 bins need to be
+      //  calculated, the rest are their complex conjugates.
+      USIZE fft_points              = *out_fft_length / 2;
+      csignal_real_fft_plan* plan   = NULL;
+      FLOAT64* scratch              = NULL;
+      
+      return_value = csignal_get_real_fft_plan( fft_points, &plan );
+      
+      if  (
+           CPC_ERROR_CODE_NO_ERROR == return_value
+           && 0 < csignal_get_real_fft_scratch_length( plan )
+           )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &scratch,
+                           sizeof( FLOAT64 )
+                           * csignal_get_real_fft_scratch_length( plan )
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        csignal_real_fft_full_spectrum  (
+                                         plan,
+                                         scratch,
+                                         in_signal_length,
+                                         in_signal,
+                                         *out_fft
+                                         );
+        
+        if( NULL != scratch )
+        {
+          cpc_safe_free( ( void** ) &scratch );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not calculate real FFT: 0x%x.", return_value );
+      }
+    }
+    else if( CPC_ERROR_CODE_NO_ERROR == return_value )
     {
       return_value =
         csignal_convert_real_array_to_complex_array (
@@ -174,9 +913,8 @@ csignal_calculate_FFT (
         
         CPC_LOG( CPC_LOG_LEVEL_TRACE, "Length is %d.", *out_fft_length );
         
-        //  The -1 is required for the first parameter because of the way the
-        //  fft algorithm was written in Numerical Recipes.
-        csignal_fft( *out_fft - 1, *out_fft_length / 2, CALCULATE_FFT );
+        return_value =
+          csignal_fft( *out_fft, *out_fft_length / 2, CALCULATE_FFT );
       }
     }
     else
@@ -283,9 +1021,8 @@ csignal_calculate_IFFT (
         
         CPC_LOG( CPC_LOG_LEVEL_TRACE, "Length is %d.", *out_signal_length );
         
-        //  The -1 is required for the first parameter because of the way the
-        //  fft algorithm was written in Numerical Recipes.
-        csignal_fft( *out_signal - 1, *out_signal_length / 2, CALCULATE_IFFT );
+        return_value =
+          csignal_fft( *out_signal, *out_signal_length / 2, CALCULATE_IFFT );
       }
     }
     else
@@ -297,64 +1034,3837 @@ csignal_calculate_IFFT (
   return( return_value );
 }
 
-void
-csignal_fft (
-             FLOAT64* io_data,
-             USIZE    in_data_length,
-             CHAR     in_sign
-             )
+csignal_error_code
+csignal_calculate_complex_IFFT  (
+                                 USIZE      in_fft_length,
+                                 FLOAT64*   in_fft,
+                                 USIZE*     out_signal_length,
+                                 FLOAT64**  out_signal
+                                 )
 {
-  FLOAT64* data = io_data;
-  USIZE nn      = in_data_length;
-  FLOAT64 isign = ( in_sign * 1.0 );
-  
-  USIZE n,mmax,m,j,istep,i;
-  FLOAT64 wtemp,wr,wpr,wpi,wi,theta;
-  FLOAT64 tempr,tempi;
-  
-  n=nn << 1;
-  j=1;
-  
-  for (i=1;i<n;i+=2) {
-    if (j > i) {
-      
-      SWAP(data[j],data[i]);
-      SWAP(data[j+1],data[i+1]);
-    }
-    m=nn;
-    while (m >= 2 && j > m) {
-      j -= m;
-      m >>= 1;
-    }
-    j += m;
-  }
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
   
-  mmax=2;
-  while (n > mmax) {
-    istep=mmax << 1;
-    theta=isign*(6.28318530717959/mmax);
-    wtemp=sin(0.5*theta);
-    wpr = -2.0*wtemp*wtemp;
-    wpi=sin(theta);
-    wr=1.0;
-    wi=0.0;
-    for (m=1;m<mmax;m+=2) {
-      for (i=m;i<=n;i+=istep) {
-        j=i+mmax;
-        
-        tempr=wr*data[j]-wi*data[j+1];
-        tempi=wr*data[j+1]+wi*data[j];
+  if  (
+       NULL == in_fft
+       || NULL == out_signal_length
+       || NULL == out_signal
+       )
+  {
+    CPC_ERROR (
+               "FFT (0x%x), signal length (0x%x), or signal (0x%x) are null.",
+               in_fft,
+               out_signal_length,
+               out_signal
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_fft_length || 0 != ( in_fft_length % 2 ) )
+  {
+    CPC_ERROR (
+               "FFT length (%d) must be a non-zero multiple of two.",
+               in_fft_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if( *out_signal_length != 0 && in_fft_length > *out_signal_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out signal length (%d) must be greater or equal to the fft"
+               " length (%d).",
+               *out_signal_length,
+               in_fft_length
+               );
+  }
+  else if( *out_signal_length != 0 && NULL == *out_signal )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out signal length (%d) is set, but out signal (0x%x) is null.",
+               *out_signal_length,
+               *out_signal
+               );
+  }
+  else
+  {
+    csignal_exact_fft_plan* plan = NULL;
+    
+    USIZE number_of_bins = in_fft_length / 2;
+    
+    *out_signal_length = in_fft_length;
+    
+    if( NULL == *out_signal )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_signal,
+                         sizeof( FLOAT64 ) * *out_signal_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = csignal_get_exact_fft_plan( number_of_bins, &plan );
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc signal: 0x%x.", return_value );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value =
+        csignal_exact_fft_calculate (
+                                     plan,
+                                     in_fft,
+                                     *out_signal,
+                                     CALCULATE_IFFT
+                                     );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      FLOAT64 scale = 1.0 / ( number_of_bins * 1.0 );
+      
+      for( USIZE i = 0; i < in_fft_length; i++ )
+      {
+        ( *out_signal )[ i ] *= scale;
+      }
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_fft_plan (
+                             USIZE              in_fft_length,
+                             csignal_fft_plan** out_plan
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           0 == in_fft_length
+           || 0 != ( in_fft_length & ( in_fft_length - 1 ) )
+           )
+  {
+    CPC_ERROR (
+               "FFT length (%d) must be a non-zero power of two.",
+               in_fft_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_plan = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_plan, sizeof( csignal_fft_plan ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      USIZE number_of_bits = 0;
+      
+      while( ( ( USIZE ) 1 << number_of_bits ) < in_fft_length )
+      {
+        number_of_bits++;
+      }
+      
+      ( *out_plan )->fft_length   = in_fft_length;
+      ( *out_plan )->bit_reversal = NULL;
+      ( *out_plan )->twiddles     = NULL;
+      ( *out_plan )->column_plan  = NULL;
+      ( *out_plan )->row_plan     = NULL;
+      ( *out_plan )->scratch      = NULL;
+      ( *out_plan )->next         = NULL;
+      
+      if( CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH <= in_fft_length )
+      {
+        USIZE columns = ( USIZE ) 1 << ( number_of_bits / 2 );
+        
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->twiddles ),
+                           sizeof( FLOAT64 ) * in_fft_length
+                           );
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          return_value =
+            cpc_safe_malloc (
+                             ( void** ) &( ( *out_plan )->scratch ),
+                             sizeof( FLOAT64 ) * 2 * in_fft_length
+                             );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          return_value =
+            csignal_initialize_fft_plan (
+                                         columns,
+                                         &( ( *out_plan )->column_plan )
+                                         );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          return_value =
+            csignal_initialize_fft_plan (
+                                         in_fft_length / columns,
+                                         &( ( *out_plan )->row_plan )
+                                         );
+        }
+      }
+      else
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->bit_reversal ),
+                           sizeof( USIZE ) * in_fft_length
+                           );
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          //  The plan always holds at least one twiddle factor so that a
+          //  plan of length 1 has a valid table.
+          return_value =
+            cpc_safe_malloc (
+                             ( void** ) &( ( *out_plan )->twiddles ),
+                             sizeof( FLOAT64 ) * 2
+                             * ( 1 < in_fft_length ? 3 * in_fft_length / 4 : 1 )
+                             );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          csignal_calculate_bit_reversal  (
+                                           in_fft_length,
+                                           ( *out_plan )->bit_reversal
+                                           );
+        }
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        USIZE number_of_twiddles =
+          NULL == ( *out_plan )->row_plan
+          ? 3 * in_fft_length / 4
+          : in_fft_length / 2;
+        
+        ( *out_plan )->twiddles[ 0 ] = 1.0;
+        ( *out_plan )->twiddles[ 1 ] = 0.0;
+        
+        for( USIZE k = 1; k < number_of_twiddles; k++ )
+        {
+          FLOAT64 theta =
+            ( CSIGNAL_TWO_PI * k ) / ( in_fft_length * 1.0 );
+          
+          ( *out_plan )->twiddles[ 2 * k ]      = cos( theta );
+          ( *out_plan )->twiddles[ 2 * k + 1 ]  = sin( theta );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not malloc plan tables: 0x%x.", return_value );
+        
+        csignal_destroy_fft_plan( *out_plan );
+        
+        *out_plan = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc plan: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_fft_plan (
+                          csignal_fft_plan* io_plan
+                          )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_plan->bit_reversal )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->bit_reversal ) );
+    }
+    
+    if( NULL != io_plan->twiddles )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->twiddles ) );
+    }
+    
+    if( NULL != io_plan->scratch )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->scratch ) );
+    }
+    
+    if( NULL != io_plan->column_plan )
+    {
+      return_value = csignal_destroy_fft_plan( io_plan->column_plan );
+    }
+    
+    if( NULL != io_plan->row_plan )
+    {
+      return_value = csignal_destroy_fft_plan( io_plan->row_plan );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_plan );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_get_fft_plan (
+                      USIZE              in_fft_length,
+                      csignal_fft_plan** out_plan
+                      )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_fft_plan* plan     = NULL;
+    csignal_fft_plan* new_plan = NULL;
+    
+    csignal_lock_library();
+    
+    plan = csignal_fft_plan_cache;
+    
+    while( NULL != plan && plan->fft_length != in_fft_length )
+    {
+      plan = plan->next;
+    }
+    
+    csignal_unlock_library();
+    
+    //  The plan is created without holding the lock, so another thread may
+    //  have cached a plan of the same length in the meantime, in which case
+    //  the new one is discarded
+    if( NULL == plan )
+    {
+      return_value = csignal_initialize_fft_plan( in_fft_length, &new_plan );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        csignal_lock_library();
+        
+        plan = csignal_fft_plan_cache;
+        
+        while( NULL != plan && plan->fft_length != in_fft_length )
+        {
+          plan = plan->next;
+        }
+        
+        if( NULL == plan )
+        {
+          CPC_LOG (
+                   CPC_LOG_LEVEL_DEBUG,
+                   "Caching new FFT plan of length %d.",
+                   in_fft_length
+                   );
+          
+          new_plan->next          = csignal_fft_plan_cache;
+          csignal_fft_plan_cache  = new_plan;
+          
+          plan      = new_plan;
+          new_plan  = NULL;
+        }
+        
+        csignal_unlock_library();
+        
+        if( NULL != new_plan )
+        {
+          csignal_destroy_fft_plan( new_plan );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not create FFT plan: 0x%x.", return_value );
+      }
+    }
+    
+    *out_plan = plan;
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_release_fft_plan_cache( void )
+{
+  while( NULL != csignal_fft_plan_float32_cache )
+  {
+    csignal_fft_plan_float32* plan  = csignal_fft_plan_float32_cache;
+    csignal_fft_plan_float32_cache  = plan->next;
+    
+    csignal_destroy_fft_plan_float32( plan );
+  }
+  
+  while( NULL != csignal_exact_fft_plan_cache )
+  {
+    csignal_exact_fft_plan* plan  = csignal_exact_fft_plan_cache;
+    csignal_exact_fft_plan_cache  = plan->next;
+    
+    csignal_destroy_exact_fft_plan( plan );
+  }
+  
+  while( NULL != csignal_real_fft_plan_cache )
+  {
+    csignal_real_fft_plan* plan = csignal_real_fft_plan_cache;
+    csignal_real_fft_plan_cache = plan->next;
+    
+    csignal_destroy_real_fft_plan( plan );
+  }
+  
+  while( NULL != csignal_fft_plan_cache )
+  {
+    csignal_fft_plan* plan  = csignal_fft_plan_cache;
+    csignal_fft_plan_cache  = plan->next;
+    
+    csignal_destroy_fft_plan( plan );
+  }
+}
+
+csignal_error_code
+csignal_execute_FFT (
+                     csignal_fft_plan* in_plan,
+                     FLOAT64*          io_data
+                     )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == io_data )
+  {
+    CPC_ERROR( "Plan (0x%x) or data (0x%x) are null.", in_plan, io_data );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_fft_plan_transform  (
+                                 in_plan,
+                                 in_plan->scratch,
+                                 io_data,
+                                 io_data,
+                                 CALCULATE_FFT
+                                 );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_IFFT (
+                      csignal_fft_plan* in_plan,
+                      FLOAT64*          io_data
+                      )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == io_data )
+  {
+    CPC_ERROR( "Plan (0x%x) or data (0x%x) are null.", in_plan, io_data );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_fft_plan_transform  (
+                                 in_plan,
+                                 in_plan->scratch,
+                                 io_data,
+                                 io_data,
+                                 CALCULATE_IFFT
+                                 );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_FFT_out_of_place (
+                                  csignal_fft_plan* in_plan,
+                                  FLOAT64*          in_data,
+                                  FLOAT64*          out_data
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length
+           && out_data < in_data + 2 * in_plan->fft_length
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    csignal_fft_plan_transform  (
+                                 in_plan,
+                                 in_plan->scratch,
+                                 in_data,
+                                 out_data,
+                                 CALCULATE_FFT
+                                 );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_IFFT_out_of_place (
+                                   csignal_fft_plan* in_plan,
+                                   FLOAT64*          in_data,
+                                   FLOAT64*          out_data
+                                   )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length
+           && out_data < in_data + 2 * in_plan->fft_length
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    csignal_fft_plan_transform  (
+                                 in_plan,
+                                 in_plan->scratch,
+                                 in_data,
+                                 out_data,
+                                 CALCULATE_IFFT
+                                 );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_batch_FFT (
+                           csignal_fft_plan* in_plan,
+                           USIZE             in_number_of_frames,
+                           FLOAT64*          in_data,
+                           FLOAT64*          out_data
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length * in_number_of_frames
+           && out_data < in_data + 2 * in_plan->fft_length * in_number_of_frames
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    USIZE frame_size = 2 * in_plan->fft_length;
+    
+    for( USIZE i = 0; i < in_number_of_frames; i++ )
+    {
+      csignal_fft_plan_transform  (
+                                   in_plan,
+                                   in_plan->scratch,
+                                   in_data + i * frame_size,
+                                   out_data + i * frame_size,
+                                   CALCULATE_FFT
+                                   );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_batch_IFFT  (
+                             csignal_fft_plan* in_plan,
+                             USIZE             in_number_of_frames,
+                             FLOAT64*          in_data,
+                             FLOAT64*          out_data
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length * in_number_of_frames
+           && out_data < in_data + 2 * in_plan->fft_length * in_number_of_frames
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    USIZE frame_size = 2 * in_plan->fft_length;
+    
+    for( USIZE i = 0; i < in_number_of_frames; i++ )
+    {
+      csignal_fft_plan_transform  (
+                                   in_plan,
+                                   in_plan->scratch,
+                                   in_data + i * frame_size,
+                                   out_data + i * frame_size,
+                                   CALCULATE_IFFT
+                                   );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_real_fft_plan (
+                                  USIZE                   in_signal_length,
+                                  csignal_real_fft_plan** out_plan
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           2 > in_signal_length
+           || 0 != ( in_signal_length & ( in_signal_length - 1 ) )
+           )
+  {
+    CPC_ERROR (
+               "Signal length (%d) must be a power of two of at least two.",
+               in_signal_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_plan = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_plan, sizeof( csignal_real_fft_plan ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      USIZE number_of_twiddles = in_signal_length / 4 + 1;
+      
+      ( *out_plan )->signal_length  = in_signal_length;
+      ( *out_plan )->complex_plan   = NULL;
+      ( *out_plan )->twiddles       = NULL;
+      ( *out_plan )->next           = NULL;
+      
+      return_value =
+        csignal_initialize_fft_plan (
+                                     in_signal_length / 2,
+                                     &( ( *out_plan )->complex_plan )
+                                     );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->twiddles ),
+                           sizeof( FLOAT64 ) * 2 * number_of_twiddles
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        for( USIZE k = 0; k < number_of_twiddles; k++ )
+        {
+          FLOAT64 theta =
+            ( CSIGNAL_TWO_PI * k ) / ( in_signal_length * 1.0 );
+          
+          ( *out_plan )->twiddles[ 2 * k ]      = cos( theta );
+          ( *out_plan )->twiddles[ 2 * k + 1 ]  = sin( theta );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not create plan tables: 0x%x.", return_value );
+        
+        csignal_destroy_real_fft_plan( *out_plan );
+        
+        *out_plan = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc plan: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_real_fft_plan (
+                               csignal_real_fft_plan* io_plan
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_plan->complex_plan )
+    {
+      return_value = csignal_destroy_fft_plan( io_plan->complex_plan );
+    }
+    
+    if( NULL != io_plan->twiddles )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->twiddles ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_plan );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_get_real_fft_plan (
+                           USIZE                   in_signal_length,
+                           csignal_real_fft_plan** out_plan
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_real_fft_plan* plan     = NULL;
+    csignal_real_fft_plan* new_plan = NULL;
+    
+    csignal_lock_library();
+    
+    plan = csignal_real_fft_plan_cache;
+    
+    while( NULL != plan && plan->signal_length != in_signal_length )
+    {
+      plan = plan->next;
+    }
+    
+    csignal_unlock_library();
+    
+    //  The plan is created without holding the lock, so another thread may
+    //  have cached a plan of the same length in the meantime, in which case
+    //  the new one is discarded
+    if( NULL == plan )
+    {
+      return_value =
+        csignal_initialize_real_fft_plan( in_signal_length, &new_plan );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        csignal_lock_library();
+        
+        plan = csignal_real_fft_plan_cache;
+        
+        while( NULL != plan && plan->signal_length != in_signal_length )
+        {
+          plan = plan->next;
+        }
+        
+        if( NULL == plan )
+        {
+          CPC_LOG (
+                   CPC_LOG_LEVEL_DEBUG,
+                   "Caching new real FFT plan of length %d.",
+                   in_signal_length
+                   );
+          
+          new_plan->next               = csignal_real_fft_plan_cache;
+          csignal_real_fft_plan_cache  = new_plan;
+          
+          plan      = new_plan;
+          new_plan  = NULL;
+        }
+        
+        csignal_unlock_library();
+        
+        if( NULL != new_plan )
+        {
+          csignal_destroy_real_fft_plan( new_plan );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not create real FFT plan: 0x%x.", return_value );
+      }
+    }
+    
+    *out_plan = plan;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_real_FFT (
+                          csignal_real_fft_plan* in_plan,
+                          FLOAT64*               in_signal,
+                          FLOAT64*               out_fft
+                          )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    return_value =
+      csignal_execute_real_FFT_with_scratch (
+                                             in_plan,
+                                             in_plan->complex_plan->scratch,
+                                             in_signal,
+                                             out_fft
+                                             );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_real_IFFT (
+                           csignal_real_fft_plan* in_plan,
+                           FLOAT64*               in_fft,
+                           FLOAT64*               out_signal
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    return_value =
+      csignal_execute_real_IFFT_with_scratch  (
+                                               in_plan,
+                                               in_plan->complex_plan->scratch,
+                                               in_fft,
+                                               out_signal
+                                               );
+  }
+  
+  return( return_value );
+}
+
+USIZE
+csignal_get_real_fft_scratch_length (
+                                     csignal_real_fft_plan* in_plan
+                                     )
+{
+  USIZE length = 0;
+  
+  if( NULL != in_plan )
+  {
+    length = csignal_fft_scratch_length( in_plan->complex_plan );
+  }
+  
+  return( length );
+}
+
+csignal_error_code
+csignal_execute_real_FFT_with_scratch (
+                                       csignal_real_fft_plan* in_plan,
+                                       FLOAT64*               in_scratch,
+                                       FLOAT64*               in_signal,
+                                       FLOAT64*               out_fft
+                                       )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_signal || NULL == out_fft )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), signal (0x%x) or fft (0x%x) are null.",
+               in_plan,
+               in_signal,
+               out_fft
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           NULL == in_scratch
+           && 0 < csignal_fft_scratch_length( in_plan->complex_plan )
+           )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Scratch is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( in_signal != out_fft )
+    {
+      CPC_MEMCPY  (
+                   out_fft,
+                   in_signal,
+                   sizeof( FLOAT64 ) * in_plan->signal_length
+                   );
+    }
+    
+    csignal_fft_plan_transform  (
+                                 in_plan->complex_plan,
+                                 in_scratch,
+                                 out_fft,
+                                 out_fft,
+                                 CALCULATE_FFT
+                                 );
+    
+    csignal_real_fft_split( in_plan, out_fft, CALCULATE_FFT );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_real_IFFT_with_scratch  (
+                                         csignal_real_fft_plan* in_plan,
+                                         FLOAT64*               in_scratch,
+                                         FLOAT64*               in_fft,
+                                         FLOAT64*               out_signal
+                                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_fft || NULL == out_signal )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), fft (0x%x) or signal (0x%x) are null.",
+               in_plan,
+               in_fft,
+               out_signal
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           NULL == in_scratch
+           && 0 < csignal_fft_scratch_length( in_plan->complex_plan )
+           )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Scratch is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_real_fft_merge( in_plan, in_fft, out_signal, CALCULATE_IFFT );
+    
+    csignal_fft_plan_transform  (
+                                 in_plan->complex_plan,
+                                 in_scratch,
+                                 out_signal,
+                                 out_signal,
+                                 CALCULATE_IFFT
+                                 );
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_real_fft_split (
+                        csignal_real_fft_plan* in_plan,
+                        FLOAT64*               io_data,
+                        CHAR                   in_sign
+                        )
+{
+  USIZE m           = in_plan->signal_length / 2;
+  FLOAT64* twiddles = in_plan->twiddles;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  
+  FLOAT64 dc_real = io_data[ 0 ];
+  FLOAT64 dc_imag = io_data[ 1 ];
+  
+  io_data[ 0 ]          = dc_real + dc_imag;
+  io_data[ 1 ]          = 0.0;
+  io_data[ 2 * m ]      = dc_real - dc_imag;
+  io_data[ 2 * m + 1 ]  = 0.0;
+  
+  for( USIZE k = 1; k <= m / 2; k++ )
+  {
+    USIZE j = m - k;
+    
+    FLOAT64 wr = twiddles[ 2 * k ];
+    FLOAT64 wi = sign * twiddles[ 2 * k + 1 ];
+    
+    //  E = ( Z[ k ] + conj( Z[ j ] ) ) / 2, O = ( Z[ k ] - conj( Z[ j ] ) ) / 2i
+    FLOAT64 er = 0.5 * ( io_data[ 2 * k ] + io_data[ 2 * j ] );
+    FLOAT64 ei = 0.5 * ( io_data[ 2 * k + 1 ] - io_data[ 2 * j + 1 ] );
+    FLOAT64 or = 0.5 * ( io_data[ 2 * k + 1 ] + io_data[ 2 * j + 1 ] );
+    FLOAT64 oi = -0.5 * ( io_data[ 2 * k ] - io_data[ 2 * j ] );
+    
+    FLOAT64 tr = wr * or - wi * oi;
+    FLOAT64 ti = wr * oi + wi * or;
+    
+    //  X[ k ] = E + W^k O and X[ M - k ] = conj( E - W^k O )
+    io_data[ 2 * k ]      = er + tr;
+    io_data[ 2 * k + 1 ]  = ei + ti;
+    
+    if( j != k )
+    {
+      io_data[ 2 * j ]      = er - tr;
+      io_data[ 2 * j + 1 ]  = -1.0 * ( ei - ti );
+    }
+  }
+}
+
+void
+csignal_real_fft_merge (
+                        csignal_real_fft_plan* in_plan,
+                        FLOAT64*               in_fft,
+                        FLOAT64*               out_data,
+                        CHAR                   in_sign
+                        )
+{
+  USIZE m           = in_plan->signal_length / 2;
+  FLOAT64* twiddles = in_plan->twiddles;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  
+  FLOAT64 dc      = in_fft[ 0 ];
+  FLOAT64 nyquist = in_fft[ 2 * m ];
+  
+  out_data[ 0 ] = dc + nyquist;
+  out_data[ 1 ] = dc - nyquist;
+  
+  for( USIZE k = 1; k <= m / 2; k++ )
+  {
+    USIZE j = m - k;
+    
+    //  The twiddles are stored for the forward transform, in_sign is the
+    //  direction of this merge so conj( W^k ) of the forward FFT is W^k here.
+    FLOAT64 wr = twiddles[ 2 * k ];
+    FLOAT64 wi = sign * twiddles[ 2 * k + 1 ];
+    
+    FLOAT64 xkr = in_fft[ 2 * k ];
+    FLOAT64 xki = in_fft[ 2 * k + 1 ];
+    FLOAT64 xjr = in_fft[ 2 * j ];
+    FLOAT64 xji = in_fft[ 2 * j + 1 ];
+    
+    FLOAT64 er = xkr + xjr;
+    FLOAT64 ei = xki - xji;
+    FLOAT64 dr = xkr - xjr;
+    FLOAT64 di = xki + xji;
+    
+    FLOAT64 or = dr * wr - di * wi;
+    FLOAT64 oi = dr * wi + di * wr;
+    
+    //  Z[ k ] = E + i O and Z[ M - k ] = conj( E ) + i conj( O )
+    out_data[ 2 * k ]     = er - oi;
+    out_data[ 2 * k + 1 ] = ei + or;
+    
+    if( j != k )
+    {
+      out_data[ 2 * j ]     = er + oi;
+      out_data[ 2 * j + 1 ] = or - ei;
+    }
+  }
+}
+
+csignal_error_code
+csignal_calculate_real_FFT (
+                            USIZE      in_signal_length,
+                            FLOAT64*   in_signal,
+                            USIZE*     out_fft_length,
+                            FLOAT64**  out_fft
+                            )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  USIZE signal_length =
+    ( 2 < in_signal_length )
+    ? csignal_calculate_closest_power_of_two( in_signal_length ) : 2;
+  
+  if  (
+       NULL == in_signal
+       || NULL == out_fft_length
+       || NULL == out_fft
+       )
+  {
+    CPC_ERROR (
+               "Signal (0x%x), fft length (0x%x), or fft (0x%x) are null.",
+               in_signal,
+               out_fft_length,
+               out_fft
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_signal_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Signal length is zero." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if( *out_fft_length != 0 && ( signal_length + 2 ) > *out_fft_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) must be greater or equal to two more than"
+               " the next power of two larger than signal length (%d).",
+               *out_fft_length,
+               signal_length
+               );
+  }
+  else if( *out_fft_length != 0 && NULL == *out_fft )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) is set, but out fft (0x%x) is null.",
+               *out_fft_length,
+               *out_fft
+               );
+  }
+  else
+  {
+    csignal_real_fft_plan* plan = NULL;
+    FLOAT64* scratch            = NULL;
+    
+    *out_fft_length = signal_length + 2;
+    
+    if( NULL == *out_fft )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_fft,
+                         sizeof( FLOAT64 ) * *out_fft_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = csignal_get_real_fft_plan( signal_length, &plan );
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc fft: 0x%x.", return_value );
+    }
+    
+    if  (
+         CPC_ERROR_CODE_NO_ERROR == return_value
+         && 0 < csignal_get_real_fft_scratch_length( plan )
+         )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &scratch,
+                         sizeof( FLOAT64 )
+                         * csignal_get_real_fft_scratch_length( plan )
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      CPC_MEMCPY( *out_fft, in_signal, sizeof( FLOAT64 ) * in_signal_length );
+      CPC_MEMSET  (
+                   *out_fft + in_signal_length,
+                   0x0,
+                   sizeof( FLOAT64 ) * ( *out_fft_length - in_signal_length )
+                   );
+      
+      return_value =
+        csignal_execute_real_FFT_with_scratch (
+                                               plan,
+                                               scratch,
+                                               *out_fft,
+                                               *out_fft
+                                               );
+    }
+    
+    if( NULL != scratch )
+    {
+      cpc_safe_free( ( void** ) &scratch );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_calculate_real_IFFT (
+                             USIZE      in_fft_length,
+                             FLOAT64*   in_fft,
+                             USIZE*     out_signal_length,
+                             FLOAT64**  out_signal
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  USIZE signal_length = ( 2 < in_fft_length ) ? in_fft_length - 2 : 0;
+  
+  if  (
+       NULL == in_fft
+       || NULL == out_signal_length
+       || NULL == out_signal
+       )
+  {
+    CPC_ERROR (
+               "FFT (0x%x), signal length (0x%x), or signal (0x%x) are null.",
+               in_fft,
+               out_signal_length,
+               out_signal
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           2 > signal_length
+           || 0 != ( signal_length & ( signal_length - 1 ) )
+           )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "FFT length (%d) must be two more than a power of two.",
+               in_fft_length
+               );
+  }
+  else if( *out_signal_length != 0 && signal_length > *out_signal_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out signal length (%d) must be greater or equal to %d.",
+               *out_signal_length,
+               signal_length
+               );
+  }
+  else if( *out_signal_length != 0 && NULL == *out_signal )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out signal length (%d) is set, but out signal (0x%x) is null.",
+               *out_signal_length,
+               *out_signal
+               );
+  }
+  else
+  {
+    csignal_real_fft_plan* plan = NULL;
+    FLOAT64* scratch            = NULL;
+    
+    *out_signal_length = signal_length;
+    
+    if( NULL == *out_signal )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_signal,
+                         sizeof( FLOAT64 ) * *out_signal_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = csignal_get_real_fft_plan( signal_length, &plan );
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc signal: 0x%x.", return_value );
+    }
+    
+    if  (
+         CPC_ERROR_CODE_NO_ERROR == return_value
+         && 0 < csignal_get_real_fft_scratch_length( plan )
+         )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &scratch,
+                         sizeof( FLOAT64 )
+                         * csignal_get_real_fft_scratch_length( plan )
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value =
+        csignal_execute_real_IFFT_with_scratch  (
+                                                 plan,
+                                                 scratch,
+                                                 in_fft,
+                                                 *out_signal
+                                                 );
+      
+      for( USIZE i = 0; i < signal_length; i++ )
+      {
+        ( *out_signal )[ i ] /= ( signal_length * 1.0 );
+      }
+    }
+    
+    if( NULL != scratch )
+    {
+      cpc_safe_free( ( void** ) &scratch );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_exact_fft_plan (
+                                   USIZE                    in_fft_length,
+                                   csignal_exact_fft_plan** out_plan
+                                   )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_fft_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "FFT length is zero." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_plan = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_plan, sizeof( csignal_exact_fft_plan ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      USIZE radices[ 5 ] = { 4, 2, 3, 5, 7 };
+      USIZE remainder    = in_fft_length;
+      
+      ( *out_plan )->fft_length         = in_fft_length;
+      ( *out_plan )->algorithm          = CSIGNAL_EXACT_FFT_MIXED_RADIX;
+      ( *out_plan )->number_of_factors  = 0;
+      ( *out_plan )->twiddles           = NULL;
+      ( *out_plan )->complex_plan       = NULL;
+      ( *out_plan )->convolution_length = 0;
+      ( *out_plan )->chirp              = NULL;
+      ( *out_plan )->chirp_fft          = NULL;
+      ( *out_plan )->scratch            = NULL;
+      ( *out_plan )->next               = NULL;
+      
+      for( USIZE i = 0; i < 5; i++ )
+      {
+        while( 0 == ( remainder % radices[ i ] ) )
+        {
+          ( *out_plan )->factors[ ( *out_plan )->number_of_factors++ ] =
+            radices[ i ];
+          
+          remainder /= radices[ i ];
+        }
+      }
+      
+      if( 0 == ( in_fft_length & ( in_fft_length - 1 ) ) )
+      {
+        ( *out_plan )->algorithm = CSIGNAL_EXACT_FFT_POWER_OF_TWO;
+        
+        return_value =
+          csignal_initialize_fft_plan (
+                                       in_fft_length,
+                                       &( ( *out_plan )->complex_plan )
+                                       );
+      }
+      else if( 1 == remainder )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->twiddles ),
+                           sizeof( FLOAT64 ) * 2 * in_fft_length
+                           );
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          return_value =
+            cpc_safe_malloc (
+                             ( void** ) &( ( *out_plan )->scratch ),
+                             sizeof( FLOAT64 ) * 2 * in_fft_length
+                             );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          for( USIZE k = 0; k < in_fft_length; k++ )
+          {
+            FLOAT64 theta =
+              ( CSIGNAL_TWO_PI * k ) / ( in_fft_length * 1.0 );
+            
+            ( *out_plan )->twiddles[ 2 * k ]      = cos( theta );
+            ( *out_plan )->twiddles[ 2 * k + 1 ]  = sin( theta );
+          }
+        }
+      }
+      else
+      {
+        USIZE convolution_length =
+          csignal_calculate_closest_power_of_two( 2 * in_fft_length - 1 );
+        
+        ( *out_plan )->algorithm          = CSIGNAL_EXACT_FFT_BLUESTEIN;
+        ( *out_plan )->number_of_factors  = 0;
+        ( *out_plan )->convolution_length = convolution_length;
+        
+        return_value =
+          csignal_initialize_fft_plan (
+                                       convolution_length,
+                                       &( ( *out_plan )->complex_plan )
+                                       );
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          return_value =
+            cpc_safe_malloc (
+                             ( void** ) &( ( *out_plan )->chirp ),
+                             sizeof( FLOAT64 ) * 2 * in_fft_length
+                             );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          return_value =
+            cpc_safe_malloc (
+                             ( void** ) &( ( *out_plan )->chirp_fft ),
+                             sizeof( FLOAT64 ) * 2 * convolution_length
+                             );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          return_value =
+            cpc_safe_malloc (
+                             ( void** ) &( ( *out_plan )->scratch ),
+                             sizeof( FLOAT64 ) * 2 * convolution_length
+                             );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == return_value )
+        {
+          FLOAT64* chirp      = ( *out_plan )->chirp;
+          FLOAT64* chirp_fft  = ( *out_plan )->chirp_fft;
+          
+          CPC_MEMSET  (
+                       chirp_fft,
+                       0x0,
+                       sizeof( FLOAT64 ) * 2 * convolution_length
+                       );
+          
+          //  k^2 is reduced modulo 2 * fft_length so that theta stays small
+          //  and the chirp stays accurate for long transforms
+          for( USIZE k = 0; k < in_fft_length; k++ )
+          {
+            USIZE k_squared = ( k * k ) % ( 2 * in_fft_length );
+            
+            FLOAT64 theta =
+              ( CSIGNAL_TWO_PI * k_squared ) / ( 2.0 * in_fft_length );
+            
+            chirp[ 2 * k ]      = cos( theta );
+            chirp[ 2 * k + 1 ]  = sin( theta );
+            
+            chirp_fft[ 2 * k ]      = chirp[ 2 * k ] / convolution_length;
+            chirp_fft[ 2 * k + 1 ]  = -1.0 * chirp[ 2 * k + 1 ] / convolution_length;
+            
+            if( 0 < k )
+            {
+              chirp_fft[ 2 * ( convolution_length - k ) ]     =
+                chirp_fft[ 2 * k ];
+              chirp_fft[ 2 * ( convolution_length - k ) + 1 ] =
+                chirp_fft[ 2 * k + 1 ];
+            }
+          }
+          
+          csignal_fft_plan_transform  (
+                                       ( *out_plan )->complex_plan,
+                                       ( *out_plan )->complex_plan->scratch,
+                                       chirp_fft,
+                                       chirp_fft,
+                                       CALCULATE_FFT
+                                       );
+        }
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not create plan tables: 0x%x.", return_value );
+        
+        csignal_destroy_exact_fft_plan( *out_plan );
+        
+        *out_plan = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc plan: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_exact_fft_plan (
+                                csignal_exact_fft_plan* io_plan
+                                )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_plan->complex_plan )
+    {
+      return_value = csignal_destroy_fft_plan( io_plan->complex_plan );
+    }
+    
+    if( NULL != io_plan->twiddles )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->twiddles ) );
+    }
+    
+    if( NULL != io_plan->chirp )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->chirp ) );
+    }
+    
+    if( NULL != io_plan->chirp_fft )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->chirp_fft ) );
+    }
+    
+    if( NULL != io_plan->scratch )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->scratch ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_plan );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_get_exact_fft_plan (
+                            USIZE                    in_fft_length,
+                            csignal_exact_fft_plan** out_plan
+                            )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_exact_fft_plan* plan     = NULL;
+    csignal_exact_fft_plan* new_plan = NULL;
+    
+    csignal_lock_library();
+    
+    plan = csignal_exact_fft_plan_cache;
+    
+    while( NULL != plan && plan->fft_length != in_fft_length )
+    {
+      plan = plan->next;
+    }
+    
+    csignal_unlock_library();
+    
+    //  The plan is created without holding the lock, so another thread may
+    //  have cached a plan of the same length in the meantime, in which case
+    //  the new one is discarded
+    if( NULL == plan )
+    {
+      return_value =
+        csignal_initialize_exact_fft_plan( in_fft_length, &new_plan );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        csignal_lock_library();
+        
+        plan = csignal_exact_fft_plan_cache;
+        
+        while( NULL != plan && plan->fft_length != in_fft_length )
+        {
+          plan = plan->next;
+        }
+        
+        if( NULL == plan )
+        {
+          CPC_LOG (
+                   CPC_LOG_LEVEL_DEBUG,
+                   "Caching new exact FFT plan of length %d.",
+                   in_fft_length
+                   );
+          
+          new_plan->next                = csignal_exact_fft_plan_cache;
+          csignal_exact_fft_plan_cache  = new_plan;
+          
+          plan      = new_plan;
+          new_plan  = NULL;
+        }
+        
+        csignal_unlock_library();
+        
+        if( NULL != new_plan )
+        {
+          csignal_destroy_exact_fft_plan( new_plan );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not create exact FFT plan: 0x%x.", return_value );
+      }
+    }
+    
+    *out_plan = plan;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_exact_FFT (
+                           csignal_exact_fft_plan* in_plan,
+                           FLOAT64*                io_data
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == io_data )
+  {
+    CPC_ERROR( "Plan (0x%x) or data (0x%x) are null.", in_plan, io_data );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_exact_fft_execute( in_plan, io_data, io_data, CALCULATE_FFT );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_exact_IFFT  (
+                             csignal_exact_fft_plan* in_plan,
+                             FLOAT64*                io_data
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == io_data )
+  {
+    CPC_ERROR( "Plan (0x%x) or data (0x%x) are null.", in_plan, io_data );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_exact_fft_execute( in_plan, io_data, io_data, CALCULATE_IFFT );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_exact_FFT_out_of_place (
+                                        csignal_exact_fft_plan* in_plan,
+                                        FLOAT64*                in_data,
+                                        FLOAT64*                out_data
+                                        )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length
+           && out_data < in_data + 2 * in_plan->fft_length
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    csignal_exact_fft_execute( in_plan, in_data, out_data, CALCULATE_FFT );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_exact_IFFT_out_of_place (
+                                         csignal_exact_fft_plan* in_plan,
+                                         FLOAT64*                in_data,
+                                         FLOAT64*                out_data
+                                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length
+           && out_data < in_data + 2 * in_plan->fft_length
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    csignal_exact_fft_execute( in_plan, in_data, out_data, CALCULATE_IFFT );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_calculate_exact_FFT (
+                             USIZE      in_signal_length,
+                             FLOAT64*   in_signal,
+                             USIZE*     out_fft_length,
+                             FLOAT64**  out_fft
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == in_signal
+       || NULL == out_fft_length
+       || NULL == out_fft
+       )
+  {
+    CPC_ERROR (
+               "Signal (0x%x), fft length (0x%x), or fft (0x%x) are null.",
+               in_signal,
+               out_fft_length,
+               out_fft
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_signal_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Signal length is zero." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if( *out_fft_length != 0 && ( 2 * in_signal_length ) > *out_fft_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) must be greater or equal to two times the"
+               " signal length (%d).",
+               *out_fft_length,
+               in_signal_length
+               );
+  }
+  else if( *out_fft_length != 0 && NULL == *out_fft )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) is set, but out fft (0x%x) is null.",
+               *out_fft_length,
+               *out_fft
+               );
+  }
+  else
+  {
+    csignal_exact_fft_plan* plan = NULL;
+    
+    *out_fft_length = 2 * in_signal_length;
+    
+    if( NULL == *out_fft )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_fft,
+                         sizeof( FLOAT64 ) * *out_fft_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = csignal_get_exact_fft_plan( in_signal_length, &plan );
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc fft: 0x%x.", return_value );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      for( USIZE i = 0; i < in_signal_length; i++ )
+      {
+        ( *out_fft )[ 2 * i ]     = in_signal[ i ];
+        ( *out_fft )[ 2 * i + 1 ] = 0.0;
+      }
+      
+      return_value =
+        csignal_exact_fft_calculate (
+                                     plan,
+                                     *out_fft,
+                                     *out_fft,
+                                     CALCULATE_FFT
+                                     );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_chirp_z_plan (
+                                 USIZE                  in_signal_length,
+                                 UINT32                 in_sample_rate,
+                                 FLOAT64                in_start_frequency,
+                                 FLOAT64                in_end_frequency,
+                                 USIZE                  in_number_of_bins,
+                                 csignal_chirp_z_plan** out_plan
+                                 )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           0 == in_signal_length
+           || 0 == in_sample_rate
+           || 0 == in_number_of_bins
+           )
+  {
+    CPC_ERROR (
+               "Signal length (%d), sample rate (%d) or number of bins (%d) is"
+               " zero.",
+               in_signal_length,
+               in_sample_rate,
+               in_number_of_bins
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    USIZE convolution_length =
+      csignal_calculate_closest_power_of_two  (
+                                               in_signal_length
+                                               + in_number_of_bins - 1
+                                               );
+    
+    *out_plan = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_plan, sizeof( csignal_chirp_z_plan ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      ( *out_plan )->signal_length      = in_signal_length;
+      ( *out_plan )->number_of_bins     = in_number_of_bins;
+      ( *out_plan )->convolution_length = convolution_length;
+      ( *out_plan )->complex_plan       = NULL;
+      ( *out_plan )->input_chirp        = NULL;
+      ( *out_plan )->output_chirp       = NULL;
+      ( *out_plan )->chirp_fft          = NULL;
+      ( *out_plan )->scratch            = NULL;
+      
+      return_value =
+        csignal_initialize_fft_plan (
+                                     convolution_length,
+                                     &( ( *out_plan )->complex_plan )
+                                     );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->input_chirp ),
+                           sizeof( FLOAT64 ) * 2 * in_signal_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->output_chirp ),
+                           sizeof( FLOAT64 ) * 2 * in_number_of_bins
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->chirp_fft ),
+                           sizeof( FLOAT64 ) * 2 * convolution_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->scratch ),
+                           sizeof( FLOAT64 ) * 2 * convolution_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        //  The phases are kept in cycles and reduced to [ 0, 1 ) before they
+        //  are scaled, so that long signals do not lose the fraction
+        FLOAT64 start =
+          fmod( in_start_frequency / ( in_sample_rate * 1.0 ), 1.0 );
+        FLOAT64 spacing =
+          ( in_end_frequency - in_start_frequency )
+          / ( ( in_sample_rate * 1.0 ) * ( in_number_of_bins * 1.0 ) );
+        
+        FLOAT64* chirp_fft = ( *out_plan )->chirp_fft;
+        
+        CPC_MEMSET  (
+                     chirp_fft,
+                     0x0,
+                     sizeof( FLOAT64 ) * 2 * convolution_length
+                     );
+        
+        for( USIZE j = 0; j < in_signal_length; j++ )
+        {
+          FLOAT64 square  = 0.5 * ( j * 1.0 ) * ( j * 1.0 );
+          FLOAT64 cycles  =
+            fmod( start * j, 1.0 ) + fmod( spacing * square, 1.0 );
+          
+          ( *out_plan )->input_chirp[ 2 * j ]     =
+            cos( CSIGNAL_TWO_PI * cycles );
+          ( *out_plan )->input_chirp[ 2 * j + 1 ] =
+            sin( CSIGNAL_TWO_PI * cycles );
+          
+          //  conj( w[ -j ] ) wraps around to the end of the convolution
+          if( 0 < j )
+          {
+            cycles = fmod( spacing * square, 1.0 );
+            
+            chirp_fft[ 2 * ( convolution_length - j ) ]     =
+              cos( CSIGNAL_TWO_PI * cycles ) / convolution_length;
+            chirp_fft[ 2 * ( convolution_length - j ) + 1 ] =
+              -1.0 * sin( CSIGNAL_TWO_PI * cycles ) / convolution_length;
+          }
+        }
+        
+        for( USIZE k = 0; k < in_number_of_bins; k++ )
+        {
+          FLOAT64 cycles =
+            fmod( spacing * 0.5 * ( k * 1.0 ) * ( k * 1.0 ), 1.0 );
+          
+          ( *out_plan )->output_chirp[ 2 * k ]      =
+            cos( CSIGNAL_TWO_PI * cycles );
+          ( *out_plan )->output_chirp[ 2 * k + 1 ]  =
+            sin( CSIGNAL_TWO_PI * cycles );
+          
+          chirp_fft[ 2 * k ]      =
+            ( *out_plan )->output_chirp[ 2 * k ] / convolution_length;
+          chirp_fft[ 2 * k + 1 ]  =
+            -1.0 * ( *out_plan )->output_chirp[ 2 * k + 1 ]
+            / convolution_length;
+        }
+        
+        csignal_fft_plan_transform  (
+                                     ( *out_plan )->complex_plan,
+                                     ( *out_plan )->complex_plan->scratch,
+                                     chirp_fft,
+                                     chirp_fft,
+                                     CALCULATE_FFT
+                                     );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not create plan tables: 0x%x.", return_value );
+        
+        csignal_destroy_chirp_z_plan( *out_plan );
+        
+        *out_plan = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc plan: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_chirp_z_plan  (
+                               csignal_chirp_z_plan* io_plan
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_plan->complex_plan )
+    {
+      return_value = csignal_destroy_fft_plan( io_plan->complex_plan );
+    }
+    
+    if( NULL != io_plan->input_chirp )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->input_chirp ) );
+    }
+    
+    if( NULL != io_plan->output_chirp )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->output_chirp ) );
+    }
+    
+    if( NULL != io_plan->chirp_fft )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->chirp_fft ) );
+    }
+    
+    if( NULL != io_plan->scratch )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->scratch ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_plan );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_chirp_z (
+                         csignal_chirp_z_plan* in_plan,
+                         FLOAT64*              in_signal,
+                         FLOAT64*              out_bins
+                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_signal || NULL == out_bins )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), signal (0x%x) or bins (0x%x) are null.",
+               in_plan,
+               in_signal,
+               out_bins
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_chirp_z_transform( in_plan, in_signal, CPC_FALSE, out_bins );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_real_chirp_z  (
+                               csignal_chirp_z_plan* in_plan,
+                               FLOAT64*              in_signal,
+                               FLOAT64*              out_bins
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_signal || NULL == out_bins )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), signal (0x%x) or bins (0x%x) are null.",
+               in_plan,
+               in_signal,
+               out_bins
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_chirp_z_transform( in_plan, in_signal, CPC_TRUE, out_bins );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_calculate_zoom_FFT  (
+                             USIZE      in_signal_length,
+                             FLOAT64*   in_signal,
+                             UINT32     in_sample_rate,
+                             FLOAT64    in_start_frequency,
+                             FLOAT64    in_end_frequency,
+                             USIZE      in_number_of_bins,
+                             USIZE*     out_fft_length,
+                             FLOAT64**  out_fft
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == in_signal
+       || NULL == out_fft_length
+       || NULL == out_fft
+       )
+  {
+    CPC_ERROR (
+               "Signal (0x%x), fft length (0x%x), or fft (0x%x) are null.",
+               in_signal,
+               out_fft_length,
+               out_fft
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( *out_fft_length != 0 && ( 2 * in_number_of_bins ) > *out_fft_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) must be greater or equal to two times the"
+               " number of bins (%d).",
+               *out_fft_length,
+               in_number_of_bins
+               );
+  }
+  else if( *out_fft_length != 0 && NULL == *out_fft )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) is set, but out fft (0x%x) is null.",
+               *out_fft_length,
+               *out_fft
+               );
+  }
+  else
+  {
+    csignal_chirp_z_plan* plan = NULL;
+    
+    return_value =
+      csignal_initialize_chirp_z_plan (
+                                       in_signal_length,
+                                       in_sample_rate,
+                                       in_start_frequency,
+                                       in_end_frequency,
+                                       in_number_of_bins,
+                                       &plan
+                                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      *out_fft_length = 2 * in_number_of_bins;
+      
+      if( NULL == *out_fft )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) out_fft,
+                           sizeof( FLOAT64 ) * *out_fft_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        csignal_chirp_z_transform( plan, in_signal, CPC_TRUE, *out_fft );
+      }
+      else
+      {
+        CPC_ERROR( "Could not malloc fft: 0x%x.", return_value );
+      }
+      
+      csignal_destroy_chirp_z_plan( plan );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_fft_plan_float32 (
+                                     USIZE                      in_fft_length,
+                                     csignal_fft_plan_float32** out_plan
+                                     )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           0 == in_fft_length
+           || 0 != ( in_fft_length & ( in_fft_length - 1 ) )
+           )
+  {
+    CPC_ERROR (
+               "FFT length (%d) must be a non-zero power of two.",
+               in_fft_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_plan = NULL;
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) out_plan,
+                       sizeof( csignal_fft_plan_float32 )
+                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      USIZE number_of_twiddles =
+        1 < in_fft_length ? 3 * in_fft_length / 4 : 1;
+      
+      ( *out_plan )->fft_length   = in_fft_length;
+      ( *out_plan )->bit_reversal = NULL;
+      ( *out_plan )->twiddles     = NULL;
+      ( *out_plan )->next         = NULL;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( ( *out_plan )->bit_reversal ),
+                         sizeof( USIZE ) * in_fft_length
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( ( *out_plan )->twiddles ),
+                           sizeof( FLOAT32 ) * 2 * number_of_twiddles
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        csignal_calculate_bit_reversal  (
+                                         in_fft_length,
+                                         ( *out_plan )->bit_reversal
+                                         );
+        
+        ( *out_plan )->twiddles[ 0 ] = 1.0f;
+        ( *out_plan )->twiddles[ 1 ] = 0.0f;
+        
+        //  Calculated in FLOAT64 so that each twiddle factor is the correctly
+        //  rounded value
+        for( USIZE k = 1; k < number_of_twiddles; k++ )
+        {
+          FLOAT64 theta =
+            ( CSIGNAL_TWO_PI * k ) / ( in_fft_length * 1.0 );
+          
+          ( *out_plan )->twiddles[ 2 * k ]      = ( FLOAT32 ) cos( theta );
+          ( *out_plan )->twiddles[ 2 * k + 1 ]  = ( FLOAT32 ) sin( theta );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not malloc plan tables: 0x%x.", return_value );
+        
+        csignal_destroy_fft_plan_float32( *out_plan );
+        
+        *out_plan = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc plan: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_fft_plan_float32  (
+                                   csignal_fft_plan_float32* io_plan
+                                   )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_plan->bit_reversal )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->bit_reversal ) );
+    }
+    
+    if( NULL != io_plan->twiddles )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_plan->twiddles ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_plan );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_get_fft_plan_float32  (
+                               USIZE                      in_fft_length,
+                               csignal_fft_plan_float32** out_plan
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_plan )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Plan is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_fft_plan_float32* plan     = NULL;
+    csignal_fft_plan_float32* new_plan = NULL;
+    
+    csignal_lock_library();
+    
+    plan = csignal_fft_plan_float32_cache;
+    
+    while( NULL != plan && plan->fft_length != in_fft_length )
+    {
+      plan = plan->next;
+    }
+    
+    csignal_unlock_library();
+    
+    //  The plan is created without holding the lock, so another thread may
+    //  have cached a plan of the same length in the meantime, in which case
+    //  the new one is discarded
+    if( NULL == plan )
+    {
+      return_value =
+        csignal_initialize_fft_plan_float32( in_fft_length, &new_plan );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        csignal_lock_library();
+        
+        plan = csignal_fft_plan_float32_cache;
+        
+        while( NULL != plan && plan->fft_length != in_fft_length )
+        {
+          plan = plan->next;
+        }
+        
+        if( NULL == plan )
+        {
+          CPC_LOG (
+                   CPC_LOG_LEVEL_DEBUG,
+                   "Caching new FLOAT32 FFT plan of length %d.",
+                   in_fft_length
+                   );
+          
+          new_plan->next                  = csignal_fft_plan_float32_cache;
+          csignal_fft_plan_float32_cache  = new_plan;
+          
+          plan      = new_plan;
+          new_plan  = NULL;
+        }
+        
+        csignal_unlock_library();
+        
+        if( NULL != new_plan )
+        {
+          csignal_destroy_fft_plan_float32( new_plan );
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not create FFT plan: 0x%x.", return_value );
+      }
+    }
+    
+    *out_plan = plan;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_FFT_float32 (
+                             csignal_fft_plan_float32* in_plan,
+                             FLOAT32*                  io_data
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == io_data )
+  {
+    CPC_ERROR( "Plan (0x%x) or data (0x%x) are null.", in_plan, io_data );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_fft_run_kernel_float32( in_plan, io_data, CALCULATE_FFT );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_IFFT_float32  (
+                               csignal_fft_plan_float32* in_plan,
+                               FLOAT32*                  io_data
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == io_data )
+  {
+    CPC_ERROR( "Plan (0x%x) or data (0x%x) are null.", in_plan, io_data );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    csignal_fft_run_kernel_float32( in_plan, io_data, CALCULATE_IFFT );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_FFT_out_of_place_float32  (
+                                           csignal_fft_plan_float32* in_plan,
+                                           FLOAT32*                  in_data,
+                                           FLOAT32*                  out_data
+                                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length
+           && out_data < in_data + 2 * in_plan->fft_length
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    csignal_fft_run_kernel_out_of_place_float32 (
+                                                 in_plan,
+                                                 in_data,
+                                                 out_data,
+                                                 CALCULATE_FFT
+                                                 );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_execute_IFFT_out_of_place_float32 (
+                                           csignal_fft_plan_float32* in_plan,
+                                           FLOAT32*                  in_data,
+                                           FLOAT32*                  out_data
+                                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_plan || NULL == in_data || NULL == out_data )
+  {
+    CPC_ERROR (
+               "Plan (0x%x), in data (0x%x) or out data (0x%x) are null.",
+               in_plan,
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_data != out_data
+           && in_data < out_data + 2 * in_plan->fft_length
+           && out_data < in_data + 2 * in_plan->fft_length
+           )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    csignal_fft_run_kernel_out_of_place_float32 (
+                                                 in_plan,
+                                                 in_data,
+                                                 out_data,
+                                                 CALCULATE_IFFT
+                                                 );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_calculate_FFT_float32 (
+                               USIZE      in_signal_length,
+                               FLOAT32*   in_signal,
+                               USIZE*     out_fft_length,
+                               FLOAT32**  out_fft
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == in_signal
+       || NULL == out_fft_length
+       || NULL == out_fft
+       )
+  {
+    CPC_ERROR (
+               "Signal (0x%x), fft length (0x%x), or fft (0x%x) are null.",
+               in_signal,
+               out_fft_length,
+               out_fft
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           *out_fft_length != 0
+           && (
+               csignal_calculate_closest_power_of_two( in_signal_length ) * 2
+               ) > *out_fft_length
+           )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) must be greater or equal to the length of"
+               " twice the next power of two larger than signal length (%d).",
+               *out_fft_length,
+               csignal_calculate_closest_power_of_two( in_signal_length )
+               );
+  }
+  else if( *out_fft_length != 0 && NULL == *out_fft )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out fft length (%d) is set, but out fft (0x%x) is null.",
+               *out_fft_length,
+               *out_fft
+               );
+  }
+  else
+  {
+    csignal_fft_plan_float32* plan = NULL;
+    
+    USIZE fft_points =
+      csignal_calculate_closest_power_of_two( in_signal_length );
+    
+    *out_fft_length = fft_points * 2;
+    
+    if( NULL == *out_fft )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_fft,
+                         sizeof( FLOAT32 ) * *out_fft_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = csignal_get_fft_plan_float32( fft_points, &plan );
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc fft: 0x%x.", return_value );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      for( USIZE i = 0; i < fft_points; i++ )
+      {
+        ( *out_fft )[ 2 * i ]     =
+          ( i < in_signal_length ? in_signal[ i ] : 0.0f );
+        ( *out_fft )[ 2 * i + 1 ] = 0.0f;
+      }
+      
+      csignal_fft_run_kernel_float32( plan, *out_fft, CALCULATE_FFT );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_calculate_complex_IFFT_float32  (
+                                         USIZE      in_fft_length,
+                                         FLOAT32*   in_fft,
+                                         USIZE*     out_signal_length,
+                                         FLOAT32**  out_signal
+                                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == in_fft
+       || NULL == out_signal_length
+       || NULL == out_signal
+       )
+  {
+    CPC_ERROR (
+               "FFT (0x%x), signal length (0x%x), or signal (0x%x) are null.",
+               in_fft,
+               out_signal_length,
+               out_signal
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           2 > in_fft_length
+           || 0 != ( in_fft_length & ( in_fft_length - 1 ) )
+           )
+  {
+    CPC_ERROR (
+               "FFT length (%d) must be twice a non-zero power of two.",
+               in_fft_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if( *out_signal_length != 0 && in_fft_length > *out_signal_length )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out signal length (%d) must be greater or equal to the fft"
+               " length (%d).",
+               *out_signal_length,
+               in_fft_length
+               );
+  }
+  else if( *out_signal_length != 0 && NULL == *out_signal )
+  {
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+    
+    CPC_ERROR (
+               "Out signal length (%d) is set, but out signal (0x%x) is null.",
+               *out_signal_length,
+               *out_signal
+               );
+  }
+  else
+  {
+    csignal_fft_plan_float32* plan = NULL;
+    
+    USIZE number_of_bins = in_fft_length / 2;
+    
+    *out_signal_length = in_fft_length;
+    
+    if( NULL == *out_signal )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) out_signal,
+                         sizeof( FLOAT32 ) * *out_signal_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = csignal_get_fft_plan_float32( number_of_bins, &plan );
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc signal: 0x%x.", return_value );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      FLOAT32 scale = 1.0f / ( number_of_bins * 1.0f );
+      
+      csignal_fft_run_kernel_out_of_place_float32 (
+                                                   plan,
+                                                   in_fft,
+                                                   *out_signal,
+                                                   CALCULATE_IFFT
+                                                   );
+      
+      for( USIZE i = 0; i < in_fft_length; i++ )
+      {
+        ( *out_signal )[ i ] *= scale;
+      }
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_fft (
+             FLOAT64* io_data,
+             USIZE    in_data_length,
+             CHAR     in_sign
+             )
+{
+  csignal_fft_plan* plan  = NULL;
+  FLOAT64* scratch        = NULL;
+  
+  csignal_error_code return_value =
+    csignal_get_fft_plan( in_data_length, &plan );
+  
+  if  (
+       CPC_ERROR_CODE_NO_ERROR == return_value
+       && 0 < csignal_fft_scratch_length( plan )
+       )
+  {
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) &scratch,
+                       sizeof( FLOAT64 ) * csignal_fft_scratch_length( plan )
+                       );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value )
+  {
+    csignal_fft_plan_transform( plan, scratch, io_data, io_data, in_sign );
+    
+    if( NULL != scratch )
+    {
+      cpc_safe_free( ( void** ) &scratch );
+    }
+  }
+  else
+  {
+    CPC_ERROR( "Could not calculate FFT: 0x%x.", return_value );
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_calculate_bit_reversal  (
+                                 USIZE  in_fft_length,
+                                 USIZE* out_bit_reversal
+                                 )
+{
+  USIZE number_of_bits = 0;
+  
+  while( ( ( USIZE ) 1 << number_of_bits ) < in_fft_length )
+  {
+    number_of_bits++;
+  }
+  
+  for( USIZE i = 0; i < in_fft_length; i++ )
+  {
+    USIZE reversed = 0;
+    
+    for( USIZE bit = 0; bit < number_of_bits; bit++ )
+    {
+      reversed |= ( ( i >> bit ) & 0x1 ) << ( number_of_bits - 1 - bit );
+    }
+    
+    out_bit_reversal[ i ] = reversed;
+  }
+}
+
+void
+csignal_fft_plan_transform (
+                            csignal_fft_plan* in_plan,
+                            FLOAT64*          in_scratch,
+                            FLOAT64*          in_data,
+                            FLOAT64*          out_data,
+                            CHAR              in_sign
+                            )
+{
+  csignal_fft_plan_execute  (
+                             in_plan,
+                             csignal_get_thread_pool(),
+                             in_scratch,
+                             in_data,
+                             out_data,
+                             in_sign
+                             );
+}
+
+void
+csignal_fft_plan_execute  (
+                           csignal_fft_plan*    in_plan,
+                           csignal_thread_pool* in_pool,
+                           FLOAT64*             in_scratch,
+                           FLOAT64*             in_data,
+                           FLOAT64*             out_data,
+                           CHAR                 in_sign
+                           )
+{
+  if( NULL != in_plan->row_plan )
+  {
+    csignal_six_step_fft  (
+                           in_plan,
+                           in_pool,
+                           in_scratch,
+                           in_data,
+                           out_data,
+                           in_sign
+                           );
+  }
+  else if( in_data == out_data )
+  {
+    csignal_fft_run_kernel( in_plan, out_data, in_sign );
+  }
+  else
+  {
+    csignal_fft_run_kernel_out_of_place( in_plan, in_data, out_data, in_sign );
+  }
+}
+
+USIZE
+csignal_fft_scratch_length  (
+                             csignal_fft_plan* in_plan
+                             )
+{
+  return( ( NULL != in_plan->row_plan ) ? 2 * in_plan->fft_length : 0 );
+}
+
+void
+csignal_six_step_fft  (
+                       csignal_fft_plan*    in_plan,
+                       csignal_thread_pool* in_pool,
+                       FLOAT64*             in_scratch,
+                       FLOAT64*             in_data,
+                       FLOAT64*             out_data,
+                       CHAR                 in_sign
+                       )
+{
+  USIZE columns = in_plan->column_plan->fft_length;
+  USIZE rows    = in_plan->row_plan->fft_length;
+  
+  csignal_six_step_job job;
+  
+  job.plan                = in_plan;
+  job.sign                = in_sign;
+  job.twiddle_block_size  = 1;
+  
+  while( job.twiddle_block_size * job.twiddle_block_size < columns )
+  {
+    job.twiddle_block_size <<= 1;
+  }
+  
+  //  x[ N2 * n1 + n2 ] (N1 x N2) -> scratch[ N1 * n2 + n1 ] (N2 x N1)
+  job.source            = in_data;
+  job.destination       = in_scratch;
+  job.number_of_rows    = columns;
+  job.number_of_columns = rows;
+  
+  csignal_thread_pool_run (
+                           in_pool,
+                           ( columns + CSIGNAL_SIX_STEP_TILE_SIZE - 1 )
+                           / CSIGNAL_SIX_STEP_TILE_SIZE,
+                           csignal_six_step_transpose_task,
+                           &job
+                           );
+  
+  //  N2 FFTs of N1 points, each multiplied by W_N^( n2 * k1 )
+  job.number_of_rows    = rows;
+  job.number_of_columns = columns;
+  
+  csignal_thread_pool_run (
+                           in_pool,
+                           rows,
+                           csignal_six_step_column_task,
+                           &job
+                           );
+  
+  //  scratch (N2 x N1) -> out_data[ N2 * k1 + n2 ] (N1 x N2)
+  job.source            = in_scratch;
+  job.destination       = out_data;
+  
+  csignal_thread_pool_run (
+                           in_pool,
+                           ( rows + CSIGNAL_SIX_STEP_TILE_SIZE - 1 )
+                           / CSIGNAL_SIX_STEP_TILE_SIZE,
+                           csignal_six_step_transpose_task,
+                           &job
+                           );
+  
+  //  N1 FFTs of N2 points
+  job.number_of_rows    = columns;
+  job.number_of_columns = rows;
+  
+  csignal_thread_pool_run (
+                           in_pool,
+                           columns,
+                           csignal_six_step_row_task,
+                           &job
+                           );
+  
+  //  out_data[ N2 * k1 + k2 ] (N1 x N2) -> X[ k1 + N1 * k2 ]
+  job.source            = out_data;
+  job.destination       = in_scratch;
+  
+  csignal_thread_pool_run (
+                           in_pool,
+                           ( columns + CSIGNAL_SIX_STEP_TILE_SIZE - 1 )
+                           / CSIGNAL_SIX_STEP_TILE_SIZE,
+                           csignal_six_step_transpose_task,
+                           &job
+                           );
+  
+  CPC_MEMCPY  (
+               out_data,
+               in_scratch,
+               sizeof( FLOAT64 ) * 2 * in_plan->fft_length
+               );
+}
+
+void
+csignal_six_step_transpose_task (
+                                 void* in_job,
+                                 USIZE in_index
+                                 )
+{
+  csignal_six_step_job* job = ( csignal_six_step_job* ) in_job;
+  
+  USIZE rows        = job->number_of_rows;
+  USIZE columns     = job->number_of_columns;
+  USIZE first_row   = in_index * CSIGNAL_SIX_STEP_TILE_SIZE;
+  USIZE last_row    =
+    CPC_MIN( USIZE, first_row + CSIGNAL_SIX_STEP_TILE_SIZE, rows );
+  
+  for( USIZE c = 0; c < columns; c += CSIGNAL_SIX_STEP_TILE_SIZE )
+  {
+    USIZE last_column =
+      CPC_MIN( USIZE, c + CSIGNAL_SIX_STEP_TILE_SIZE, columns );
+    
+    for( USIZE i = first_row; i < last_row; i++ )
+    {
+      FLOAT64* source = job->source + 2 * i * columns;
+      
+      for( USIZE j = c; j < last_column; j++ )
+      {
+        job->destination[ 2 * ( j * rows + i ) ]      = source[ 2 * j ];
+        job->destination[ 2 * ( j * rows + i ) + 1 ]  = source[ 2 * j + 1 ];
+      }
+    }
+  }
+}
+
+void
+csignal_six_step_column_task  (
+                               void* in_job,
+                               USIZE in_index
+                               )
+{
+  csignal_six_step_job* job = ( csignal_six_step_job* ) in_job;
+  
+  USIZE columns = job->number_of_columns;
+  FLOAT64* row  = job->destination + 2 * in_index * columns;
+  
+  //  The tasks already run on the pool's threads, so the sub-FFTs are never
+  //  spread over the pool again. They are far shorter than
+  //  CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH, so they need no scratch either.
+  csignal_fft_plan_execute  (
+                             job->plan->column_plan,
+                             NULL,
+                             NULL,
+                             row,
+                             row,
+                             job->sign
+                             );
+  
+  for( USIZE k = 0; 0 < in_index && k < columns; k += job->twiddle_block_size )
+  {
+    FLOAT64 hr = 0.0;
+    FLOAT64 hi = 0.0;
+    
+    csignal_six_step_twiddle( job->plan, in_index * k, job->sign, &hr, &hi );
+    
+    for( USIZE l = 0; l < job->twiddle_block_size; l++ )
+    {
+      FLOAT64 lr = 0.0;
+      FLOAT64 li = 0.0;
+      
+      csignal_six_step_twiddle( job->plan, in_index * l, job->sign, &lr, &li );
+      
+      FLOAT64 wr = hr * lr - hi * li;
+      FLOAT64 wi = hr * li + hi * lr;
+      FLOAT64 xr = row[ 2 * ( k + l ) ];
+      FLOAT64 xi = row[ 2 * ( k + l ) + 1 ];
+      
+      row[ 2 * ( k + l ) ]      = xr * wr - xi * wi;
+      row[ 2 * ( k + l ) + 1 ]  = xr * wi + xi * wr;
+    }
+  }
+}
+
+void
+csignal_six_step_row_task (
+                           void* in_job,
+                           USIZE in_index
+                           )
+{
+  csignal_six_step_job* job = ( csignal_six_step_job* ) in_job;
+  
+  FLOAT64* row = job->destination + 2 * in_index * job->number_of_columns;
+  
+  csignal_fft_plan_execute  (
+                             job->plan->row_plan,
+                             NULL,
+                             NULL,
+                             row,
+                             row,
+                             job->sign
+                             );
+}
+
+void
+csignal_six_step_twiddle  (
+                           csignal_fft_plan* in_plan,
+                           USIZE             in_exponent,
+                           CHAR              in_sign,
+                           FLOAT64*          out_real,
+                           FLOAT64*          out_imaginary
+                           )
+{
+  USIZE half      = in_plan->fft_length / 2;
+  USIZE exponent  = in_exponent & ( in_plan->fft_length - 1 );
+  FLOAT64 scale   = 1.0;
+  
+  if( exponent >= half )
+  {
+    exponent  -= half;
+    scale     = -1.0;
+  }
+  
+  *out_real       = scale * in_plan->twiddles[ 2 * exponent ];
+  *out_imaginary  = scale * in_sign * in_plan->twiddles[ 2 * exponent + 1 ];
+}
+
+void
+csignal_real_fft_full_spectrum  (
+                                 csignal_real_fft_plan* in_plan,
+                                 FLOAT64*               in_scratch,
+                                 USIZE                  in_signal_length,
+                                 FLOAT64*               in_signal,
+                                 FLOAT64*               out_fft
+                                 )
+{
+  USIZE fft_points = in_plan->signal_length;
+  
+  CPC_MEMCPY( out_fft, in_signal, sizeof( FLOAT64 ) * in_signal_length );
+  CPC_MEMSET  (
+               out_fft + in_signal_length,
+               0x0,
+               sizeof( FLOAT64 ) * ( fft_points + 2 - in_signal_length )
+               );
+  
+  csignal_execute_real_FFT_with_scratch (
+                                         in_plan,
+                                         in_scratch,
+                                         out_fft,
+                                         out_fft
+                                         );
+  
+  for( USIZE k = fft_points / 2 + 1; k < fft_points; k++ )
+  {
+    out_fft[ 2 * k ]      = out_fft[ 2 * ( fft_points - k ) ];
+    out_fft[ 2 * k + 1 ]  = -1.0 * out_fft[ 2 * ( fft_points - k ) + 1 ];
+  }
+}
+
+void
+csignal_exact_fft_transform (
+                             csignal_exact_fft_plan* in_plan,
+                             FLOAT64*                in_scratch,
+                             FLOAT64*                in_fft_scratch,
+                             FLOAT64*                in_data,
+                             FLOAT64*                out_data,
+                             CHAR                    in_sign
+                             )
+{
+  switch( in_plan->algorithm )
+  {
+    case CSIGNAL_EXACT_FFT_POWER_OF_TWO:
+      csignal_fft_plan_transform  (
+                                   in_plan->complex_plan,
+                                   in_fft_scratch,
+                                   in_data,
+                                   out_data,
+                                   in_sign
+                                   );
+      break;
+    case CSIGNAL_EXACT_FFT_MIXED_RADIX:
+      {
+        FLOAT64* source = in_data;
+        USIZE stride    = 1;
         
-        data[j]=data[i]-tempr;
-        data[j+1]=data[i+1]-tempi;
+        //  The passes alternate between out_data and scratch, the first
+        //  destination is chosen so that the last pass writes to out_data
+        //  unless the transform is in place and has an odd number of passes.
+        for( USIZE i = 0; i < in_plan->number_of_factors; i++ )
+        {
+          FLOAT64* destination = out_data;
+          
+          if  (
+               source == out_data
+               || ( 0 == i && 0 == ( in_plan->number_of_factors % 2 ) )
+               )
+          {
+            destination = in_scratch;
+          }
+          
+          csignal_mixed_radix_pass  (
+                                     in_plan,
+                                     source,
+                                     destination,
+                                     stride,
+                                     in_plan->factors[ i ],
+                                     in_sign
+                                     );
+          
+          stride *= in_plan->factors[ i ];
+          source = destination;
+        }
         
-        data[i] += tempr;
-        data[i+1] += tempi;
+        if( source != out_data )
+        {
+          CPC_MEMCPY  (
+                       out_data,
+                       source,
+                       sizeof( FLOAT64 ) * 2 * in_plan->fft_length
+                       );
+        }
       }
-      wr=(wtemp=wr)*wpr-wi*wpi+wr;
-      wi=wi*wpr+wtemp*wpi+wi;
+      break;
+    case CSIGNAL_EXACT_FFT_BLUESTEIN:
+      csignal_bluestein_fft (
+                             in_plan,
+                             in_scratch,
+                             in_fft_scratch,
+                             in_data,
+                             out_data,
+                             in_sign
+                             );
+      break;
+    default:
+      break;
+  }
+}
+
+void
+csignal_mixed_radix_pass  (
+                           csignal_exact_fft_plan* in_plan,
+                           FLOAT64*                in_data,
+                           FLOAT64*                out_data,
+                           USIZE                   in_stride,
+                           USIZE                   in_radix,
+                           CHAR                    in_sign
+                           )
+{
+  USIZE n           = in_plan->fft_length;
+  USIZE m           = n / ( in_stride * in_radix );
+  USIZE s           = in_stride;
+  FLOAT64* twiddles = in_plan->twiddles;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  
+  //  cos( 2 pi / 5 ), cos( 4 pi / 5 ), sin( 2 pi / 5 ), sin( 4 pi / 5 ) and
+  //  sin( 2 pi / 3 ) with the sign of the transform applied to the sines
+  FLOAT64 c51 = 0.30901699437494742410;
+  FLOAT64 c52 = -0.80901699437494742410;
+  FLOAT64 s51 = sign * 0.95105651629515357212;
+  FLOAT64 s52 = sign * 0.58778525229247312917;
+  FLOAT64 s3  = sign * 0.86602540378443864676;
+  
+  //  Input r of butterfly ( j, q ) is at q + s( j + r * m ) and output k is at
+  //  q + s( p * j + k ). The twiddle factor of output k is W_n^( j * k ) =
+  //  W_N^( j * k * s ), j * k * s < N.
+  for( USIZE j = 0; j < m; j++ )
+  {
+    FLOAT64* x  = in_data + 2 * s * j;
+    FLOAT64* y  = out_data + 2 * s * in_radix * j;
+    USIZE xs    = 2 * s * m;
+    USIZE ys    = 2 * s;
+    
+    FLOAT64 w1r = twiddles[ 2 * j * s ];
+    FLOAT64 w1i = sign * twiddles[ 2 * j * s + 1 ];
+    
+    switch( in_radix )
+    {
+      case 2:
+        for( USIZE q = 0; q < 2 * s; q += 2 )
+        {
+          FLOAT64 dr = x[ q ] - x[ xs + q ];
+          FLOAT64 di = x[ q + 1 ] - x[ xs + q + 1 ];
+          
+          y[ q ]          = x[ q ] + x[ xs + q ];
+          y[ q + 1 ]      = x[ q + 1 ] + x[ xs + q + 1 ];
+          y[ ys + q ]     = dr * w1r - di * w1i;
+          y[ ys + q + 1 ] = dr * w1i + di * w1r;
+        }
+        break;
+      case 3:
+        {
+          FLOAT64 w2r = twiddles[ 4 * j * s ];
+          FLOAT64 w2i = sign * twiddles[ 4 * j * s + 1 ];
+          
+          for( USIZE q = 0; q < 2 * s; q += 2 )
+          {
+            FLOAT64 a0r = x[ q ];
+            FLOAT64 a0i = x[ q + 1 ];
+            FLOAT64 a1r = x[ xs + q ];
+            FLOAT64 a1i = x[ xs + q + 1 ];
+            FLOAT64 a2r = x[ 2 * xs + q ];
+            FLOAT64 a2i = x[ 2 * xs + q + 1 ];
+            
+            FLOAT64 tr  = a1r + a2r;
+            FLOAT64 ti  = a1i + a2i;
+            FLOAT64 hr  = a0r - 0.5 * tr;
+            FLOAT64 hi  = a0i - 0.5 * ti;
+            FLOAT64 dr  = s3 * ( a1r - a2r );
+            FLOAT64 di  = s3 * ( a1i - a2i );
+            
+            //  y1 = h + i d, y2 = h - i d
+            FLOAT64 y1r = hr - di;
+            FLOAT64 y1i = hi + dr;
+            FLOAT64 y2r = hr + di;
+            FLOAT64 y2i = hi - dr;
+            
+            y[ q ]              = a0r + tr;
+            y[ q + 1 ]          = a0i + ti;
+            y[ ys + q ]         = y1r * w1r - y1i * w1i;
+            y[ ys + q + 1 ]     = y1r * w1i + y1i * w1r;
+            y[ 2 * ys + q ]     = y2r * w2r - y2i * w2i;
+            y[ 2 * ys + q + 1 ] = y2r * w2i + y2i * w2r;
+          }
+        }
+        break;
+      case 4:
+        {
+          FLOAT64 w2r = twiddles[ 4 * j * s ];
+          FLOAT64 w2i = sign * twiddles[ 4 * j * s + 1 ];
+          FLOAT64 w3r = twiddles[ 6 * j * s ];
+          FLOAT64 w3i = sign * twiddles[ 6 * j * s + 1 ];
+          
+          for( USIZE q = 0; q < 2 * s; q += 2 )
+          {
+            FLOAT64 a0r = x[ q ];
+            FLOAT64 a0i = x[ q + 1 ];
+            FLOAT64 a1r = x[ xs + q ];
+            FLOAT64 a1i = x[ xs + q + 1 ];
+            FLOAT64 a2r = x[ 2 * xs + q ];
+            FLOAT64 a2i = x[ 2 * xs + q + 1 ];
+            FLOAT64 a3r = x[ 3 * xs + q ];
+            FLOAT64 a3i = x[ 3 * xs + q + 1 ];
+            
+            FLOAT64 u0r = a0r + a2r;
+            FLOAT64 u0i = a0i + a2i;
+            FLOAT64 u1r = a0r - a2r;
+            FLOAT64 u1i = a0i - a2i;
+            FLOAT64 u2r = a1r + a3r;
+            FLOAT64 u2i = a1i + a3i;
+            
+            //  u3 = W_4 * ( a1 - a3 ) where W_4 = sign * i
+            FLOAT64 u3r = -1.0 * sign * ( a1i - a3i );
+            FLOAT64 u3i = sign * ( a1r - a3r );
+            
+            FLOAT64 y1r = u1r + u3r;
+            FLOAT64 y1i = u1i + u3i;
+            FLOAT64 y2r = u0r - u2r;
+            FLOAT64 y2i = u0i - u2i;
+            FLOAT64 y3r = u1r - u3r;
+            FLOAT64 y3i = u1i - u3i;
+            
+            y[ q ]              = u0r + u2r;
+            y[ q + 1 ]          = u0i + u2i;
+            y[ ys + q ]         = y1r * w1r - y1i * w1i;
+            y[ ys + q + 1 ]     = y1r * w1i + y1i * w1r;
+            y[ 2 * ys + q ]     = y2r * w2r - y2i * w2i;
+            y[ 2 * ys + q + 1 ] = y2r * w2i + y2i * w2r;
+            y[ 3 * ys + q ]     = y3r * w3r - y3i * w3i;
+            y[ 3 * ys + q + 1 ] = y3r * w3i + y3i * w3r;
+          }
+        }
+        break;
+      case 5:
+        {
+          FLOAT64 w2r = twiddles[ 4 * j * s ];
+          FLOAT64 w2i = sign * twiddles[ 4 * j * s + 1 ];
+          FLOAT64 w3r = twiddles[ 6 * j * s ];
+          FLOAT64 w3i = sign * twiddles[ 6 * j * s + 1 ];
+          FLOAT64 w4r = twiddles[ 8 * j * s ];
+          FLOAT64 w4i = sign * twiddles[ 8 * j * s + 1 ];
+          
+          for( USIZE q = 0; q < 2 * s; q += 2 )
+          {
+            FLOAT64 a0r = x[ q ];
+            FLOAT64 a0i = x[ q + 1 ];
+            
+            FLOAT64 b1r = x[ xs + q ] + x[ 4 * xs + q ];
+            FLOAT64 b1i = x[ xs + q + 1 ] + x[ 4 * xs + q + 1 ];
+            FLOAT64 b2r = x[ 2 * xs + q ] + x[ 3 * xs + q ];
+            FLOAT64 b2i = x[ 2 * xs + q + 1 ] + x[ 3 * xs + q + 1 ];
+            FLOAT64 d1r = x[ xs + q ] - x[ 4 * xs + q ];
+            FLOAT64 d1i = x[ xs + q + 1 ] - x[ 4 * xs + q + 1 ];
+            FLOAT64 d2r = x[ 2 * xs + q ] - x[ 3 * xs + q ];
+            FLOAT64 d2i = x[ 2 * xs + q + 1 ] - x[ 3 * xs + q + 1 ];
+            
+            FLOAT64 r1r = a0r + c51 * b1r + c52 * b2r;
+            FLOAT64 r1i = a0i + c51 * b1i + c52 * b2i;
+            FLOAT64 r2r = a0r + c52 * b1r + c51 * b2r;
+            FLOAT64 r2i = a0i + c52 * b1i + c51 * b2i;
+            
+            //  e1 and e2 are multiplied by i when added to r1 and r2
+            FLOAT64 e1r = s51 * d1r + s52 * d2r;
+            FLOAT64 e1i = s51 * d1i + s52 * d2i;
+            FLOAT64 e2r = s52 * d1r - s51 * d2r;
+            FLOAT64 e2i = s52 * d1i - s51 * d2i;
+            
+            FLOAT64 y1r = r1r - e1i;
+            FLOAT64 y1i = r1i + e1r;
+            FLOAT64 y2r = r2r - e2i;
+            FLOAT64 y2i = r2i + e2r;
+            FLOAT64 y3r = r2r + e2i;
+            FLOAT64 y3i = r2i - e2r;
+            FLOAT64 y4r = r1r + e1i;
+            FLOAT64 y4i = r1i - e1r;
+            
+            y[ q ]              = a0r + b1r + b2r;
+            y[ q + 1 ]          = a0i + b1i + b2i;
+            y[ ys + q ]         = y1r * w1r - y1i * w1i;
+            y[ ys + q + 1 ]     = y1r * w1i + y1i * w1r;
+            y[ 2 * ys + q ]     = y2r * w2r - y2i * w2i;
+            y[ 2 * ys + q + 1 ] = y2r * w2i + y2i * w2r;
+            y[ 3 * ys + q ]     = y3r * w3r - y3i * w3i;
+            y[ 3 * ys + q + 1 ] = y3r * w3i + y3i * w3r;
+            y[ 4 * ys + q ]     = y4r * w4r - y4i * w4i;
+            y[ 4 * ys + q + 1 ] = y4r * w4i + y4i * w4r;
+          }
+        }
+        break;
+      default:
+        //  The remaining radix (7) uses a direct DFT with W_p^( r * k ) =
+        //  W_N^( ( r * k mod p ) * N / p ).
+        for( USIZE q = 0; q < 2 * s; q += 2 )
+        {
+          for( USIZE k = 0; k < in_radix; k++ )
+          {
+            FLOAT64 yr  = 0.0;
+            FLOAT64 yi  = 0.0;
+            FLOAT64 wr  = twiddles[ 2 * j * k * s ];
+            FLOAT64 wi  = sign * twiddles[ 2 * j * k * s + 1 ];
+            
+            for( USIZE r = 0; r < in_radix; r++ )
+            {
+              USIZE index = ( ( r * k ) % in_radix ) * ( n / in_radix );
+              
+              FLOAT64 cr = twiddles[ 2 * index ];
+              FLOAT64 ci = sign * twiddles[ 2 * index + 1 ];
+              FLOAT64 ar = x[ r * xs + q ];
+              FLOAT64 ai = x[ r * xs + q + 1 ];
+              
+              yr += ar * cr - ai * ci;
+              yi += ar * ci + ai * cr;
+            }
+            
+            y[ k * ys + q ]     = yr * wr - yi * wi;
+            y[ k * ys + q + 1 ] = yr * wi + yi * wr;
+          }
+        }
+        break;
+    }
+  }
+}
+
+void
+csignal_bluestein_fft (
+                       csignal_exact_fft_plan* in_plan,
+                       FLOAT64*                in_scratch,
+                       FLOAT64*                in_fft_scratch,
+                       FLOAT64*                in_data,
+                       FLOAT64*                out_data,
+                       CHAR                    in_sign
+                       )
+{
+  USIZE n           = in_plan->fft_length;
+  USIZE m           = in_plan->convolution_length;
+  FLOAT64* chirp    = in_plan->chirp;
+  FLOAT64* spectrum = in_plan->chirp_fft;
+  FLOAT64* scratch  = in_scratch;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  
+  //  a[ j ] = x[ j ] c[ j ], zero-padded to the convolution length. The IFFT
+  //  uses the conjugate chirp.
+  for( USIZE j = 0; j < n; j++ )
+  {
+    FLOAT64 cr = chirp[ 2 * j ];
+    FLOAT64 ci = sign * chirp[ 2 * j + 1 ];
+    
+    scratch[ 2 * j ]      = in_data[ 2 * j ] * cr - in_data[ 2 * j + 1 ] * ci;
+    scratch[ 2 * j + 1 ]  = in_data[ 2 * j ] * ci + in_data[ 2 * j + 1 ] * cr;
+  }
+  
+  CPC_MEMSET( scratch + 2 * n, 0x0, sizeof( FLOAT64 ) * 2 * ( m - n ) );
+  
+  csignal_fft_plan_transform  (
+                               in_plan->complex_plan,
+                               in_fft_scratch,
+                               scratch,
+                               scratch,
+                               CALCULATE_FFT
+                               );
+  
+  //  The wrapped conjugate chirp is even so the spectrum of the conjugate of
+  //  it (needed by the IFFT) is the conjugate of its spectrum.
+  for( USIZE k = 0; k < m; k++ )
+  {
+    FLOAT64 br = spectrum[ 2 * k ];
+    FLOAT64 bi = sign * spectrum[ 2 * k + 1 ];
+    FLOAT64 ar = scratch[ 2 * k ];
+    FLOAT64 ai = scratch[ 2 * k + 1 ];
+    
+    scratch[ 2 * k ]      = ar * br - ai * bi;
+    scratch[ 2 * k + 1 ]  = ar * bi + ai * br;
+  }
+  
+  csignal_fft_plan_transform  (
+                               in_plan->complex_plan,
+                               in_fft_scratch,
+                               scratch,
+                               scratch,
+                               CALCULATE_IFFT
+                               );
+  
+  for( USIZE k = 0; k < n; k++ )
+  {
+    FLOAT64 cr = chirp[ 2 * k ];
+    FLOAT64 ci = sign * chirp[ 2 * k + 1 ];
+    
+    out_data[ 2 * k ]     = scratch[ 2 * k ] * cr - scratch[ 2 * k + 1 ] * ci;
+    out_data[ 2 * k + 1 ] = scratch[ 2 * k ] * ci + scratch[ 2 * k + 1 ] * cr;
+  }
+}
+
+USIZE
+csignal_exact_fft_scratch_length  (
+                                   csignal_exact_fft_plan* in_plan
+                                   )
+{
+  USIZE length = 0;
+  
+  switch( in_plan->algorithm )
+  {
+    case CSIGNAL_EXACT_FFT_MIXED_RADIX:
+      length = 2 * in_plan->fft_length;
+      break;
+    case CSIGNAL_EXACT_FFT_BLUESTEIN:
+      length = 2 * in_plan->convolution_length;
+      break;
+    default:
+      break;
+  }
+  
+  return( length );
+}
+
+csignal_error_code
+csignal_exact_fft_calculate (
+                             csignal_exact_fft_plan* in_plan,
+                             FLOAT64*                in_data,
+                             FLOAT64*                out_data,
+                             CHAR                    in_sign
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  FLOAT64* scratch = NULL;
+  
+  USIZE scratch_length      = csignal_exact_fft_scratch_length( in_plan );
+  USIZE fft_scratch_length  = 0;
+  
+  if( NULL != in_plan->complex_plan )
+  {
+    fft_scratch_length = csignal_fft_scratch_length( in_plan->complex_plan );
+  }
+  
+  if  (
+       in_data != out_data
+       && in_data < out_data + 2 * in_plan->fft_length
+       && out_data < in_data + 2 * in_plan->fft_length
+       )
+  {
+    CPC_ERROR (
+               "In data (0x%x) and out data (0x%x) overlap.",
+               in_data,
+               out_data
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if( 0 < scratch_length + fft_scratch_length )
+  {
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) &scratch,
+                       sizeof( FLOAT64 )
+                       * ( scratch_length + fft_scratch_length )
+                       );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value )
+  {
+    csignal_exact_fft_transform (
+                                 in_plan,
+                                 scratch,
+                                 ( 0 < fft_scratch_length )
+                                 ? scratch + scratch_length : NULL,
+                                 in_data,
+                                 out_data,
+                                 in_sign
+                                 );
+    
+    if( NULL != scratch )
+    {
+      cpc_safe_free( ( void** ) &scratch );
+    }
+  }
+  else
+  {
+    CPC_ERROR( "Could not calculate exact FFT: 0x%x.", return_value );
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_exact_fft_execute (
+                           csignal_exact_fft_plan* in_plan,
+                           FLOAT64*                in_data,
+                           FLOAT64*                out_data,
+                           CHAR                    in_sign
+                           )
+{
+  FLOAT64* fft_scratch = NULL;
+  
+  if( NULL != in_plan->complex_plan )
+  {
+    fft_scratch = in_plan->complex_plan->scratch;
+  }
+  
+  csignal_exact_fft_transform (
+                               in_plan,
+                               in_plan->scratch,
+                               fft_scratch,
+                               in_data,
+                               out_data,
+                               in_sign
+                               );
+}
+
+void
+csignal_chirp_z_transform (
+                           csignal_chirp_z_plan* in_plan,
+                           FLOAT64*              in_signal,
+                           CPC_BOOL              in_real,
+                           FLOAT64*              out_bins
+                           )
+{
+  USIZE n           = in_plan->signal_length;
+  USIZE m           = in_plan->convolution_length;
+  FLOAT64* chirp    = in_plan->input_chirp;
+  FLOAT64* spectrum = in_plan->chirp_fft;
+  FLOAT64* scratch  = in_plan->scratch;
+  
+  //  All samples are read before any bin is written, so the transform may
+  //  be calculated in place
+  for( USIZE j = 0; j < n; j++ )
+  {
+    FLOAT64 cr = chirp[ 2 * j ];
+    FLOAT64 ci = chirp[ 2 * j + 1 ];
+    
+    if( in_real )
+    {
+      scratch[ 2 * j ]      = in_signal[ j ] * cr;
+      scratch[ 2 * j + 1 ]  = in_signal[ j ] * ci;
     }
-    mmax=istep;
+    else
+    {
+      FLOAT64 xr = in_signal[ 2 * j ];
+      FLOAT64 xi = in_signal[ 2 * j + 1 ];
+      
+      scratch[ 2 * j ]      = xr * cr - xi * ci;
+      scratch[ 2 * j + 1 ]  = xr * ci + xi * cr;
+    }
+  }
+  
+  CPC_MEMSET( scratch + 2 * n, 0x0, sizeof( FLOAT64 ) * 2 * ( m - n ) );
+  
+  csignal_fft_plan_transform  (
+                               in_plan->complex_plan,
+                               in_plan->complex_plan->scratch,
+                               scratch,
+                               scratch,
+                               CALCULATE_FFT
+                               );
+  
+  for( USIZE k = 0; k < m; k++ )
+  {
+    FLOAT64 br = spectrum[ 2 * k ];
+    FLOAT64 bi = spectrum[ 2 * k + 1 ];
+    FLOAT64 ar = scratch[ 2 * k ];
+    FLOAT64 ai = scratch[ 2 * k + 1 ];
+    
+    scratch[ 2 * k ]      = ar * br - ai * bi;
+    scratch[ 2 * k + 1 ]  = ar * bi + ai * br;
+  }
+  
+  csignal_fft_plan_transform  (
+                               in_plan->complex_plan,
+                               in_plan->complex_plan->scratch,
+                               scratch,
+                               scratch,
+                               CALCULATE_IFFT
+                               );
+  
+  chirp = in_plan->output_chirp;
+  
+  for( USIZE k = 0; k < in_plan->number_of_bins; k++ )
+  {
+    FLOAT64 cr = chirp[ 2 * k ];
+    FLOAT64 ci = chirp[ 2 * k + 1 ];
+    
+    out_bins[ 2 * k ]     = scratch[ 2 * k ] * cr - scratch[ 2 * k + 1 ] * ci;
+    out_bins[ 2 * k + 1 ] = scratch[ 2 * k ] * ci + scratch[ 2 * k + 1 ] * cr;
   }
 }
 
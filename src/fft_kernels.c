@@ -0,0 +1,1815 @@
+/*! \file   fft_kernels.c
+    \brief  Scalar and vectorized FFT kernels and the runtime selection of the
+            kernel used by the FFT plans.
+ 
+    \author Brent Carrara
+ */
+#include "fft_kernels.h"
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+
+#include <immintrin.h>
+
+/*! \def    CSIGNAL_FFT_SSE2
+    \brief  Defined when the SSE2 kernel is compiled in.
+ */
+#define CSIGNAL_FFT_SSE2
+
+/*! \def    CSIGNAL_FFT_AVX2
+    \brief  Defined when the AVX2 kernel is compiled in.
+ */
+#define CSIGNAL_FFT_AVX2
+
+/*! \def    CSIGNAL_TARGET_SSE2
+    \brief  Compiles a function for SSE2 regardless of the compiler flags.
+ */
+#define CSIGNAL_TARGET_SSE2 __attribute__( ( target( "sse2" ) ) )
+
+/*! \def    CSIGNAL_TARGET_AVX2
+    \brief  Compiles a function for AVX2 and FMA regardless of the compiler
+            flags. Such functions must only be called after checking the CPU.
+ */
+#define CSIGNAL_TARGET_AVX2 __attribute__( ( target( "avx2,fma" ) ) )
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_AMD64 ) )
+
+#include <emmintrin.h>
+
+#define CSIGNAL_FFT_SSE2
+#define CSIGNAL_TARGET_SSE2
+
+#elif defined( __ARM_NEON ) && defined( __aarch64__ )
+
+//  The NEON kernel has not been verified on hardware yet, so ARM64 builds use
+//  the scalar kernel unless they opt in (see fft_kernels.h).
+#ifdef CSIGNAL_FFT_ENABLE_NEON
+
+#include <arm_neon.h>
+
+/*! \def    CSIGNAL_FFT_NEON
+    \brief  Defined when the NEON kernel is compiled in.
+ */
+#define CSIGNAL_FFT_NEON
+
+#endif
+
+#endif
+
+/*! \var    csignal_fft_bit_reverse_kernel
+    \brief  Function type of the kernels that permute the input of a plan into
+            bit-reversed order.
+ */
+typedef void ( *csignal_fft_bit_reverse_kernel )  (
+                                                   csignal_fft_plan*,
+                                                   FLOAT64*
+                                                   );
+
+/*! \var    csignal_fft_butterfly_kernel
+    \brief  Function type of the kernels that perform the butterflies of a plan
+            on bit-reversed input.
+ */
+typedef void ( *csignal_fft_butterfly_kernel )  (
+                                                 csignal_fft_plan*,
+                                                 FLOAT64*,
+                                                 CHAR
+                                                 );
+
+/*! \fn     void csignal_fft_bit_reverse_scalar (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data
+            )
+    \brief  Permutes io_data in place using the plan's bit-reversal table.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued signal to permute.
+ */
+void
+csignal_fft_bit_reverse_scalar  (
+                                 csignal_fft_plan* in_plan,
+                                 FLOAT64*          io_data
+                                 );
+
+/*! \fn     void csignal_fft_radix_4_scalar (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data,
+              CHAR              in_sign
+            )
+    \brief  The decimation in time butterflies for bit-reversed input. Each
+            pass combines four sub-transforms of length h into one of length
+            4h, i.e., it does the work of two radix-2 passes with three complex
+            multiplies per four points instead of four and half the number of
+            sweeps through io_data. If log2( fft_length ) is odd a single
+            radix-2 pass (which needs no multiplies) is done first.
+ 
+    \note   Because the input is in base-2 (not base-4) bit-reversed order the
+            four sub-transforms in a block of 4h points are stored in the order
+            F0, F2, F1, F3 where Fr is the transform of the samples congruent to
+            r modulo 4. All of the vectorized kernels follow the same structure.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The bit-reversed compex-valued signal.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_fft_radix_4_scalar  (
+                             csignal_fft_plan* in_plan,
+                             FLOAT64*          io_data,
+                             CHAR              in_sign
+                             );
+
+/*! \fn     USIZE csignal_fft_number_of_passes (
+              USIZE in_fft_length
+            )
+    \brief  Returns log2( in_fft_length ), the number of radix-2 passes.
+ */
+USIZE
+csignal_fft_number_of_passes  (
+                               USIZE in_fft_length
+                               );
+
+/*! \fn     CPC_BOOL csignal_fft_kernel_is_supported (
+              csignal_fft_kernel_type in_type
+            )
+    \brief  Returns true if in_type was compiled into this build of the library
+            and is supported by the CPU the library is running on.
+ */
+CPC_BOOL
+csignal_fft_kernel_is_supported (
+                                 csignal_fft_kernel_type in_type
+                                 );
+
+#ifdef CSIGNAL_FFT_SSE2
+
+/*! \fn     void csignal_fft_bit_reverse_sse2 (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data
+            )
+    \brief  SSE2 version of csignal_fft_bit_reverse_scalar that swaps each
+            complex value with a single 128-bit load and store.
+ */
+void
+csignal_fft_bit_reverse_sse2  (
+                               csignal_fft_plan* in_plan,
+                               FLOAT64*          io_data
+                               );
+
+/*! \fn     void csignal_fft_radix_4_sse2 (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data,
+              CHAR              in_sign
+            )
+    \brief  SSE2 version of csignal_fft_radix_4_scalar, one complex value per
+            register.
+ */
+void
+csignal_fft_radix_4_sse2  (
+                           csignal_fft_plan* in_plan,
+                           FLOAT64*          io_data,
+                           CHAR              in_sign
+                           );
+
+/*! \fn     void csignal_fft_radix_2_pass_sse2 (
+              USIZE    in_fft_length,
+              FLOAT64* io_data
+            )
+    \brief  The radix-2 pass done first when log2( fft_length ) is odd.
+ */
+void
+csignal_fft_radix_2_pass_sse2 (
+                               USIZE    in_fft_length,
+                               FLOAT64* io_data
+                               );
+
+/*! \fn     void csignal_fft_radix_4_pass_sse2 (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data,
+              USIZE             in_h,
+              CHAR              in_sign
+            )
+    \brief  A single radix-4 pass that combines sub-transforms of length in_h
+            into sub-transforms of length 4 * in_h.
+ */
+void
+csignal_fft_radix_4_pass_sse2 (
+                               csignal_fft_plan* in_plan,
+                               FLOAT64*          io_data,
+                               USIZE             in_h,
+                               CHAR              in_sign
+                               );
+
+#endif
+
+#ifdef CSIGNAL_FFT_AVX2
+
+/*! \fn     void csignal_fft_radix_4_avx2 (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data,
+              CHAR              in_sign
+            )
+    \brief  AVX2 version of csignal_fft_radix_4_scalar. Butterflies k and k + 1
+            of every pass with h >= 2 are calculated together, two complex
+            values per register. The passes with h < 2 use the SSE2 code.
+ */
+void
+csignal_fft_radix_4_avx2  (
+                           csignal_fft_plan* in_plan,
+                           FLOAT64*          io_data,
+                           CHAR              in_sign
+                           );
+
+#endif
+
+#ifdef CSIGNAL_FFT_NEON
+
+/*! \fn     void csignal_fft_bit_reverse_neon (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data
+            )
+    \brief  NEON version of csignal_fft_bit_reverse_scalar.
+ */
+void
+csignal_fft_bit_reverse_neon  (
+                               csignal_fft_plan* in_plan,
+                               FLOAT64*          io_data
+                               );
+
+/*! \fn     void csignal_fft_radix_4_neon (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data,
+              CHAR              in_sign
+            )
+    \brief  NEON version of csignal_fft_radix_4_scalar, one complex value per
+            register.
+ */
+void
+csignal_fft_radix_4_neon  (
+                           csignal_fft_plan* in_plan,
+                           FLOAT64*          io_data,
+                           CHAR              in_sign
+                           );
+
+#endif
+
+/*! \var    csignal_fft_butterfly_kernel_float32
+    \brief  Function type of the kernels that perform the butterflies of a
+            FLOAT32 plan on bit-reversed input.
+ */
+typedef void ( *csignal_fft_butterfly_kernel_float32 )  (
+                                                         csignal_fft_plan_float32*,
+                                                         FLOAT32*,
+                                                         CHAR
+                                                         );
+
+/*! \fn     void csignal_fft_bit_reverse_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data
+            )
+    \brief  Permutes io_data in place using the plan's bit-reversal table. A
+            FLOAT32 complex value is a single 64-bit move so this is used by
+            every kernel.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued signal to permute.
+ */
+void
+csignal_fft_bit_reverse_float32 (
+                                 csignal_fft_plan_float32* in_plan,
+                                 FLOAT32*                  io_data
+                                 );
+
+/*! \fn     void csignal_fft_radix_2_pass_float32 (
+              USIZE    in_fft_length,
+              FLOAT32* io_data
+            )
+    \brief  The radix-2 pass done first when log2( fft_length ) is odd.
+ */
+void
+csignal_fft_radix_2_pass_float32  (
+                                   USIZE    in_fft_length,
+                                   FLOAT32* io_data
+                                   );
+
+/*! \fn     void csignal_fft_radix_4_pass_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data,
+              USIZE                     in_h,
+              CHAR                      in_sign
+            )
+    \brief  A single radix-4 pass of csignal_fft_radix_4_scalar on a FLOAT32
+            plan.
+ */
+void
+csignal_fft_radix_4_pass_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   USIZE                     in_h,
+                                   CHAR                      in_sign
+                                   );
+
+/*! \fn     void csignal_fft_radix_4_scalar_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data,
+              CHAR                      in_sign
+            )
+    \brief  FLOAT32 version of csignal_fft_radix_4_scalar, the passes and the
+            order of the sub-transforms are the same.
+ */
+void
+csignal_fft_radix_4_scalar_float32  (
+                                     csignal_fft_plan_float32* in_plan,
+                                     FLOAT32*                  io_data,
+                                     CHAR                      in_sign
+                                     );
+
+#ifdef CSIGNAL_FFT_SSE2
+
+/*! \fn     void csignal_fft_radix_4_sse2_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data,
+              CHAR                      in_sign
+            )
+    \brief  SSE2 version of csignal_fft_radix_4_scalar_float32, two complex
+            values per register.
+ */
+void
+csignal_fft_radix_4_sse2_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   CHAR                      in_sign
+                                   );
+
+/*! \fn     void csignal_fft_radix_2_pass_sse2_float32 (
+              USIZE    in_fft_length,
+              FLOAT32* io_data
+            )
+    \brief  The radix-2 pass done first when log2( fft_length ) is odd, one
+            butterfly per register.
+ */
+void
+csignal_fft_radix_2_pass_sse2_float32 (
+                                       USIZE    in_fft_length,
+                                       FLOAT32* io_data
+                                       );
+
+/*! \fn     void csignal_fft_radix_4_first_pass_sse2_float32 (
+              USIZE    in_fft_length,
+              FLOAT32* io_data,
+              CHAR     in_sign
+            )
+    \brief  The radix-4 pass with h = 1 done first when log2( fft_length ) is
+            even. Its only twiddle factor is 1, so one butterfly is two
+            registers and no multiplies.
+ */
+void
+csignal_fft_radix_4_first_pass_sse2_float32 (
+                                             USIZE    in_fft_length,
+                                             FLOAT32* io_data,
+                                             CHAR     in_sign
+                                             );
+
+/*! \fn     void csignal_fft_radix_4_pass_sse2_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data,
+              USIZE                     in_h,
+              CHAR                      in_sign
+            )
+    \brief  A single radix-4 pass for in_h >= 2, butterflies k and k + 1 are
+            calculated together.
+ */
+void
+csignal_fft_radix_4_pass_sse2_float32 (
+                                       csignal_fft_plan_float32* in_plan,
+                                       FLOAT32*                  io_data,
+                                       USIZE                     in_h,
+                                       CHAR                      in_sign
+                                       );
+
+#endif
+
+#ifdef CSIGNAL_FFT_AVX2
+
+/*! \fn     void csignal_fft_radix_4_avx2_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data,
+              CHAR                      in_sign
+            )
+    \brief  AVX2 version of csignal_fft_radix_4_scalar_float32. Butterflies k
+            to k + 3 of every pass with h >= 4 are calculated together, four
+            complex values per register. The passes with h < 4 use the SSE2
+            code.
+ */
+void
+csignal_fft_radix_4_avx2_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   CHAR                      in_sign
+                                   );
+
+#endif
+
+#ifdef CSIGNAL_FFT_NEON
+
+/*! \fn     void csignal_fft_radix_4_neon_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data,
+              CHAR                      in_sign
+            )
+    \brief  NEON version of csignal_fft_radix_4_scalar_float32, two complex
+            values per register. The passes with h < 2 use the scalar code.
+ */
+void
+csignal_fft_radix_4_neon_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   CHAR                      in_sign
+                                   );
+
+#endif
+
+/*! \var    csignal_fft_kernel
+    \brief  The kernel currently used by all plans.
+ */
+static csignal_fft_kernel_type csignal_fft_kernel = CSIGNAL_FFT_KERNEL_SCALAR;
+
+/*! \var    csignal_fft_bit_reverse_function
+    \brief  The bit-reversal function of the current kernel.
+ */
+static csignal_fft_bit_reverse_kernel csignal_fft_bit_reverse_function =
+  csignal_fft_bit_reverse_scalar;
+
+/*! \var    csignal_fft_butterfly_function
+    \brief  The butterfly function of the current kernel.
+ */
+static csignal_fft_butterfly_kernel csignal_fft_butterfly_function =
+  csignal_fft_radix_4_scalar;
+
+/*! \var    csignal_fft_butterfly_function_float32
+    \brief  The FLOAT32 butterfly function of the current kernel.
+ */
+static csignal_fft_butterfly_kernel_float32
+  csignal_fft_butterfly_function_float32 = csignal_fft_radix_4_scalar_float32;
+
+void
+csignal_fft_select_kernel( void )
+{
+  csignal_fft_kernel_type type = CSIGNAL_FFT_KERNEL_SCALAR;
+  
+#if defined( CSIGNAL_FFT_AVX2 )
+  if( CPC_ERROR_CODE_NO_ERROR == csignal_fft_set_kernel( CSIGNAL_FFT_KERNEL_AVX2 ) )
+  {
+    type = CSIGNAL_FFT_KERNEL_AVX2;
+  }
+  else
+#endif
+#if defined( CSIGNAL_FFT_SSE2 )
+  if( CPC_ERROR_CODE_NO_ERROR == csignal_fft_set_kernel( CSIGNAL_FFT_KERNEL_SSE2 ) )
+  {
+    type = CSIGNAL_FFT_KERNEL_SSE2;
+  }
+  else
+#endif
+#if defined( CSIGNAL_FFT_NEON )
+  if( CPC_ERROR_CODE_NO_ERROR == csignal_fft_set_kernel( CSIGNAL_FFT_KERNEL_NEON ) )
+  {
+    type = CSIGNAL_FFT_KERNEL_NEON;
+  }
+  else
+#endif
+  {
+    csignal_fft_set_kernel( CSIGNAL_FFT_KERNEL_SCALAR );
+  }
+  
+  CPC_LOG( CPC_LOG_LEVEL_DEBUG, "Selected FFT kernel %d.", type );
+}
+
+csignal_error_code
+csignal_fft_set_kernel  (
+                         csignal_fft_kernel_type in_type
+                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( !csignal_fft_kernel_is_supported( in_type ) )
+  {
+    CPC_ERROR( "FFT kernel %d is not supported.", in_type );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    csignal_fft_bit_reverse_function  = csignal_fft_bit_reverse_scalar;
+    csignal_fft_butterfly_function    = csignal_fft_radix_4_scalar;
+    
+    csignal_fft_butterfly_function_float32 =
+      csignal_fft_radix_4_scalar_float32;
+    
+    switch( in_type )
+    {
+#ifdef CSIGNAL_FFT_SSE2
+      case CSIGNAL_FFT_KERNEL_SSE2:
+        csignal_fft_bit_reverse_function  = csignal_fft_bit_reverse_sse2;
+        csignal_fft_butterfly_function    = csignal_fft_radix_4_sse2;
+        
+        csignal_fft_butterfly_function_float32 =
+          csignal_fft_radix_4_sse2_float32;
+        break;
+#endif
+#ifdef CSIGNAL_FFT_AVX2
+      case CSIGNAL_FFT_KERNEL_AVX2:
+        csignal_fft_bit_reverse_function  = csignal_fft_bit_reverse_sse2;
+        csignal_fft_butterfly_function    = csignal_fft_radix_4_avx2;
+        
+        csignal_fft_butterfly_function_float32 =
+          csignal_fft_radix_4_avx2_float32;
+        break;
+#endif
+#ifdef CSIGNAL_FFT_NEON
+      case CSIGNAL_FFT_KERNEL_NEON:
+        csignal_fft_bit_reverse_function  = csignal_fft_bit_reverse_neon;
+        csignal_fft_butterfly_function    = csignal_fft_radix_4_neon;
+        
+        csignal_fft_butterfly_function_float32 =
+          csignal_fft_radix_4_neon_float32;
+        break;
+#endif
+      default:
+        break;
+    }
+    
+    csignal_fft_kernel = in_type;
+  }
+  
+  return( return_value );
+}
+
+csignal_fft_kernel_type
+csignal_fft_get_kernel( void )
+{
+  return( csignal_fft_kernel );
+}
+
+void
+csignal_fft_run_kernel  (
+                         csignal_fft_plan* in_plan,
+                         FLOAT64*          io_data,
+                         CHAR              in_sign
+                         )
+{
+  csignal_fft_bit_reverse_function( in_plan, io_data );
+  
+  csignal_fft_butterfly_function( in_plan, io_data, in_sign );
+}
+
+void
+csignal_fft_run_kernel_out_of_place (
+                                     csignal_fft_plan* in_plan,
+                                     FLOAT64*          in_data,
+                                     FLOAT64*          out_data,
+                                     CHAR              in_sign
+                                     )
+{
+  if( in_data == out_data )
+  {
+    csignal_fft_bit_reverse_function( in_plan, out_data );
+  }
+  else
+  {
+    USIZE* reversal = in_plan->bit_reversal;
+    
+    //  The permutation is its own inverse so out[ i ] = in[ reversal[ i ] ]
+    for( USIZE i = 0; i < in_plan->fft_length; i++ )
+    {
+      out_data[ 2 * i ]     = in_data[ 2 * reversal[ i ] ];
+      out_data[ 2 * i + 1 ] = in_data[ 2 * reversal[ i ] + 1 ];
+    }
+  }
+  
+  csignal_fft_butterfly_function( in_plan, out_data, in_sign );
+}
+
+void
+csignal_fft_run_kernel_float32  (
+                                 csignal_fft_plan_float32* in_plan,
+                                 FLOAT32*                  io_data,
+                                 CHAR                      in_sign
+                                 )
+{
+  csignal_fft_bit_reverse_float32( in_plan, io_data );
+  
+  csignal_fft_butterfly_function_float32( in_plan, io_data, in_sign );
+}
+
+void
+csignal_fft_run_kernel_out_of_place_float32 (
+                                             csignal_fft_plan_float32* in_plan,
+                                             FLOAT32*                  in_data,
+                                             FLOAT32*                  out_data,
+                                             CHAR                      in_sign
+                                             )
+{
+  if( in_data == out_data )
+  {
+    csignal_fft_bit_reverse_float32( in_plan, out_data );
+  }
+  else
+  {
+    USIZE* reversal = in_plan->bit_reversal;
+    
+    for( USIZE i = 0; i < in_plan->fft_length; i++ )
+    {
+      out_data[ 2 * i ]     = in_data[ 2 * reversal[ i ] ];
+      out_data[ 2 * i + 1 ] = in_data[ 2 * reversal[ i ] + 1 ];
+    }
+  }
+  
+  csignal_fft_butterfly_function_float32( in_plan, out_data, in_sign );
+}
+
+CPC_BOOL
+csignal_fft_kernel_is_supported (
+                                 csignal_fft_kernel_type in_type
+                                 )
+{
+  CPC_BOOL return_value = CPC_FALSE;
+  
+  switch( in_type )
+  {
+    case CSIGNAL_FFT_KERNEL_SCALAR:
+      return_value = CPC_TRUE;
+      break;
+#ifdef CSIGNAL_FFT_SSE2
+    case CSIGNAL_FFT_KERNEL_SSE2:
+#if defined( __GNUC__ )
+      __builtin_cpu_init();
+      
+      return_value = ( __builtin_cpu_supports( "sse2" ) ? CPC_TRUE : CPC_FALSE );
+#else
+      return_value = CPC_TRUE;
+#endif
+      break;
+#endif
+#ifdef CSIGNAL_FFT_AVX2
+    case CSIGNAL_FFT_KERNEL_AVX2:
+      __builtin_cpu_init();
+      
+      return_value =
+        (
+         __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" )
+         ? CPC_TRUE : CPC_FALSE
+         );
+      break;
+#endif
+#ifdef CSIGNAL_FFT_NEON
+    case CSIGNAL_FFT_KERNEL_NEON:
+      return_value = CPC_TRUE;
+      break;
+#endif
+    default:
+      break;
+  }
+  
+  return( return_value );
+}
+
+USIZE
+csignal_fft_number_of_passes  (
+                               USIZE in_fft_length
+                               )
+{
+  USIZE passes = 0;
+  
+  while( ( ( USIZE ) 1 << passes ) < in_fft_length )
+  {
+    passes++;
+  }
+  
+  return( passes );
+}
+
+void
+csignal_fft_bit_reverse_scalar  (
+                                 csignal_fft_plan* in_plan,
+                                 FLOAT64*          io_data
+                                 )
+{
+  USIZE n         = in_plan->fft_length;
+  USIZE* reversal = in_plan->bit_reversal;
+  
+  for( USIZE i = 0; i < n; i++ )
+  {
+    USIZE j = reversal[ i ];
+    
+    if( j > i )
+    {
+      FLOAT64 tempr = io_data[ 2 * i ];
+      FLOAT64 tempi = io_data[ 2 * i + 1 ];
+      
+      io_data[ 2 * i ]      = io_data[ 2 * j ];
+      io_data[ 2 * i + 1 ]  = io_data[ 2 * j + 1 ];
+      io_data[ 2 * j ]      = tempr;
+      io_data[ 2 * j + 1 ]  = tempi;
+    }
+  }
+}
+
+void
+csignal_fft_radix_4_scalar  (
+                             csignal_fft_plan* in_plan,
+                             FLOAT64*          io_data,
+                             CHAR              in_sign
+                             )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT64* twiddles = in_plan->twiddles;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  USIZE h           = 1;
+  
+  //  An odd number of radix-2 passes leaves one over, it is done first since
+  //  its only twiddle factor is 1.
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    for( USIZE i = 0; i < 2 * n; i += 4 )
+    {
+      FLOAT64 tempr = io_data[ i + 2 ];
+      FLOAT64 tempi = io_data[ i + 3 ];
+      
+      io_data[ i + 2 ]  = io_data[ i ] - tempr;
+      io_data[ i + 3 ]  = io_data[ i + 1 ] - tempi;
+      io_data[ i ]      += tempr;
+      io_data[ i + 1 ]  += tempi;
+    }
+    
+    h = 2;
+  }
+  
+  //  stride is the step through the twiddle table, W_4h^k = W_n^( k * stride )
+  for( ; h < n; h <<= 2 )
+  {
+    USIZE stride = n / ( 4 * h );
+    
+    for( USIZE block = 0; block < n; block += 4 * h )
+    {
+      FLOAT64* f0 = io_data + 2 * block;
+      FLOAT64* f2 = f0 + 2 * h;
+      FLOAT64* f1 = f2 + 2 * h;
+      FLOAT64* f3 = f1 + 2 * h;
+      
+      for( USIZE k = 0; k < h; k++ )
+      {
+        FLOAT64* w1 = twiddles + 2 * k * stride;
+        FLOAT64* w2 = twiddles + 4 * k * stride;
+        FLOAT64* w3 = twiddles + 6 * k * stride;
+        
+        FLOAT64 w1r = w1[ 0 ];
+        FLOAT64 w1i = sign * w1[ 1 ];
+        FLOAT64 w2r = w2[ 0 ];
+        FLOAT64 w2i = sign * w2[ 1 ];
+        FLOAT64 w3r = w3[ 0 ];
+        FLOAT64 w3i = sign * w3[ 1 ];
+        
+        FLOAT64 t0r = f0[ 2 * k ];
+        FLOAT64 t0i = f0[ 2 * k + 1 ];
+        FLOAT64 t1r = w1r * f1[ 2 * k ] - w1i * f1[ 2 * k + 1 ];
+        FLOAT64 t1i = w1r * f1[ 2 * k + 1 ] + w1i * f1[ 2 * k ];
+        FLOAT64 t2r = w2r * f2[ 2 * k ] - w2i * f2[ 2 * k + 1 ];
+        FLOAT64 t2i = w2r * f2[ 2 * k + 1 ] + w2i * f2[ 2 * k ];
+        FLOAT64 t3r = w3r * f3[ 2 * k ] - w3i * f3[ 2 * k + 1 ];
+        FLOAT64 t3i = w3r * f3[ 2 * k + 1 ] + w3i * f3[ 2 * k ];
+        
+        FLOAT64 u0r = t0r + t2r;
+        FLOAT64 u0i = t0i + t2i;
+        FLOAT64 u1r = t0r - t2r;
+        FLOAT64 u1i = t0i - t2i;
+        FLOAT64 u2r = t1r + t3r;
+        FLOAT64 u2i = t1i + t3i;
+        
+        //  u3 = W_4 * ( t1 - t3 ) where W_4 = sign * i
+        FLOAT64 u3r = -1.0 * sign * ( t1i - t3i );
+        FLOAT64 u3i = sign * ( t1r - t3r );
+        
+        f0[ 2 * k ]     = u0r + u2r;
+        f0[ 2 * k + 1 ] = u0i + u2i;
+        f2[ 2 * k ]     = u1r + u3r;
+        f2[ 2 * k + 1 ] = u1i + u3i;
+        f1[ 2 * k ]     = u0r - u2r;
+        f1[ 2 * k + 1 ] = u0i - u2i;
+        f3[ 2 * k ]     = u1r - u3r;
+        f3[ 2 * k + 1 ] = u1i - u3i;
+      }
+    }
+  }
+}
+
+void
+csignal_fft_bit_reverse_float32 (
+                                 csignal_fft_plan_float32* in_plan,
+                                 FLOAT32*                  io_data
+                                 )
+{
+  USIZE n         = in_plan->fft_length;
+  USIZE* reversal = in_plan->bit_reversal;
+  
+  for( USIZE i = 0; i < n; i++ )
+  {
+    USIZE j = reversal[ i ];
+    
+    if( j > i )
+    {
+      FLOAT32 tempr = io_data[ 2 * i ];
+      FLOAT32 tempi = io_data[ 2 * i + 1 ];
+      
+      io_data[ 2 * i ]      = io_data[ 2 * j ];
+      io_data[ 2 * i + 1 ]  = io_data[ 2 * j + 1 ];
+      io_data[ 2 * j ]      = tempr;
+      io_data[ 2 * j + 1 ]  = tempi;
+    }
+  }
+}
+
+void
+csignal_fft_radix_2_pass_float32  (
+                                   USIZE    in_fft_length,
+                                   FLOAT32* io_data
+                                   )
+{
+  for( USIZE i = 0; i < 2 * in_fft_length; i += 4 )
+  {
+    FLOAT32 tempr = io_data[ i + 2 ];
+    FLOAT32 tempi = io_data[ i + 3 ];
+    
+    io_data[ i + 2 ]  = io_data[ i ] - tempr;
+    io_data[ i + 3 ]  = io_data[ i + 1 ] - tempi;
+    io_data[ i ]      += tempr;
+    io_data[ i + 1 ]  += tempi;
+  }
+}
+
+void
+csignal_fft_radix_4_pass_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   USIZE                     in_h,
+                                   CHAR                      in_sign
+                                   )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT32* twiddles = in_plan->twiddles;
+  FLOAT32 sign      = ( in_sign * 1.0f );
+  USIZE stride      = n / ( 4 * in_h );
+  
+  for( USIZE block = 0; block < n; block += 4 * in_h )
+  {
+    FLOAT32* f0 = io_data + 2 * block;
+    FLOAT32* f2 = f0 + 2 * in_h;
+    FLOAT32* f1 = f2 + 2 * in_h;
+    FLOAT32* f3 = f1 + 2 * in_h;
+    
+    for( USIZE k = 0; k < in_h; k++ )
+    {
+      FLOAT32* w1 = twiddles + 2 * k * stride;
+      FLOAT32* w2 = twiddles + 4 * k * stride;
+      FLOAT32* w3 = twiddles + 6 * k * stride;
+      
+      FLOAT32 w1r = w1[ 0 ];
+      FLOAT32 w1i = sign * w1[ 1 ];
+      FLOAT32 w2r = w2[ 0 ];
+      FLOAT32 w2i = sign * w2[ 1 ];
+      FLOAT32 w3r = w3[ 0 ];
+      FLOAT32 w3i = sign * w3[ 1 ];
+      
+      FLOAT32 t0r = f0[ 2 * k ];
+      FLOAT32 t0i = f0[ 2 * k + 1 ];
+      FLOAT32 t1r = w1r * f1[ 2 * k ] - w1i * f1[ 2 * k + 1 ];
+      FLOAT32 t1i = w1r * f1[ 2 * k + 1 ] + w1i * f1[ 2 * k ];
+      FLOAT32 t2r = w2r * f2[ 2 * k ] - w2i * f2[ 2 * k + 1 ];
+      FLOAT32 t2i = w2r * f2[ 2 * k + 1 ] + w2i * f2[ 2 * k ];
+      FLOAT32 t3r = w3r * f3[ 2 * k ] - w3i * f3[ 2 * k + 1 ];
+      FLOAT32 t3i = w3r * f3[ 2 * k + 1 ] + w3i * f3[ 2 * k ];
+      
+      FLOAT32 u0r = t0r + t2r;
+      FLOAT32 u0i = t0i + t2i;
+      FLOAT32 u1r = t0r - t2r;
+      FLOAT32 u1i = t0i - t2i;
+      FLOAT32 u2r = t1r + t3r;
+      FLOAT32 u2i = t1i + t3i;
+      
+      //  u3 = W_4 * ( t1 - t3 ) where W_4 = sign * i
+      FLOAT32 u3r = -1.0f * sign * ( t1i - t3i );
+      FLOAT32 u3i = sign * ( t1r - t3r );
+      
+      f0[ 2 * k ]     = u0r + u2r;
+      f0[ 2 * k + 1 ] = u0i + u2i;
+      f2[ 2 * k ]     = u1r + u3r;
+      f2[ 2 * k + 1 ] = u1i + u3i;
+      f1[ 2 * k ]     = u0r - u2r;
+      f1[ 2 * k + 1 ] = u0i - u2i;
+      f3[ 2 * k ]     = u1r - u3r;
+      f3[ 2 * k + 1 ] = u1i - u3i;
+    }
+  }
+}
+
+void
+csignal_fft_radix_4_scalar_float32  (
+                                     csignal_fft_plan_float32* in_plan,
+                                     FLOAT32*                  io_data,
+                                     CHAR                      in_sign
+                                     )
+{
+  USIZE n = in_plan->fft_length;
+  USIZE h = 1;
+  
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    csignal_fft_radix_2_pass_float32( n, io_data );
+    
+    h = 2;
+  }
+  
+  for( ; h < n; h <<= 2 )
+  {
+    csignal_fft_radix_4_pass_float32( in_plan, io_data, h, in_sign );
+  }
+}
+
+#ifdef CSIGNAL_FFT_SSE2
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_bit_reverse_sse2  (
+                               csignal_fft_plan* in_plan,
+                               FLOAT64*          io_data
+                               )
+{
+  USIZE n         = in_plan->fft_length;
+  USIZE* reversal = in_plan->bit_reversal;
+  
+  for( USIZE i = 0; i < n; i++ )
+  {
+    USIZE j = reversal[ i ];
+    
+    if( j > i )
+    {
+      __m128d temp = _mm_loadu_pd( io_data + 2 * i );
+      
+      _mm_storeu_pd( io_data + 2 * i, _mm_loadu_pd( io_data + 2 * j ) );
+      _mm_storeu_pd( io_data + 2 * j, temp );
+    }
+  }
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_radix_2_pass_sse2 (
+                               USIZE    in_fft_length,
+                               FLOAT64* io_data
+                               )
+{
+  for( USIZE i = 0; i < 2 * in_fft_length; i += 4 )
+  {
+    __m128d a = _mm_loadu_pd( io_data + i );
+    __m128d b = _mm_loadu_pd( io_data + i + 2 );
+    
+    _mm_storeu_pd( io_data + i, _mm_add_pd( a, b ) );
+    _mm_storeu_pd( io_data + i + 2, _mm_sub_pd( a, b ) );
+  }
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_radix_4_pass_sse2 (
+                               csignal_fft_plan* in_plan,
+                               FLOAT64*          io_data,
+                               USIZE             in_h,
+                               CHAR              in_sign
+                               )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT64* twiddles = in_plan->twiddles;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  USIZE stride      = n / ( 4 * in_h );
+  
+  //  _mm_set_pd takes the high (imaginary) lane first
+  __m128d conjugate = _mm_set_pd( sign, 1.0 );
+  __m128d negate    = _mm_set_pd( 0.0, -0.0 );
+  __m128d rotate    = _mm_set_pd( sign, -1.0 * sign );
+  
+  for( USIZE block = 0; block < n; block += 4 * in_h )
+  {
+    FLOAT64* f0 = io_data + 2 * block;
+    FLOAT64* f2 = f0 + 2 * in_h;
+    FLOAT64* f1 = f2 + 2 * in_h;
+    FLOAT64* f3 = f1 + 2 * in_h;
+    
+    for( USIZE k = 0; k < in_h; k++ )
+    {
+      __m128d w1 =
+        _mm_mul_pd( _mm_loadu_pd( twiddles + 2 * k * stride ), conjugate );
+      __m128d w2 =
+        _mm_mul_pd( _mm_loadu_pd( twiddles + 4 * k * stride ), conjugate );
+      __m128d w3 =
+        _mm_mul_pd( _mm_loadu_pd( twiddles + 6 * k * stride ), conjugate );
+      
+      __m128d x1 = _mm_loadu_pd( f1 + 2 * k );
+      __m128d x2 = _mm_loadu_pd( f2 + 2 * k );
+      __m128d x3 = _mm_loadu_pd( f3 + 2 * k );
+      
+      //  ( xr, xi ) * ( wr, wi ) = ( xr wr, xi wr ) + ( -xi wi, xr wi )
+      __m128d t0 = _mm_loadu_pd( f0 + 2 * k );
+      __m128d t1 =
+        _mm_add_pd  (
+                     _mm_mul_pd( x1, _mm_unpacklo_pd( w1, w1 ) ),
+                     _mm_xor_pd (
+                                 _mm_mul_pd (
+                                             _mm_shuffle_pd( x1, x1, 1 ),
+                                             _mm_unpackhi_pd( w1, w1 )
+                                             ),
+                                 negate
+                                 )
+                     );
+      __m128d t2 =
+        _mm_add_pd  (
+                     _mm_mul_pd( x2, _mm_unpacklo_pd( w2, w2 ) ),
+                     _mm_xor_pd (
+                                 _mm_mul_pd (
+                                             _mm_shuffle_pd( x2, x2, 1 ),
+                                             _mm_unpackhi_pd( w2, w2 )
+                                             ),
+                                 negate
+                                 )
+                     );
+      __m128d t3 =
+        _mm_add_pd  (
+                     _mm_mul_pd( x3, _mm_unpacklo_pd( w3, w3 ) ),
+                     _mm_xor_pd (
+                                 _mm_mul_pd (
+                                             _mm_shuffle_pd( x3, x3, 1 ),
+                                             _mm_unpackhi_pd( w3, w3 )
+                                             ),
+                                 negate
+                                 )
+                     );
+      
+      __m128d u0 = _mm_add_pd( t0, t2 );
+      __m128d u1 = _mm_sub_pd( t0, t2 );
+      __m128d u2 = _mm_add_pd( t1, t3 );
+      __m128d d  = _mm_sub_pd( t1, t3 );
+      __m128d u3 = _mm_mul_pd( _mm_shuffle_pd( d, d, 1 ), rotate );
+      
+      _mm_storeu_pd( f0 + 2 * k, _mm_add_pd( u0, u2 ) );
+      _mm_storeu_pd( f2 + 2 * k, _mm_add_pd( u1, u3 ) );
+      _mm_storeu_pd( f1 + 2 * k, _mm_sub_pd( u0, u2 ) );
+      _mm_storeu_pd( f3 + 2 * k, _mm_sub_pd( u1, u3 ) );
+    }
+  }
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_radix_4_sse2  (
+                           csignal_fft_plan* in_plan,
+                           FLOAT64*          io_data,
+                           CHAR              in_sign
+                           )
+{
+  USIZE n = in_plan->fft_length;
+  USIZE h = 1;
+  
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    csignal_fft_radix_2_pass_sse2( n, io_data );
+    
+    h = 2;
+  }
+  
+  for( ; h < n; h <<= 2 )
+  {
+    csignal_fft_radix_4_pass_sse2( in_plan, io_data, h, in_sign );
+  }
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_radix_2_pass_sse2_float32 (
+                                       USIZE    in_fft_length,
+                                       FLOAT32* io_data
+                                       )
+{
+  for( USIZE i = 0; i < 2 * in_fft_length; i += 4 )
+  {
+    //  ( a, b ) -> ( a + b, a - b )
+    __m128 x        = _mm_loadu_ps( io_data + i );
+    __m128 swapped  = _mm_shuffle_ps( x, x, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    
+    _mm_storeu_ps (
+                   io_data + i,
+                   _mm_shuffle_ps (
+                                   _mm_add_ps( x, swapped ),
+                                   _mm_sub_ps( swapped, x ),
+                                   _MM_SHUFFLE( 3, 2, 1, 0 )
+                                   )
+                   );
+  }
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_radix_4_first_pass_sse2_float32 (
+                                             USIZE    in_fft_length,
+                                             FLOAT32* io_data,
+                                             CHAR     in_sign
+                                             )
+{
+  FLOAT32 sign = ( in_sign * 1.0f );
+  
+  //  Multiplies the high complex value by W_4 = sign * i after swapping it
+  __m128 rotate = _mm_set_ps( sign, -1.0f * sign, 1.0f, 1.0f );
+  
+  for( USIZE i = 0; i < 2 * in_fft_length; i += 8 )
+  {
+    //  The block is stored as f0, f2, f1, f3
+    __m128 x02  = _mm_loadu_ps( io_data + i );
+    __m128 x13  = _mm_loadu_ps( io_data + i + 4 );
+    __m128 s02  = _mm_shuffle_ps( x02, x02, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    __m128 s13  = _mm_shuffle_ps( x13, x13, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    
+    //  ( u0, u1 ) and ( u2, t1 - t3 )
+    __m128 u01  =
+      _mm_shuffle_ps  (
+                       _mm_add_ps( x02, s02 ),
+                       _mm_sub_ps( s02, x02 ),
+                       _MM_SHUFFLE( 3, 2, 1, 0 )
+                       );
+    __m128 u23  =
+      _mm_shuffle_ps  (
+                       _mm_add_ps( x13, s13 ),
+                       _mm_sub_ps( s13, x13 ),
+                       _MM_SHUFFLE( 2, 3, 1, 0 )
+                       );
+    
+    u23 = _mm_mul_ps( u23, rotate );
+    
+    _mm_storeu_ps( io_data + i, _mm_add_ps( u01, u23 ) );
+    _mm_storeu_ps( io_data + i + 4, _mm_sub_ps( u01, u23 ) );
+  }
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_radix_4_pass_sse2_float32 (
+                                       csignal_fft_plan_float32* in_plan,
+                                       FLOAT32*                  io_data,
+                                       USIZE                     in_h,
+                                       CHAR                      in_sign
+                                       )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT32* twiddles = in_plan->twiddles;
+  FLOAT32 sign      = ( in_sign * 1.0f );
+  USIZE stride      = n / ( 4 * in_h );
+  
+  //  _mm_set_ps takes the highest lane first
+  __m128 conjugate  = _mm_set_ps( sign, 1.0f, sign, 1.0f );
+  __m128 negate     = _mm_set_ps( 0.0f, -0.0f, 0.0f, -0.0f );
+  __m128 rotate     = _mm_set_ps( sign, -1.0f * sign, sign, -1.0f * sign );
+  __m128 zero       = _mm_setzero_ps();
+  
+  for( USIZE block = 0; block < n; block += 4 * in_h )
+  {
+    FLOAT32* f0 = io_data + 2 * block;
+    FLOAT32* f2 = f0 + 2 * in_h;
+    FLOAT32* f1 = f2 + 2 * in_h;
+    FLOAT32* f3 = f1 + 2 * in_h;
+    
+    for( USIZE k = 0; k < in_h; k += 2 )
+    {
+      //  the twiddles for k and k + 1 are stride apart in the table
+      __m128 w1 =
+        _mm_loadh_pi  (
+                       _mm_loadl_pi (
+                                     zero,
+                                     ( __m64* ) ( twiddles + 2 * k * stride )
+                                     ),
+                       ( __m64* ) ( twiddles + 2 * ( k + 1 ) * stride )
+                       );
+      __m128 w2 =
+        _mm_loadh_pi  (
+                       _mm_loadl_pi (
+                                     zero,
+                                     ( __m64* ) ( twiddles + 4 * k * stride )
+                                     ),
+                       ( __m64* ) ( twiddles + 4 * ( k + 1 ) * stride )
+                       );
+      __m128 w3 =
+        _mm_loadh_pi  (
+                       _mm_loadl_pi (
+                                     zero,
+                                     ( __m64* ) ( twiddles + 6 * k * stride )
+                                     ),
+                       ( __m64* ) ( twiddles + 6 * ( k + 1 ) * stride )
+                       );
+      
+      __m128 x1 = _mm_loadu_ps( f1 + 2 * k );
+      __m128 x2 = _mm_loadu_ps( f2 + 2 * k );
+      __m128 x3 = _mm_loadu_ps( f3 + 2 * k );
+      
+      __m128 t0 = _mm_loadu_ps( f0 + 2 * k );
+      __m128 t1;
+      __m128 t2;
+      __m128 t3;
+      
+      w1 = _mm_mul_ps( w1, conjugate );
+      w2 = _mm_mul_ps( w2, conjugate );
+      w3 = _mm_mul_ps( w3, conjugate );
+      
+      //  ( xr, xi ) * ( wr, wi ) = ( xr wr, xi wr ) + ( -xi wi, xr wi ), the
+      //  shuffles 0xA0, 0xF5 and 0xB1 duplicate the real components, duplicate
+      //  the imaginary components and swap the components of each value
+      t1 =
+        _mm_add_ps  (
+                     _mm_mul_ps( x1, _mm_shuffle_ps( w1, w1, 0xA0 ) ),
+                     _mm_xor_ps (
+                                 _mm_mul_ps (
+                                             _mm_shuffle_ps( x1, x1, 0xB1 ),
+                                             _mm_shuffle_ps( w1, w1, 0xF5 )
+                                             ),
+                                 negate
+                                 )
+                     );
+      t2 =
+        _mm_add_ps  (
+                     _mm_mul_ps( x2, _mm_shuffle_ps( w2, w2, 0xA0 ) ),
+                     _mm_xor_ps (
+                                 _mm_mul_ps (
+                                             _mm_shuffle_ps( x2, x2, 0xB1 ),
+                                             _mm_shuffle_ps( w2, w2, 0xF5 )
+                                             ),
+                                 negate
+                                 )
+                     );
+      t3 =
+        _mm_add_ps  (
+                     _mm_mul_ps( x3, _mm_shuffle_ps( w3, w3, 0xA0 ) ),
+                     _mm_xor_ps (
+                                 _mm_mul_ps (
+                                             _mm_shuffle_ps( x3, x3, 0xB1 ),
+                                             _mm_shuffle_ps( w3, w3, 0xF5 )
+                                             ),
+                                 negate
+                                 )
+                     );
+      
+      __m128 u0 = _mm_add_ps( t0, t2 );
+      __m128 u1 = _mm_sub_ps( t0, t2 );
+      __m128 u2 = _mm_add_ps( t1, t3 );
+      __m128 d  = _mm_sub_ps( t1, t3 );
+      __m128 u3 =
+        _mm_mul_ps( _mm_shuffle_ps( d, d, 0xB1 ), rotate );
+      
+      _mm_storeu_ps( f0 + 2 * k, _mm_add_ps( u0, u2 ) );
+      _mm_storeu_ps( f2 + 2 * k, _mm_add_ps( u1, u3 ) );
+      _mm_storeu_ps( f1 + 2 * k, _mm_sub_ps( u0, u2 ) );
+      _mm_storeu_ps( f3 + 2 * k, _mm_sub_ps( u1, u3 ) );
+    }
+  }
+}
+
+CSIGNAL_TARGET_SSE2 void
+csignal_fft_radix_4_sse2_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   CHAR                      in_sign
+                                   )
+{
+  USIZE n = in_plan->fft_length;
+  USIZE h = 1;
+  
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    csignal_fft_radix_2_pass_sse2_float32( n, io_data );
+    
+    h = 2;
+  }
+  else if( 1 < n )
+  {
+    csignal_fft_radix_4_first_pass_sse2_float32( n, io_data, in_sign );
+    
+    h = 4;
+  }
+  
+  for( ; h < n; h <<= 2 )
+  {
+    csignal_fft_radix_4_pass_sse2_float32( in_plan, io_data, h, in_sign );
+  }
+}
+
+#endif
+
+#ifdef CSIGNAL_FFT_AVX2
+
+CSIGNAL_TARGET_AVX2 void
+csignal_fft_radix_4_avx2  (
+                           csignal_fft_plan* in_plan,
+                           FLOAT64*          io_data,
+                           CHAR              in_sign
+                           )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT64* twiddles = in_plan->twiddles;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  USIZE h           = 1;
+  
+  __m256d conjugate = _mm256_set_pd( sign, 1.0, sign, 1.0 );
+  __m256d rotate    = _mm256_set_pd( sign, -1.0 * sign, sign, -1.0 * sign );
+  
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    csignal_fft_radix_2_pass_sse2( n, io_data );
+    
+    h = 2;
+  }
+  else if( 1 < n )
+  {
+    csignal_fft_radix_4_pass_sse2( in_plan, io_data, h, in_sign );
+    
+    h = 4;
+  }
+  
+  for( ; h < n; h <<= 2 )
+  {
+    USIZE stride = n / ( 4 * h );
+    
+    for( USIZE block = 0; block < n; block += 4 * h )
+    {
+      FLOAT64* f0 = io_data + 2 * block;
+      FLOAT64* f2 = f0 + 2 * h;
+      FLOAT64* f1 = f2 + 2 * h;
+      FLOAT64* f3 = f1 + 2 * h;
+      
+      for( USIZE k = 0; k < h; k += 2 )
+      {
+        //  the twiddles for k and k + 1 are stride apart in the table
+        __m256d w1 =
+          _mm256_insertf128_pd  (
+                  _mm256_castpd128_pd256  (
+                                           _mm_loadu_pd( twiddles + 2 * k * stride )
+                                           ),
+                  _mm_loadu_pd( twiddles + 2 * ( k + 1 ) * stride ),
+                  1
+                                 );
+        __m256d w2 =
+          _mm256_insertf128_pd  (
+                  _mm256_castpd128_pd256  (
+                                           _mm_loadu_pd( twiddles + 4 * k * stride )
+                                           ),
+                  _mm_loadu_pd( twiddles + 4 * ( k + 1 ) * stride ),
+                  1
+                                 );
+        __m256d w3 =
+          _mm256_insertf128_pd  (
+                  _mm256_castpd128_pd256  (
+                                           _mm_loadu_pd( twiddles + 6 * k * stride )
+                                           ),
+                  _mm_loadu_pd( twiddles + 6 * ( k + 1 ) * stride ),
+                  1
+                                 );
+        
+        __m256d x1 = _mm256_loadu_pd( f1 + 2 * k );
+        __m256d x2 = _mm256_loadu_pd( f2 + 2 * k );
+        __m256d x3 = _mm256_loadu_pd( f3 + 2 * k );
+        
+        __m256d t0 = _mm256_loadu_pd( f0 + 2 * k );
+        __m256d t1;
+        __m256d t2;
+        __m256d t3;
+        
+        w1 = _mm256_mul_pd( w1, conjugate );
+        w2 = _mm256_mul_pd( w2, conjugate );
+        w3 = _mm256_mul_pd( w3, conjugate );
+        
+        //  ( xr, xi ) * ( wr, wi ) = ( xr wr - xi wi, xi wr + xr wi )
+        t1 =
+          _mm256_fmaddsub_pd  (
+                               x1,
+                               _mm256_movedup_pd( w1 ),
+                               _mm256_mul_pd  (
+                                               _mm256_permute_pd( x1, 0x5 ),
+                                               _mm256_permute_pd( w1, 0xF )
+                                               )
+                               );
+        t2 =
+          _mm256_fmaddsub_pd  (
+                               x2,
+                               _mm256_movedup_pd( w2 ),
+                               _mm256_mul_pd  (
+                                               _mm256_permute_pd( x2, 0x5 ),
+                                               _mm256_permute_pd( w2, 0xF )
+                                               )
+                               );
+        t3 =
+          _mm256_fmaddsub_pd  (
+                               x3,
+                               _mm256_movedup_pd( w3 ),
+                               _mm256_mul_pd  (
+                                               _mm256_permute_pd( x3, 0x5 ),
+                                               _mm256_permute_pd( w3, 0xF )
+                                               )
+                               );
+        
+        __m256d u0 = _mm256_add_pd( t0, t2 );
+        __m256d u1 = _mm256_sub_pd( t0, t2 );
+        __m256d u2 = _mm256_add_pd( t1, t3 );
+        __m256d u3 =
+          _mm256_mul_pd (
+                         _mm256_permute_pd( _mm256_sub_pd( t1, t3 ), 0x5 ),
+                         rotate
+                         );
+        
+        _mm256_storeu_pd( f0 + 2 * k, _mm256_add_pd( u0, u2 ) );
+        _mm256_storeu_pd( f2 + 2 * k, _mm256_add_pd( u1, u3 ) );
+        _mm256_storeu_pd( f1 + 2 * k, _mm256_sub_pd( u0, u2 ) );
+        _mm256_storeu_pd( f3 + 2 * k, _mm256_sub_pd( u1, u3 ) );
+      }
+    }
+  }
+}
+
+CSIGNAL_TARGET_AVX2 void
+csignal_fft_radix_4_avx2_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   CHAR                      in_sign
+                                   )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT32 sign      = ( in_sign * 1.0f );
+  USIZE h           = 1;
+  
+  //  A FLOAT32 complex value is 64 bits, so the twiddle table is read as an
+  //  array of doubles to load a complex value with a single move. Four scalar
+  //  loads were measured to be faster than _mm256_i64gather_pd.
+  FLOAT64* table    = ( FLOAT64* ) in_plan->twiddles;
+  
+  __m256 conjugate  =
+    _mm256_set_ps( sign, 1.0f, sign, 1.0f, sign, 1.0f, sign, 1.0f );
+  __m256 rotate     =
+    _mm256_set_ps (
+                   sign,
+                   -1.0f * sign,
+                   sign,
+                   -1.0f * sign,
+                   sign,
+                   -1.0f * sign,
+                   sign,
+                   -1.0f * sign
+                   );
+  
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    csignal_fft_radix_2_pass_sse2_float32( n, io_data );
+    
+    h = 2;
+    
+    if( h < n )
+    {
+      csignal_fft_radix_4_pass_sse2_float32( in_plan, io_data, h, in_sign );
+      
+      h = 8;
+    }
+  }
+  else if( 1 < n )
+  {
+    csignal_fft_radix_4_first_pass_sse2_float32( n, io_data, in_sign );
+    
+    h = 4;
+  }
+  
+  for( ; h < n; h <<= 2 )
+  {
+    USIZE stride = n / ( 4 * h );
+    
+    for( USIZE block = 0; block < n; block += 4 * h )
+    {
+      FLOAT32* f0 = io_data + 2 * block;
+      FLOAT32* f2 = f0 + 2 * h;
+      FLOAT32* f1 = f2 + 2 * h;
+      FLOAT32* f3 = f1 + 2 * h;
+      
+      for( USIZE k = 0; k < h; k += 4 )
+      {
+        //  the twiddles for k to k + 3 are stride apart in the table
+        __m256 w1 =
+          _mm256_castpd_ps  (
+                             _mm256_set_pd  (
+                                             table[ ( k + 3 ) * stride ],
+                                             table[ ( k + 2 ) * stride ],
+                                             table[ ( k + 1 ) * stride ],
+                                             table[ k * stride ]
+                                             )
+                             );
+        __m256 w2 =
+          _mm256_castpd_ps  (
+                             _mm256_set_pd  (
+                                             table[ 2 * ( k + 3 ) * stride ],
+                                             table[ 2 * ( k + 2 ) * stride ],
+                                             table[ 2 * ( k + 1 ) * stride ],
+                                             table[ 2 * k * stride ]
+                                             )
+                             );
+        __m256 w3 =
+          _mm256_castpd_ps  (
+                             _mm256_set_pd  (
+                                             table[ 3 * ( k + 3 ) * stride ],
+                                             table[ 3 * ( k + 2 ) * stride ],
+                                             table[ 3 * ( k + 1 ) * stride ],
+                                             table[ 3 * k * stride ]
+                                             )
+                             );
+        
+        __m256 x1 = _mm256_loadu_ps( f1 + 2 * k );
+        __m256 x2 = _mm256_loadu_ps( f2 + 2 * k );
+        __m256 x3 = _mm256_loadu_ps( f3 + 2 * k );
+        
+        __m256 t0 = _mm256_loadu_ps( f0 + 2 * k );
+        __m256 t1;
+        __m256 t2;
+        __m256 t3;
+        
+        w1 = _mm256_mul_ps( w1, conjugate );
+        w2 = _mm256_mul_ps( w2, conjugate );
+        w3 = _mm256_mul_ps( w3, conjugate );
+        
+        //  ( xr, xi ) * ( wr, wi ) = ( xr wr - xi wi, xi wr + xr wi )
+        t1 =
+          _mm256_fmaddsub_ps  (
+                               x1,
+                               _mm256_moveldup_ps( w1 ),
+                               _mm256_mul_ps  (
+                                               _mm256_permute_ps( x1, 0xB1 ),
+                                               _mm256_movehdup_ps( w1 )
+                                               )
+                               );
+        t2 =
+          _mm256_fmaddsub_ps  (
+                               x2,
+                               _mm256_moveldup_ps( w2 ),
+                               _mm256_mul_ps  (
+                                               _mm256_permute_ps( x2, 0xB1 ),
+                                               _mm256_movehdup_ps( w2 )
+                                               )
+                               );
+        t3 =
+          _mm256_fmaddsub_ps  (
+                               x3,
+                               _mm256_moveldup_ps( w3 ),
+                               _mm256_mul_ps  (
+                                               _mm256_permute_ps( x3, 0xB1 ),
+                                               _mm256_movehdup_ps( w3 )
+                                               )
+                               );
+        
+        __m256 u0 = _mm256_add_ps( t0, t2 );
+        __m256 u1 = _mm256_sub_ps( t0, t2 );
+        __m256 u2 = _mm256_add_ps( t1, t3 );
+        __m256 u3 =
+          _mm256_mul_ps (
+                         _mm256_permute_ps( _mm256_sub_ps( t1, t3 ), 0xB1 ),
+                         rotate
+                         );
+        
+        _mm256_storeu_ps( f0 + 2 * k, _mm256_add_ps( u0, u2 ) );
+        _mm256_storeu_ps( f2 + 2 * k, _mm256_add_ps( u1, u3 ) );
+        _mm256_storeu_ps( f1 + 2 * k, _mm256_sub_ps( u0, u2 ) );
+        _mm256_storeu_ps( f3 + 2 * k, _mm256_sub_ps( u1, u3 ) );
+      }
+    }
+  }
+}
+
+#endif
+
+#ifdef CSIGNAL_FFT_NEON
+
+void
+csignal_fft_bit_reverse_neon  (
+                               csignal_fft_plan* in_plan,
+                               FLOAT64*          io_data
+                               )
+{
+  USIZE n         = in_plan->fft_length;
+  USIZE* reversal = in_plan->bit_reversal;
+  
+  for( USIZE i = 0; i < n; i++ )
+  {
+    USIZE j = reversal[ i ];
+    
+    if( j > i )
+    {
+      float64x2_t temp = vld1q_f64( io_data + 2 * i );
+      
+      vst1q_f64( io_data + 2 * i, vld1q_f64( io_data + 2 * j ) );
+      vst1q_f64( io_data + 2 * j, temp );
+    }
+  }
+}
+
+void
+csignal_fft_radix_4_neon  (
+                           csignal_fft_plan* in_plan,
+                           FLOAT64*          io_data,
+                           CHAR              in_sign
+                           )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT64* twiddles = in_plan->twiddles;
+  FLOAT64 sign      = ( in_sign * 1.0 );
+  USIZE h           = 1;
+  
+  FLOAT64 rotate_values[ 2 ] = { -1.0 * sign, sign };
+  
+  float64x2_t rotate = vld1q_f64( rotate_values );
+  
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    for( USIZE i = 0; i < 2 * n; i += 4 )
+    {
+      float64x2_t a = vld1q_f64( io_data + i );
+      float64x2_t b = vld1q_f64( io_data + i + 2 );
+      
+      vst1q_f64( io_data + i, vaddq_f64( a, b ) );
+      vst1q_f64( io_data + i + 2, vsubq_f64( a, b ) );
+    }
+    
+    h = 2;
+  }
+  
+  for( ; h < n; h <<= 2 )
+  {
+    USIZE stride = n / ( 4 * h );
+    
+    for( USIZE block = 0; block < n; block += 4 * h )
+    {
+      FLOAT64* f0 = io_data + 2 * block;
+      FLOAT64* f2 = f0 + 2 * h;
+      FLOAT64* f1 = f2 + 2 * h;
+      FLOAT64* f3 = f1 + 2 * h;
+      
+      for( USIZE k = 0; k < h; k++ )
+      {
+        FLOAT64* w1 = twiddles + 2 * k * stride;
+        FLOAT64* w2 = twiddles + 4 * k * stride;
+        FLOAT64* w3 = twiddles + 6 * k * stride;
+        
+        //  ( -wi, wi ) multiplies the swapped input ( xi, xr )
+        FLOAT64 w1i_values[ 2 ] = { -1.0 * sign * w1[ 1 ], sign * w1[ 1 ] };
+        FLOAT64 w2i_values[ 2 ] = { -1.0 * sign * w2[ 1 ], sign * w2[ 1 ] };
+        FLOAT64 w3i_values[ 2 ] = { -1.0 * sign * w3[ 1 ], sign * w3[ 1 ] };
+        
+        float64x2_t x1 = vld1q_f64( f1 + 2 * k );
+        float64x2_t x2 = vld1q_f64( f2 + 2 * k );
+        float64x2_t x3 = vld1q_f64( f3 + 2 * k );
+        
+        float64x2_t t0 = vld1q_f64( f0 + 2 * k );
+        float64x2_t t1 =
+          vfmaq_f64 (
+                     vmulq_n_f64( x1, w1[ 0 ] ),
+                     vextq_f64( x1, x1, 1 ),
+                     vld1q_f64( w1i_values )
+                     );
+        float64x2_t t2 =
+          vfmaq_f64 (
+                     vmulq_n_f64( x2, w2[ 0 ] ),
+                     vextq_f64( x2, x2, 1 ),
+                     vld1q_f64( w2i_values )
+                     );
+        float64x2_t t3 =
+          vfmaq_f64 (
+                     vmulq_n_f64( x3, w3[ 0 ] ),
+                     vextq_f64( x3, x3, 1 ),
+                     vld1q_f64( w3i_values )
+                     );
+        
+        float64x2_t u0 = vaddq_f64( t0, t2 );
+        float64x2_t u1 = vsubq_f64( t0, t2 );
+        float64x2_t u2 = vaddq_f64( t1, t3 );
+        float64x2_t d  = vsubq_f64( t1, t3 );
+        float64x2_t u3 = vmulq_f64( vextq_f64( d, d, 1 ), rotate );
+        
+        vst1q_f64( f0 + 2 * k, vaddq_f64( u0, u2 ) );
+        vst1q_f64( f2 + 2 * k, vaddq_f64( u1, u3 ) );
+        vst1q_f64( f1 + 2 * k, vsubq_f64( u0, u2 ) );
+        vst1q_f64( f3 + 2 * k, vsubq_f64( u1, u3 ) );
+      }
+    }
+  }
+}
+
+void
+csignal_fft_radix_4_neon_float32  (
+                                   csignal_fft_plan_float32* in_plan,
+                                   FLOAT32*                  io_data,
+                                   CHAR                      in_sign
+                                   )
+{
+  USIZE n           = in_plan->fft_length;
+  FLOAT32* twiddles = in_plan->twiddles;
+  FLOAT32 sign      = ( in_sign * 1.0f );
+  USIZE h           = 1;
+  
+  FLOAT32 conjugate_values[ 4 ] = { 1.0f, sign, 1.0f, sign };
+  FLOAT32 negate_values[ 4 ]    = { -1.0f, 1.0f, -1.0f, 1.0f };
+  FLOAT32 rotate_values[ 4 ]    =
+    { -1.0f * sign, sign, -1.0f * sign, sign };
+  
+  float32x4_t conjugate = vld1q_f32( conjugate_values );
+  float32x4_t negate    = vld1q_f32( negate_values );
+  float32x4_t rotate    = vld1q_f32( rotate_values );
+  
+  if( 1 == ( csignal_fft_number_of_passes( n ) % 2 ) )
+  {
+    csignal_fft_radix_2_pass_float32( n, io_data );
+    
+    h = 2;
+  }
+  else if( 1 < n )
+  {
+    csignal_fft_radix_4_pass_float32( in_plan, io_data, h, in_sign );
+    
+    h = 4;
+  }
+  
+  for( ; h < n; h <<= 2 )
+  {
+    USIZE stride = n / ( 4 * h );
+    
+    for( USIZE block = 0; block < n; block += 4 * h )
+    {
+      FLOAT32* f0 = io_data + 2 * block;
+      FLOAT32* f2 = f0 + 2 * h;
+      FLOAT32* f1 = f2 + 2 * h;
+      FLOAT32* f3 = f1 + 2 * h;
+      
+      for( USIZE k = 0; k < h; k += 2 )
+      {
+        //  the twiddles for k and k + 1 are stride apart in the table
+        float32x4_t w1 =
+          vcombine_f32  (
+                         vld1_f32( twiddles + 2 * k * stride ),
+                         vld1_f32( twiddles + 2 * ( k + 1 ) * stride )
+                         );
+        float32x4_t w2 =
+          vcombine_f32  (
+                         vld1_f32( twiddles + 4 * k * stride ),
+                         vld1_f32( twiddles + 4 * ( k + 1 ) * stride )
+                         );
+        float32x4_t w3 =
+          vcombine_f32  (
+                         vld1_f32( twiddles + 6 * k * stride ),
+                         vld1_f32( twiddles + 6 * ( k + 1 ) * stride )
+                         );
+        
+        float32x4_t x1 = vld1q_f32( f1 + 2 * k );
+        float32x4_t x2 = vld1q_f32( f2 + 2 * k );
+        float32x4_t x3 = vld1q_f32( f3 + 2 * k );
+        
+        float32x4_t t0 = vld1q_f32( f0 + 2 * k );
+        float32x4_t t1;
+        float32x4_t t2;
+        float32x4_t t3;
+        
+        w1 = vmulq_f32( w1, conjugate );
+        w2 = vmulq_f32( w2, conjugate );
+        w3 = vmulq_f32( w3, conjugate );
+        
+        //  ( xr, xi ) * ( wr, wi ) = ( xr wr, xi wr ) + ( -xi wi, xr wi ),
+        //  vtrn1q/vtrn2q duplicate the real/imaginary components and vrev64q
+        //  swaps the components of each value
+        t1 =
+          vfmaq_f32 (
+                     vmulq_f32( x1, vtrn1q_f32( w1, w1 ) ),
+                     vmulq_f32( vrev64q_f32( x1 ), negate ),
+                     vtrn2q_f32( w1, w1 )
+                     );
+        t2 =
+          vfmaq_f32 (
+                     vmulq_f32( x2, vtrn1q_f32( w2, w2 ) ),
+                     vmulq_f32( vrev64q_f32( x2 ), negate ),
+                     vtrn2q_f32( w2, w2 )
+                     );
+        t3 =
+          vfmaq_f32 (
+                     vmulq_f32( x3, vtrn1q_f32( w3, w3 ) ),
+                     vmulq_f32( vrev64q_f32( x3 ), negate ),
+                     vtrn2q_f32( w3, w3 )
+                     );
+        
+        float32x4_t u0 = vaddq_f32( t0, t2 );
+        float32x4_t u1 = vsubq_f32( t0, t2 );
+        float32x4_t u2 = vaddq_f32( t1, t3 );
+        float32x4_t u3 =
+          vmulq_f32( vrev64q_f32( vsubq_f32( t1, t3 ) ), rotate );
+        
+        vst1q_f32( f0 + 2 * k, vaddq_f32( u0, u2 ) );
+        vst1q_f32( f2 + 2 * k, vaddq_f32( u1, u3 ) );
+        vst1q_f32( f1 + 2 * k, vsubq_f32( u0, u2 ) );
+        vst1q_f32( f3 + 2 * k, vsubq_f32( u1, u3 ) );
+      }
+    }
+  }
+}
+
+#endif
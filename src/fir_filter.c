@@ -6,6 +6,8 @@
  */
 #include "fir_filter.h"
 
+#include "conv_kernels.h"
+
 csignal_error_code
 csignal_initialize_passband_filter (
                                     FLOAT32               in_first_passband,
@@ -54,6 +56,7 @@ csignal_initialize_passband_filter (
       out_filter->first_passband  = in_first_passband;
       out_filter->second_passband = in_second_passband;
       out_filter->number_of_taps  = in_number_of_taps;
+      out_filter->symmetric       = CPC_FALSE;
     }
     else
     {
@@ -102,6 +105,52 @@ csignal_filter_signal (
                        USIZE*               out_filtered_signal_length,
                        FLOAT64**            out_filtered_signal
                        )
+{
+  return  (
+           csignal_filter_with_mode (
+                                     in_filter,
+                                     CSIGNAL_CONVOLUTION_MODE_FULL,
+                                     in_signal_length,
+                                     in_signal,
+                                     out_filtered_signal_length,
+                                     out_filtered_signal
+                                     )
+           );
+}
+
+csignal_error_code
+csignal_filter_with_mode  (
+                           fir_passband_filter*     in_filter,
+                           csignal_convolution_mode in_mode,
+                           USIZE                    in_signal_length,
+                           FLOAT64*                 in_signal,
+                           USIZE*                   out_filtered_signal_length,
+                           FLOAT64**                out_filtered_signal
+                           )
+{
+  return  (
+           csignal_filter_decimated (
+                                     in_filter,
+                                     in_mode,
+                                     1,
+                                     in_signal_length,
+                                     in_signal,
+                                     out_filtered_signal_length,
+                                     out_filtered_signal
+                                     )
+           );
+}
+
+csignal_error_code
+csignal_filter_decimated  (
+                           fir_passband_filter*     in_filter,
+                           csignal_convolution_mode in_mode,
+                           USIZE                    in_decimation,
+                           USIZE                    in_signal_length,
+                           FLOAT64*                 in_signal,
+                           USIZE*                   out_filtered_signal_length,
+                           FLOAT64**                out_filtered_signal
+                           )
 {
   csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
   
@@ -139,15 +188,37 @@ csignal_filter_signal (
   }
   else
   {
-    return_value =
-      convolve  (
-                 in_signal_length,
-                 in_signal,
-                 in_filter->number_of_taps,
-                 in_filter->coefficients,
-                 out_filtered_signal_length,
-                 out_filtered_signal
-                 );
+    //  Linear-phase filters take the folded kernels
+    if( in_filter->symmetric )
+    {
+      return_value =
+        convolve_symmetric  (
+                             in_signal_length,
+                             in_signal,
+                             in_filter->number_of_taps,
+                             in_filter->coefficients,
+                             in_mode,
+                             CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC,
+                             in_decimation,
+                             out_filtered_signal_length,
+                             out_filtered_signal
+                             );
+    }
+    else
+    {
+      return_value =
+        convolve_decimated  (
+                             in_signal_length,
+                             in_signal,
+                             in_filter->number_of_taps,
+                             in_filter->coefficients,
+                             in_mode,
+                             CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC,
+                             in_decimation,
+                             out_filtered_signal_length,
+                             out_filtered_signal
+                             );
+    }
   }
   
   return( return_value );
@@ -210,3 +281,291 @@ csignal_filter_get_filter_length  (
   
   return( return_value );
 }
+
+csignal_error_code
+csignal_initialize_fir_filter_state  (
+                                      fir_passband_filter*  in_filter,
+                                      fir_filter_state**    out_state
+                                      )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == in_filter
+       || NULL == in_filter->coefficients
+       || NULL == out_state
+       )
+  {
+    CPC_ERROR (
+               "Filter (0x%x), its coefficients, or state (0x%x) are null.",
+               in_filter,
+               out_state
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_filter->number_of_taps )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Filter must have taps." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_state = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_state, sizeof( fir_filter_state ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      fir_filter_state* state = *out_state;
+      
+      state->filter             = in_filter;
+      state->delay_line_length  =
+        in_filter->number_of_taps - 1
+        + CSIGNAL_FIR_FILTER_STATE_SEGMENT_LENGTH;
+      state->delay_line         = NULL;
+      state->position           = 0;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( state->delay_line ),
+                         sizeof( FLOAT64 ) * 2 * state->delay_line_length
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value = csignal_reset_fir_filter_state( state );
+      }
+      else
+      {
+        CPC_ERROR( "Could not malloc delay line: 0x%x.", return_value );
+        
+        cpc_safe_free( ( void** ) out_state );
+        
+        *out_state = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc filter state: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_fir_filter_state (
+                                  fir_filter_state* io_state
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_state )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "State is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_state->delay_line )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_state->delay_line ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_state );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_reset_fir_filter_state (
+                                fir_filter_state* io_state
+                                )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_state || NULL == io_state->delay_line )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "State or delay line are null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    for( USIZE i = 0; i < 2 * io_state->delay_line_length; i++ )
+    {
+      io_state->delay_line[ i ] = 0.0;
+    }
+    
+    io_state->position = 0;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_fir_filter_state_process (
+                                  fir_filter_state* io_state,
+                                  USIZE             in_number_of_samples,
+                                  FLOAT64*          in_samples,
+                                  FLOAT64*          out_samples
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == io_state
+       || NULL == io_state->delay_line
+       || NULL == in_samples
+       || NULL == out_samples
+       )
+  {
+    CPC_ERROR (
+               "State (0x%x), input (0x%x), or output (0x%x) are null.",
+               io_state,
+               in_samples,
+               out_samples
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    USIZE number_of_taps  = io_state->filter->number_of_taps;
+    USIZE length          = io_state->delay_line_length;
+    USIZE segment_length  = length - number_of_taps + 1;
+    
+    FLOAT64* delay_line = io_state->delay_line;
+    
+    USIZE offset = 0;
+    
+    while  (
+            offset < in_number_of_samples
+            && CPC_ERROR_CODE_NO_ERROR == return_value
+            )
+    {
+      USIZE count =
+        CPC_MIN( USIZE, segment_length, in_number_of_samples - offset );
+      
+      return_value =
+        csignal_fir_filter_state_push (
+                                       io_state,
+                                       count,
+                                       in_samples + offset
+                                       );
+      
+      //  The newest sample is at position + length - 1 in the second half,
+      //  preceded by at least number_of_taps - 1 + segment_length - count
+      //  older samples, so every output is in the interior of the
+      //  convolution of the delay line with the taps
+      if( io_state->filter->symmetric )
+      {
+        csignal_conv_run_symmetric_kernel (
+                                           io_state->position + length,
+                                           delay_line,
+                                           number_of_taps,
+                                           io_state->filter->coefficients,
+                                           io_state->position + length - count,
+                                           1,
+                                           count,
+                                           out_samples + offset
+                                           );
+      }
+      else
+      {
+        csignal_conv_run_kernel (
+                                 io_state->position + length,
+                                 delay_line,
+                                 number_of_taps,
+                                 io_state->filter->coefficients,
+                                 io_state->position + length - count,
+                                 count,
+                                 out_samples + offset
+                                 );
+      }
+      
+      offset += count;
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_fir_filter_state_push (
+                               fir_filter_state* io_state,
+                               USIZE             in_number_of_samples,
+                               FLOAT64*          in_samples
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == io_state
+       || NULL == io_state->delay_line
+       || NULL == in_samples
+       )
+  {
+    CPC_ERROR (
+               "State (0x%x) or input (0x%x) are null.",
+               io_state,
+               in_samples
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_number_of_samples
+           > io_state->delay_line_length - io_state->filter->number_of_taps + 1
+           )
+  {
+    CPC_ERROR (
+               "Number of samples (%d) must be at most the segment length"
+               " (%d).",
+               in_number_of_samples,
+               io_state->delay_line_length
+               - io_state->filter->number_of_taps + 1
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    USIZE length    = io_state->delay_line_length;
+    USIZE position  = io_state->position;
+    USIZE count     = in_number_of_samples;
+    
+    USIZE before_wrap = CPC_MIN( USIZE, count, length - position );
+    
+    FLOAT64* delay_line = io_state->delay_line;
+    
+    //  Store the samples in both halves of the delay line, in two runs so
+    //  that the copy does not test for the wraparound either
+    for( USIZE i = 0; i < before_wrap; i++ )
+    {
+      delay_line[ position + i ]          = in_samples[ i ];
+      delay_line[ position + i + length ] = in_samples[ i ];
+    }
+    
+    for( USIZE i = before_wrap; i < count; i++ )
+    {
+      delay_line[ i - before_wrap ]           = in_samples[ i ];
+      delay_line[ i - before_wrap + length ]  = in_samples[ i ];
+    }
+    
+    io_state->position =
+      ( before_wrap < count || position + count == length )
+      ? count - before_wrap
+      : position + count;
+  }
+  
+  return( return_value );
+}
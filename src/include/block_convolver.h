@@ -0,0 +1,420 @@
+/*! \file   block_convolver.h
+    \brief  Streaming convolution of a signal with a fixed kernel.
+ 
+            A block convolver holds the FFT of the kernel and the part of the
+            stream that later outputs still depend on, so a signal can be
+            convolved in blocks of any size: every block of N input samples
+            produces the next N samples of the convolution, exactly the first
+            samples convolve would return for the whole signal. The tail of the
+            convolution is produced by adding kernel_length - 1 zeros.
+ 
+            The stream is processed in hops of fft_length - kernel_length + 1
+            samples, each calculated with one real-input FFT and one IFFT of
+            fft_length points:
+ 
+            - Overlap-save transforms the last kernel_length - 1 samples of the
+              previous hop together with the samples of the current hop and
+              keeps the outputs the circular convolution does not wrap into.
+            - Overlap-add transforms the samples of the current hop alone and
+              adds the last kernel_length - 1 outputs of the previous hops to
+              it.
+ 
+            Both give the same results. All buffers are allocated when the
+            convolver is created.
+ 
+            The FFT of a block convolver is longer than the kernel, so long
+            kernels need long blocks to be efficient. The FDL convolver splits
+            the kernel into partitions of a fixed length instead, which keeps
+            the FFT (and the efficient block size) short for kernels of tens of
+            thousands of samples, e.g., measured room or channel responses
+            that are applied in real time.
+ 
+    \author Brent Carrara
+ */
+#ifndef __BLOCK_CONVOLVER_H__
+#define __BLOCK_CONVOLVER_H__
+
+#include <cpcommon.h>
+
+#include "fft.h"
+
+#include "csignal_error_codes.h"
+
+/*! \enum   csignal_overlap_method
+    \brief  How a block convolver joins consecutive hops.
+ 
+ \var CSIGNAL_OVERLAP_SAVE
+      The transformed frames overlap by kernel_length - 1 input samples.
+ \var CSIGNAL_OVERLAP_ADD
+      The outputs of consecutive hops overlap by kernel_length - 1 samples.
+ */
+typedef enum csignal_overlap_method_t
+{
+  CSIGNAL_OVERLAP_SAVE = 0,
+  CSIGNAL_OVERLAP_ADD  = 1
+} csignal_overlap_method;
+
+/*! \var    csignal_block_convolver
+    \brief  The state of a streaming convolution.
+ */
+typedef struct csignal_block_convolver_t
+{
+  /*! \var    method
+      \brief  How consecutive hops are joined.
+   */
+  csignal_overlap_method  method;
+  
+  /*! \var    kernel_length
+      \brief  The number of samples in the kernel.
+   */
+  USIZE                   kernel_length;
+  
+  /*! \var    fft_length
+      \brief  The power of two length of the FFTs.
+   */
+  USIZE                   fft_length;
+  
+  /*! \var    hop_length
+      \brief  The number of input samples per FFT, i.e., fft_length -
+              kernel_length + 1.
+   */
+  USIZE                   hop_length;
+  
+  /*! \var    kernel_spectrum
+      \brief  The fft_length / 2 + 1 bins of the zero-padded kernel, stored as
+              interleaved real and imaginary components and pre-scaled by 1 /
+              fft_length.
+   */
+  FLOAT64*                kernel_spectrum;
+  
+  /*! \var    frame
+      \brief  fft_length samples of input. For overlap-save the first
+              kernel_length - 1 are the end of the previous hop and the
+              samples of the current hop follow; for overlap-add the frame
+              starts with the current hop. Samples after the current hop are
+              zero.
+   */
+  FLOAT64*                frame;
+  
+  /*! \var    overlap
+      \brief  For overlap-add, the fft_length outputs of the previous hops
+              that overlap the current hop and the ones after it; only the
+              first kernel_length - 1 can be non-zero. Unused for
+              overlap-save.
+   */
+  FLOAT64*                overlap;
+  
+  /*! \var    fft_buffer
+      \brief  fft_length + 2 elements holding a frame, its FFT and its
+              convolution.
+   */
+  FLOAT64*                fft_buffer;
+  
+  /*! \var    number_of_samples
+      \brief  The number of samples of the current hop that have been added.
+   */
+  USIZE                   number_of_samples;
+  
+  /*! \var    plan
+      \brief  The real-input FFT plan for fft_length samples. Owned by the
+              convolver so that convolvers can be used from different
+              threads.
+   */
+  csignal_real_fft_plan*  plan;
+  
+} csignal_block_convolver;
+
+/*! \fn     csignal_error_code csignal_initialize_block_convolver (
+              USIZE                     in_kernel_length,
+              FLOAT64*                  in_kernel,
+              USIZE                     in_fft_length,
+              csignal_overlap_method    in_method,
+              csignal_block_convolver** out_convolver
+            )
+    \brief  Creates a block convolver for in_kernel.
+ 
+    \param  in_kernel_length  The number of samples in in_kernel.
+    \param  in_kernel The kernel. It is copied into the convolver's spectrum,
+                      so the caller keeps ownership.
+    \param  in_fft_length The FFT length, which must be a power of two larger
+                          than or equal to in_kernel_length and at least 2.
+                          Blocks that end in the middle of a hop cost an extra
+                          FFT and IFFT, so a stream of short blocks is best
+                          served by a short FFT. If 0, twice the power of two
+                          that holds the kernel is used, which spends about as
+                          many operations per sample on the FFTs as on the
+                          products.
+    \param  in_method How consecutive hops are joined.
+    \param  out_convolver The newly created convolver. Must be freed by the
+                          caller using csignal_destroy_block_convolver.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_real_fft_plan and cpc_safe_malloc for more
+            error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_kernel or out_convolver are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_kernel_length is zero or
+                                              in_fft_length is invalid.
+            CSIGNAL_ERROR_CODE_INVALID_TYPE If in_method is not a method.
+ */
+csignal_error_code
+csignal_initialize_block_convolver  (
+                                     USIZE                     in_kernel_length,
+                                     FLOAT64*                  in_kernel,
+                                     USIZE                     in_fft_length,
+                                     csignal_overlap_method    in_method,
+                                     csignal_block_convolver** out_convolver
+                                     );
+
+/*! \fn     csignal_error_code csignal_destroy_block_convolver (
+              csignal_block_convolver* io_convolver
+            )
+    \brief  Frees the convolver and all of its buffers.
+ 
+    \param  io_convolver  The convolver to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_convolver is null.
+ */
+csignal_error_code
+csignal_destroy_block_convolver (
+                                 csignal_block_convolver* io_convolver
+                                 );
+
+/*! \fn     csignal_error_code csignal_reset_block_convolver (
+              csignal_block_convolver* io_convolver
+            )
+    \brief  Discards the state of the stream, i.e., the next sample processed
+            starts a new stream.
+ 
+    \param  io_convolver  The convolver to reset.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_convolver is null.
+ */
+csignal_error_code
+csignal_reset_block_convolver (
+                               csignal_block_convolver* io_convolver
+                               );
+
+/*! \fn     USIZE csignal_block_convolver_get_hop_length (
+              csignal_block_convolver* in_convolver
+            )
+    \brief  Returns the number of samples per FFT, or 0 if in_convolver is
+            null. Blocks that are multiples of it cost one FFT and one IFFT per
+            hop.
+ */
+USIZE
+csignal_block_convolver_get_hop_length  (
+                                         csignal_block_convolver* in_convolver
+                                         );
+
+/*! \fn     csignal_error_code csignal_block_convolver_process (
+              csignal_block_convolver* io_convolver,
+              USIZE                    in_number_of_samples,
+              FLOAT64*                 in_samples,
+              FLOAT64*                 out_samples
+            )
+    \brief  Convolves the next in_number_of_samples samples of the stream
+            with the kernel.
+ 
+    \param  io_convolver  The convolver.
+    \param  in_number_of_samples  The number of samples in in_samples and
+                                  out_samples.
+    \param  in_samples  The next samples of the stream.
+    \param  out_samples The next in_number_of_samples samples of the
+                        convolution. May be the same buffer as in_samples.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+ */
+csignal_error_code
+csignal_block_convolver_process (
+                                 csignal_block_convolver* io_convolver,
+                                 USIZE                    in_number_of_samples,
+                                 FLOAT64*                 in_samples,
+                                 FLOAT64*                 out_samples
+                                 );
+
+/*! \var    csignal_fdl_convolver
+    \brief  The state of a uniformly partitioned streaming convolution.
+ 
+            The kernel is cut into partitions of partition_length samples,
+            P = ceil( kernel_length / partition_length ) of them, whose FFTs
+            of 2 * partition_length points are calculated once. The input is
+            transformed in blocks of partition_length samples (overlap-save
+            with the previous block) and the spectra of the last P blocks are
+            kept in a frequency-domain delay line (FDL). Block j of the output
+            is the IFFT of sum_p X[ j - p ] H[ p ], so the FFT size, and with
+            it the block size needed for efficient processing, depends on
+            partition_length and not on the kernel length. The sum over the
+            older blocks is calculated once per block, so blocks that end in
+            the middle of a partition only add one FFT pair, like for the
+            csignal_block_convolver.
+ */
+typedef struct csignal_fdl_convolver_t
+{
+  /*! \var    kernel_length
+      \brief  The number of samples in the kernel.
+   */
+  USIZE                   kernel_length;
+  
+  /*! \var    partition_length
+      \brief  The number of kernel samples per partition and input samples
+              per block.
+   */
+  USIZE                   partition_length;
+  
+  /*! \var    number_of_partitions
+      \brief  The number of partitions P of the kernel.
+   */
+  USIZE                   number_of_partitions;
+  
+  /*! \var    partitions
+      \brief  The partition_length + 1 bins of the FFT of every partition,
+              zero-padded to 2 * partition_length points, stored one after the
+              other as interleaved real and imaginary components and
+              pre-scaled by 1 / ( 2 * partition_length ).
+   */
+  FLOAT64*                partitions;
+  
+  /*! \var    delay_line
+      \brief  The spectra of the P most recent complete input blocks, a ring
+              with the same layout as partitions.
+   */
+  FLOAT64*                delay_line;
+  
+  /*! \var    delay_line_index
+      \brief  The position in delay_line of the spectrum of the next block.
+   */
+  USIZE                   delay_line_index;
+  
+  /*! \var    accumulator
+      \brief  sum_{p>0} X[ j - p ] H[ p ] for the current block j.
+   */
+  FLOAT64*                accumulator;
+  
+  /*! \var    frame
+      \brief  2 * partition_length samples: the previous block followed by
+              the samples of the current block and zeros.
+   */
+  FLOAT64*                frame;
+  
+  /*! \var    fft_buffer
+      \brief  2 * partition_length + 2 elements holding a frame, its FFT and
+              its convolution.
+   */
+  FLOAT64*                fft_buffer;
+  
+  /*! \var    number_of_samples
+      \brief  The number of samples of the current block that have been
+              added.
+   */
+  USIZE                   number_of_samples;
+  
+  /*! \var    plan
+      \brief  The real-input FFT plan for 2 * partition_length samples. Owned
+              by the convolver so that convolvers can be used from different
+              threads.
+   */
+  csignal_real_fft_plan*  plan;
+  
+} csignal_fdl_convolver;
+
+/*! \fn     csignal_error_code csignal_initialize_fdl_convolver (
+              USIZE                   in_kernel_length,
+              FLOAT64*                in_kernel,
+              USIZE                   in_partition_length,
+              csignal_fdl_convolver** out_convolver
+            )
+    \brief  Creates a uniformly partitioned convolver for in_kernel.
+ 
+    \param  in_kernel_length  The number of samples in in_kernel.
+    \param  in_kernel The kernel. It is copied into the convolver's
+                      partitions, so the caller keeps ownership.
+    \param  in_partition_length The number of samples per partition, which
+                                must be a power of two. It is the block size
+                                at which the convolver is most efficient,
+                                e.g., the block size of the audio device. The
+                                work per block grows with the number of
+                                partitions, the work per sample falls with the
+                                partition length.
+    \param  out_convolver The newly created convolver. Must be freed by the
+                          caller using csignal_destroy_fdl_convolver.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_real_fft_plan and cpc_safe_malloc for more
+            error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_kernel or out_convolver are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_kernel_length is zero or
+                                              in_partition_length is not a
+                                              power of two.
+ */
+csignal_error_code
+csignal_initialize_fdl_convolver  (
+                                  USIZE                   in_kernel_length,
+                                  FLOAT64*                in_kernel,
+                                  USIZE                   in_partition_length,
+                                  csignal_fdl_convolver** out_convolver
+                                  );
+
+/*! \fn     csignal_error_code csignal_destroy_fdl_convolver (
+              csignal_fdl_convolver* io_convolver
+            )
+    \brief  Frees the convolver and all of its buffers.
+ 
+    \param  io_convolver  The convolver to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_convolver is null.
+ */
+csignal_error_code
+csignal_destroy_fdl_convolver (
+                               csignal_fdl_convolver* io_convolver
+                               );
+
+/*! \fn     csignal_error_code csignal_reset_fdl_convolver (
+              csignal_fdl_convolver* io_convolver
+            )
+    \brief  Discards the state of the stream, i.e., the next sample processed
+            starts a new stream.
+ 
+    \param  io_convolver  The convolver to reset.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_convolver is null.
+ */
+csignal_error_code
+csignal_reset_fdl_convolver (
+                             csignal_fdl_convolver* io_convolver
+                             );
+
+/*! \fn     csignal_error_code csignal_fdl_convolver_process (
+              csignal_fdl_convolver* io_convolver,
+              USIZE                  in_number_of_samples,
+              FLOAT64*               in_samples,
+              FLOAT64*               out_samples
+            )
+    \brief  Convolves the next in_number_of_samples samples of the stream
+            with the kernel.
+ 
+    \param  io_convolver  The convolver.
+    \param  in_number_of_samples  The number of samples in in_samples and
+                                  out_samples.
+    \param  in_samples  The next samples of the stream.
+    \param  out_samples The next in_number_of_samples samples of the
+                        convolution. May be the same buffer as in_samples.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+ */
+csignal_error_code
+csignal_fdl_convolver_process (
+                               csignal_fdl_convolver* io_convolver,
+                               USIZE                  in_number_of_samples,
+                               FLOAT64*               in_samples,
+                               FLOAT64*               out_samples
+                               );
+
+#endif  /*  __BLOCK_CONVOLVER_H__  */
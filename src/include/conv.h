@@ -8,6 +8,102 @@
 
 #include "csignal_error_codes.h"
 
+/*! \def    CSIGNAL_CONVOLUTION_FFT_CROSSOVER_FACTOR
+    \brief  convolve calculates the convolution with FFTs instead of the
+            direct sum when the shorter signal has at least this factor times
+            log2( N ) samples, where N is the power of two FFT length used for
+            a piece of the convolution (see
+            CSIGNAL_CONVOLUTION_DEFAULT_GRAIN_SIZE). The direct sum costs one
+            multiply-add per output sample per sample of the shorter signal,
+            the FFT method FFTs whose cost per output sample grows with
+            log2( N ). With the vectorized direct kernels (see conv_kernels.h)
+            and the default grain size the measured crossover is about
+            15 log2( N ) for N = 2^11 and for signals of 2^20 samples. With the
+            scalar kernel it is about four times lower.
+ */
+#ifndef CSIGNAL_CONVOLUTION_FFT_CROSSOVER_FACTOR
+#define CSIGNAL_CONVOLUTION_FFT_CROSSOVER_FACTOR  16
+#endif
+
+/*! \def    CSIGNAL_CONVOLUTION_DEFAULT_GRAIN_SIZE
+    \brief  The default number of output samples convolve calculates as one
+            piece of work (see csignal_set_convolution_grain_size). The direct
+            method uses it as is, the FFT method rounds it up so that a piece
+            fills a power of two FFT. 2^14 outputs keep the FFTs of the pieces
+            in the caches.
+ */
+#ifndef CSIGNAL_CONVOLUTION_DEFAULT_GRAIN_SIZE
+#define CSIGNAL_CONVOLUTION_DEFAULT_GRAIN_SIZE  ( 1 << 14 )
+#endif
+
+/*! \var    csignal_convolution_method
+    \brief  How convolve_with_method calculates the convolution.
+ */
+typedef enum csignal_convolution_method_t
+{
+  CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC  = 0,
+  CSIGNAL_CONVOLUTION_METHOD_DIRECT     = 1,
+  CSIGNAL_CONVOLUTION_METHOD_FFT        = 2
+} csignal_convolution_method;
+
+/*! \var    csignal_convolution_mode
+    \brief  Which part of the convolution convolve_with_mode returns. N1 and
+            N2 are the lengths of signal one and two.
+ 
+ \var CSIGNAL_CONVOLUTION_MODE_FULL
+      The N1 + N2 - 1 outputs of the full convolution followed by a zero, as
+      returned by convolve.
+ \var CSIGNAL_CONVOLUTION_MODE_SAME
+      N1 outputs starting at output ( N2 - 1 ) / 2 of the full convolution.
+      If signal two is a linear-phase filter with an odd number of taps this
+      removes its group delay (see csignal_filter_get_group_delay), i.e.,
+      output i is aligned with sample i of signal one.
+ \var CSIGNAL_CONVOLUTION_MODE_VALID
+      The max( N1, N2 ) - min( N1, N2 ) + 1 outputs for which the shorter
+      signal lies completely within the longer one.
+ */
+typedef enum csignal_convolution_mode_t
+{
+  CSIGNAL_CONVOLUTION_MODE_FULL   = 0,
+  CSIGNAL_CONVOLUTION_MODE_SAME   = 1,
+  CSIGNAL_CONVOLUTION_MODE_VALID  = 2
+} csignal_convolution_mode;
+
+/*! \var    csignal_convolution_filter
+    \brief  A filter that is convolved with many signals (see
+            convolve_with_filter). It keeps the FFT of its zero-padded taps for
+            the FFT length of the last convolution, so signals of similar
+            lengths are convolved without transforming the filter again.
+ 
+    \note   The spectrum is updated by the convolutions, so a filter must not
+            be used by two threads at the same time.
+ */
+typedef struct csignal_convolution_filter_t
+{
+  /*! \var    number_of_taps
+      \brief  The number of taps.
+   */
+  USIZE     number_of_taps;
+  
+  /*! \var    taps
+      \brief  A copy of the taps.
+   */
+  FLOAT64*  taps;
+  
+  /*! \var    fft_length
+      \brief  The FFT length of spectrum, 0 if it has not been calculated.
+   */
+  USIZE     fft_length;
+  
+  /*! \var    spectrum
+      \brief  The fft_length / 2 + 1 bins of the zero-padded taps, stored as
+              interleaved real and imaginary components and pre-scaled by 1 /
+              fft_length.
+   */
+  FLOAT64*  spectrum;
+  
+} csignal_convolution_filter;
+
 /*! \fn     csignal_error_code convolve  (
              USIZE       in_signal_one_length,
              FLOAT64*    in_signal_one,
@@ -48,4 +144,331 @@ convolve  (
            FLOAT64**   out_signal
            );
 
+/*! \fn     csignal_error_code convolve_with_method  (
+             USIZE                      in_signal_one_length,
+             FLOAT64*                   in_signal_one,
+             USIZE                      in_signal_two_length,
+             FLOAT64*                   in_signal_two,
+             csignal_convolution_method in_method,
+             USIZE*                     out_signal_length,
+             FLOAT64**                  out_signal
+            )
+    \brief  Performs the convolution of signal one and two like convolve, with
+            an explicit choice of algorithm. convolve uses
+            CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC, which selects the FFT method
+            according to CSIGNAL_CONVOLUTION_FFT_CROSSOVER_FACTOR.
+ 
+    \note   The FFT method zero-pads both signals to the power of two that
+            holds the full convolution and multiplies their real-input FFTs.
+            Its result differs from the direct sum by rounding errors that are
+            relative to the largest output samples, i.e., outputs that are much
+            smaller than the largest ones are less accurate than with the
+            direct sum.
+ 
+    \note   Convolutions longer than the grain size (see
+            csignal_set_convolution_grain_size) are split into pieces of
+            consecutive output samples that are spread over the threads of the
+            pool returned by csignal_get_thread_pool. With the FFT method every
+            piece is calculated with overlap-save from the part of the longer
+            signal it needs. The pieces only depend on the signal lengths and
+            the grain size, so the result is the same for any number of
+            threads.
+ 
+    \param  in_signal_one_length  The number of elements in signal one.
+    \param  in_signal_one One of the two signals to be convolved.
+    \param  in_signal_two_length  The number of elements in siganl two.
+    \param  in_signal_two The second signal to be used in the convolution.
+    \param  in_method The algorithm to use.
+    \param  out_signal_length The number of elements in out_signal, 0 if an
+                              error occurrs. If successful this will equal
+                              signal one length + signal two length.
+    \param  out_signal  A newly created array containing the values of the
+                        convolution between signal one and two. The last
+                        element is always zero.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc and csignal_get_real_fft_plan for other
+            possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the input parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_method is unknown.
+ */
+csignal_error_code
+convolve_with_method  (
+                       USIZE                      in_signal_one_length,
+                       FLOAT64*                   in_signal_one,
+                       USIZE                      in_signal_two_length,
+                       FLOAT64*                   in_signal_two,
+                       csignal_convolution_method in_method,
+                       USIZE*                     out_signal_length,
+                       FLOAT64**                  out_signal
+                       );
+
+/*! \fn     csignal_error_code convolve_with_mode  (
+             USIZE                      in_signal_one_length,
+             FLOAT64*                   in_signal_one,
+             USIZE                      in_signal_two_length,
+             FLOAT64*                   in_signal_two,
+             csignal_convolution_mode   in_mode,
+             csignal_convolution_method in_method,
+             USIZE*                     out_signal_length,
+             FLOAT64**                  out_signal
+            )
+    \brief  Performs the convolution of signal one and two like
+            convolve_with_method, but only calculates the outputs of the part
+            selected by in_mode. Outputs outside that part are neither
+            calculated nor stored, and the FFT method only transforms the
+            inputs they depend on.
+ 
+    \param  in_signal_one_length  The number of elements in signal one.
+    \param  in_signal_one One of the two signals to be convolved.
+    \param  in_signal_two_length  The number of elements in siganl two.
+    \param  in_signal_two The second signal to be used in the convolution.
+    \param  in_mode The part of the convolution to return.
+    \param  in_method The algorithm to use.
+    \param  out_signal_length The number of elements in out_signal, 0 if an
+                              error occurrs. If non-zero on input it must be
+                              at least the length of the part (see
+                              csignal_convolution_mode) and out_signal must
+                              point to that many elements.
+    \param  out_signal  The selected part of the convolution, newly created
+                        if it is null on input.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc and csignal_get_real_fft_plan for other
+            possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the input parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_mode or in_method are
+                                              unknown, or in_mode is not full
+                                              and one of the signals is empty.
+ */
+csignal_error_code
+convolve_with_mode  (
+                     USIZE                      in_signal_one_length,
+                     FLOAT64*                   in_signal_one,
+                     USIZE                      in_signal_two_length,
+                     FLOAT64*                   in_signal_two,
+                     csignal_convolution_mode   in_mode,
+                     csignal_convolution_method in_method,
+                     USIZE*                     out_signal_length,
+                     FLOAT64**                  out_signal
+                     );
+
+/*! \fn     csignal_error_code convolve_decimated  (
+             USIZE                      in_signal_one_length,
+             FLOAT64*                   in_signal_one,
+             USIZE                      in_signal_two_length,
+             FLOAT64*                   in_signal_two,
+             csignal_convolution_mode   in_mode,
+             csignal_convolution_method in_method,
+             USIZE                      in_decimation,
+             USIZE*                     out_signal_length,
+             FLOAT64**                  out_signal
+            )
+    \brief  Performs the convolution of signal one and two like
+            convolve_with_mode, but only keeps every in_decimation-th output of
+            the selected part, starting with its first. The skipped outputs are
+            never calculated: the direct sum evaluates only the kept ones, so
+            it does 1 / in_decimation of the work, and the automatic method
+            only prefers the FFT method when the shorter signal is long enough
+            for it to win despite calculating every output of a piece.
+ 
+    \param  in_signal_one_length  The number of elements in signal one.
+    \param  in_signal_one One of the two signals to be convolved.
+    \param  in_signal_two_length  The number of elements in siganl two.
+    \param  in_signal_two The second signal to be used in the convolution.
+    \param  in_mode The part of the convolution to decimate.
+    \param  in_method The algorithm to use.
+    \param  in_decimation The distance between kept outputs, 1 keeps all of
+                          them.
+    \param  out_signal_length The number of elements in out_signal, 0 if an
+                              error occurrs. If successful this will equal the
+                              length of the part divided by in_decimation,
+                              rounded up. If non-zero on input it must be at
+                              least that and out_signal must point to that
+                              many elements.
+    \param  out_signal  Output k is output k * in_decimation of the part,
+                        newly created if it is null on input.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc and csignal_get_real_fft_plan for other
+            possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the input parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_mode or in_method are
+                                              unknown, in_decimation is zero,
+                                              or in_mode is not full and one
+                                              of the signals is empty.
+ */
+csignal_error_code
+convolve_decimated  (
+                     USIZE                      in_signal_one_length,
+                     FLOAT64*                   in_signal_one,
+                     USIZE                      in_signal_two_length,
+                     FLOAT64*                   in_signal_two,
+                     csignal_convolution_mode   in_mode,
+                     csignal_convolution_method in_method,
+                     USIZE                      in_decimation,
+                     USIZE*                     out_signal_length,
+                     FLOAT64**                  out_signal
+                     );
+
+/*! \fn     csignal_error_code convolve_symmetric  (
+             USIZE                      in_signal_length,
+             FLOAT64*                   in_signal,
+             USIZE                      in_filter_length,
+             FLOAT64*                   in_filter,
+             csignal_convolution_mode   in_mode,
+             csignal_convolution_method in_method,
+             USIZE                      in_decimation,
+             USIZE*                     out_signal_length,
+             FLOAT64**                  out_signal
+            )
+    \brief  convolve_decimated for a symmetric (linear-phase) filter, i.e., one
+            for which in_filter[ j ] equals
+            in_filter[ in_filter_length - 1 - j ] for every tap j. The direct
+            sum adds the two samples every pair of mirrored taps applies to
+            before multiplying, so it does about half the multiplies. The
+            result is undefined for other filters.
+ 
+    \param  in_signal_length  The number of elements in in_signal.
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of elements in in_filter.
+    \param  in_filter The symmetric filter.
+    \param  in_mode The part of the convolution to decimate.
+    \param  in_method The algorithm to use.
+    \param  in_decimation The distance between kept outputs, 1 keeps all of
+                          them.
+    \param  out_signal_length See convolve_decimated.
+    \param  out_signal  See convolve_decimated.
+    \return Returns NO_ERROR upon succesful exection or one of the errors of
+            convolve_decimated.
+ */
+csignal_error_code
+convolve_symmetric  (
+                     USIZE                      in_signal_length,
+                     FLOAT64*                   in_signal,
+                     USIZE                      in_filter_length,
+                     FLOAT64*                   in_filter,
+                     csignal_convolution_mode   in_mode,
+                     csignal_convolution_method in_method,
+                     USIZE                      in_decimation,
+                     USIZE*                     out_signal_length,
+                     FLOAT64**                  out_signal
+                     );
+
+/*! \fn     csignal_error_code csignal_initialize_convolution_filter (
+              USIZE                         in_length,
+              FLOAT64*                      in_taps,
+              csignal_convolution_filter**  out_filter
+            )
+    \brief  Creates a filter for convolve_with_filter. The spectrum of the
+            taps is calculated by the first convolution that uses the FFT
+            method.
+ 
+    \param  in_length The number of elements in in_taps.
+    \param  in_taps The taps. They are copied, so the caller keeps ownership.
+    \param  out_filter  The newly created filter. Must be freed by the caller
+                        using csignal_destroy_convolution_filter.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_taps or out_filter are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_length is zero.
+ */
+csignal_error_code
+csignal_initialize_convolution_filter (
+                                       USIZE                         in_length,
+                                       FLOAT64*                      in_taps,
+                                       csignal_convolution_filter**  out_filter
+                                       );
+
+/*! \fn     csignal_error_code csignal_destroy_convolution_filter (
+              csignal_convolution_filter* io_filter
+            )
+    \brief  Frees the filter, its taps and its spectrum.
+ 
+    \param  io_filter The filter to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_filter is null.
+ */
+csignal_error_code
+csignal_destroy_convolution_filter  (
+                                     csignal_convolution_filter* io_filter
+                                     );
+
+/*! \fn     csignal_error_code convolve_with_filter  (
+              csignal_convolution_filter* io_filter,
+              USIZE                       in_signal_length,
+              FLOAT64*                    in_signal,
+              csignal_convolution_method  in_method,
+              USIZE                       in_first_output,
+              USIZE                       in_decimation,
+              USIZE                       in_number_of_outputs,
+              FLOAT64*                    out_signal
+            )
+    \brief  Calculates in_number_of_outputs samples of the full convolution of
+            in_signal with the taps of io_filter, every in_decimation-th
+            starting at sample in_first_output, like convolve_decimated. The
+            FFT method reuses the spectrum of io_filter if the FFT length is
+            the one of the previous convolution and replaces it otherwise; the
+            FFT length only depends on the number of taps, the grain size and,
+            for a single piece, the number of inputs the outputs depend on.
+ 
+    \param  io_filter The filter.
+    \param  in_signal_length  The number of elements in in_signal.
+    \param  in_signal The signal to filter.
+    \param  in_method The algorithm to use.
+    \param  in_first_output The index of the first output in the full
+                            convolution.
+    \param  in_decimation The distance between consecutive outputs.
+    \param  in_number_of_outputs  The number of outputs to calculate. Outputs
+                                  past the end of the convolution are zero.
+    \param  out_signal  The in_number_of_outputs outputs, allocated by the
+                        caller.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc and csignal_get_real_fft_plan for other
+            possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_filter, in_signal or out_signal
+                                        are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_method is unknown or
+                                              in_decimation is zero.
+ */
+csignal_error_code
+convolve_with_filter  (
+                       csignal_convolution_filter* io_filter,
+                       USIZE                       in_signal_length,
+                       FLOAT64*                    in_signal,
+                       csignal_convolution_method  in_method,
+                       USIZE                       in_first_output,
+                       USIZE                       in_decimation,
+                       USIZE                       in_number_of_outputs,
+                       FLOAT64*                    out_signal
+                       );
+
+/*! \fn     void csignal_set_convolution_grain_size (
+              USIZE in_grain_size
+            )
+    \brief  Sets the number of output samples convolve calculates as one piece
+            of work, CSIGNAL_CONVOLUTION_DEFAULT_GRAIN_SIZE by default. Smaller
+            pieces balance the threads better, larger ones have less overhead.
+ 
+    \note   Must not be called while another thread is executing convolve.
+ 
+    \param  in_grain_size The number of outputs per piece, or 0 to calculate
+                          every convolution as a single piece.
+ */
+void
+csignal_set_convolution_grain_size  (
+                                     USIZE in_grain_size
+                                     );
+
+/*! \fn     USIZE csignal_get_convolution_grain_size( void )
+    \brief  Returns the number of output samples convolve calculates as one
+            piece of work.
+ */
+USIZE
+csignal_get_convolution_grain_size( void );
+
 #endif  /*  __CONV_H__  */
@@ -0,0 +1,155 @@
+/*! \file   conv_kernels.h
+    \brief  The direct-form convolution kernels used for short filters. A
+            scalar implementation is always available and vectorized
+            implementations are provided for x86 (SSE2, AVX2) and ARM64
+            (NEON).
+ 
+            The kernels split the outputs of a convolution into the interior,
+            where every tap of the filter overlaps the signal, and the two
+            edges, where it only partly does. The interior is vectorized across
+            consecutive outputs: every tap is broadcast into a register and
+            multiplied with an unaligned load of the signal, so no bounds are
+            checked per tap and the filter does not need to be reversed. The
+            edges, at most filter length - 1 outputs on each side, use the
+            scalar code.
+ 
+            When only every Mth output is wanted (decimation), consecutive
+            outputs no longer share signal loads, so the strided interior is
+            instead vectorized across the taps: each output is a dot product of
+            the reversed filter with a contiguous window of the signal.
+ 
+    \note   There is no separate selection for these kernels, they follow the
+            FFT kernel (see csignal_fft_get_kernel), so csignal_fft_set_kernel
+            also switches the instruction set used for direct convolution.
+ 
+    \author Brent Carrara
+ */
+#ifndef __CONV_KERNELS_H__
+#define __CONV_KERNELS_H__
+
+#include <cpcommon.h>
+
+#include "fft_kernels.h"
+
+#include "csignal_error_codes.h"
+
+/*! \fn     void csignal_conv_run_kernel (
+              USIZE     in_signal_length,
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  Calculates in_number_of_outputs samples of the full convolution of
+            in_signal and in_filter, starting at sample in_first_output, with
+            the selected kernel:
+ 
+              out_signal[ k ] = sum_j in_filter[ j ] * in_signal[ i - j ],
+ 
+            where i = in_first_output + k and the sum is over the taps for
+            which 0 <= i - j < in_signal_length. Outputs past the end of the
+            convolution (in_signal_length + in_filter_length - 1 samples) are
+            zero.
+ 
+    \note   The result does not depend on which signal is passed as the
+            filter, but the interior is longest when the filter is the shorter
+            of the two.
+ 
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of taps in in_filter.
+    \param  in_filter The filter taps.
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  out_signal  The in_number_of_outputs outputs. Must not overlap
+                        in_signal or in_filter.
+ */
+void
+csignal_conv_run_kernel (
+                         USIZE     in_signal_length,
+                         FLOAT64*  in_signal,
+                         USIZE     in_filter_length,
+                         FLOAT64*  in_filter,
+                         USIZE     in_first_output,
+                         USIZE     in_number_of_outputs,
+                         FLOAT64*  out_signal
+                         );
+
+/*! \fn     void csignal_conv_run_strided_kernel (
+              USIZE     in_signal_length,
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  Calculates every in_stride-th sample of the full convolution of
+            in_signal and in_filter, starting at sample in_first_output, i.e.,
+            out_signal[ k ] is sample in_first_output + k * in_stride. The
+            skipped samples are never calculated. With a stride of one this is
+            csignal_conv_run_kernel.
+ 
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of taps in in_filter.
+    \param  in_filter The filter taps.
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_stride The distance between consecutive outputs, at least one.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  out_signal  The in_number_of_outputs outputs. Must not overlap
+                        in_signal or in_filter.
+ */
+void
+csignal_conv_run_strided_kernel (
+                                 USIZE     in_signal_length,
+                                 FLOAT64*  in_signal,
+                                 USIZE     in_filter_length,
+                                 FLOAT64*  in_filter,
+                                 USIZE     in_first_output,
+                                 USIZE     in_stride,
+                                 USIZE     in_number_of_outputs,
+                                 FLOAT64*  out_signal
+                                 );
+
+/*! \fn     void csignal_conv_run_symmetric_kernel (
+              USIZE     in_signal_length,
+              FLOAT64*  in_signal,
+              USIZE     in_filter_length,
+              FLOAT64*  in_filter,
+              USIZE     in_first_output,
+              USIZE     in_stride,
+              USIZE     in_number_of_outputs,
+              FLOAT64*  out_signal
+            )
+    \brief  csignal_conv_run_strided_kernel for a symmetric filter, i.e., one
+            for which in_filter[ j ] equals
+            in_filter[ in_filter_length - 1 - j ] for every tap j. The result
+            is undefined for other filters.
+ 
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The signal to filter.
+    \param  in_filter_length  The number of taps in in_filter.
+    \param  in_filter The symmetric filter taps.
+    \param  in_first_output The index of the first output to calculate.
+    \param  in_stride The distance between consecutive outputs, at least one.
+    \param  in_number_of_outputs  The number of outputs to calculate.
+    \param  out_signal  The in_number_of_outputs outputs. Must not overlap
+                        in_signal or in_filter.
+ */
+void
+csignal_conv_run_symmetric_kernel (
+                                   USIZE     in_signal_length,
+                                   FLOAT64*  in_signal,
+                                   USIZE     in_filter_length,
+                                   FLOAT64*  in_filter,
+                                   USIZE     in_first_output,
+                                   USIZE     in_stride,
+                                   USIZE     in_number_of_outputs,
+                                   FLOAT64*  out_signal
+                                   );
+
+#endif  /*  __CONV_KERNELS_H__  */
@@ -0,0 +1,204 @@
+/*! \file   correlate.h
+    \brief  Cross-correlation of a signal with a reference, e.g., of a
+            received signal with a known spreading waveform to find its code
+            phase.
+ 
+            The cross-correlation at lag l is
+ 
+              c[ l ] = sum_j reference[ j ] * signal[ l + j ],
+ 
+            i.e., the sum of the products of the reference and the signal
+            shifted by l samples. It is calculated as the convolution of the
+            signal with the reversed reference (see convolve_with_filter), so
+            the direct sum or the FFT method is chosen automatically, and long
+            signals are spread over the thread pool.
+ 
+            A correlator keeps the reversed reference together with its
+            spectrum, so a reference that is correlated against many signals,
+            e.g., a Gold code waveform against every received buffer, is only
+            transformed once.
+ 
+    \author Brent Carrara
+ */
+#ifndef __CORRELATE_H__
+#define __CORRELATE_H__
+
+#include <cpcommon.h>
+
+#include "conv.h"
+
+#include "csignal_error_codes.h"
+
+/*! \var    csignal_correlation_mode
+    \brief  Which lags of the cross-correlation are returned. N and K are the
+            lengths of the signal and the reference.
+ 
+ \var CSIGNAL_CORRELATION_MODE_FULL
+      The N + K - 1 lags from -( K - 1 ) to N - 1, output m is lag
+      m - ( K - 1 ).
+ \var CSIGNAL_CORRELATION_MODE_VALID
+      The N - K + 1 lags from 0 to N - K for which the reference lies
+      completely within the signal, output m is lag m. Requires K <= N.
+ \var CSIGNAL_CORRELATION_MODE_NORMALIZED
+      The valid lags divided by the norms of the reference and of the K
+      samples of the signal it overlaps, so they lie in [ -1, 1 ] and are 1
+      where the signal is a positive multiple of the reference. Lags at
+      which the overlapped samples are all zero are zero.
+ */
+typedef enum csignal_correlation_mode_t
+{
+  CSIGNAL_CORRELATION_MODE_FULL       = 0,
+  CSIGNAL_CORRELATION_MODE_VALID      = 1,
+  CSIGNAL_CORRELATION_MODE_NORMALIZED = 2
+} csignal_correlation_mode;
+
+/*! \var    csignal_correlator
+    \brief  A reference prepared for correlation with many signals.
+ 
+    \note   The cached spectrum is updated by csignal_correlate, so a
+            correlator must not be used by two threads at the same time.
+ */
+typedef struct csignal_correlator_t
+{
+  /*! \var    reference_length
+      \brief  The number of samples in the reference.
+   */
+  USIZE                       reference_length;
+  
+  /*! \var    reference_energy
+      \brief  The sum of the squares of the reference samples.
+   */
+  FLOAT64                     reference_energy;
+  
+  /*! \var    filter
+      \brief  The reversed reference and its cached spectrum.
+   */
+  csignal_convolution_filter* filter;
+  
+} csignal_correlator;
+
+/*! \fn     csignal_error_code csignal_initialize_correlator (
+              USIZE                in_reference_length,
+              FLOAT64*             in_reference,
+              csignal_correlator** out_correlator
+            )
+    \brief  Creates a correlator for in_reference.
+ 
+    \param  in_reference_length The number of samples in in_reference.
+    \param  in_reference  The reference. It is copied, so the caller keeps
+                          ownership.
+    \param  out_correlator  The newly created correlator. Must be freed by the
+                            caller using csignal_destroy_correlator.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_convolution_filter and cpc_safe_malloc for
+            other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_reference or out_correlator are
+                                        null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_reference_length is zero.
+ */
+csignal_error_code
+csignal_initialize_correlator (
+                               USIZE                in_reference_length,
+                               FLOAT64*             in_reference,
+                               csignal_correlator** out_correlator
+                               );
+
+/*! \fn     csignal_error_code csignal_destroy_correlator (
+              csignal_correlator* io_correlator
+            )
+    \brief  Frees the correlator, its reference and its spectrum.
+ 
+    \param  io_correlator The correlator to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_correlator is null.
+ */
+csignal_error_code
+csignal_destroy_correlator  (
+                             csignal_correlator* io_correlator
+                             );
+
+/*! \fn     csignal_error_code csignal_correlate (
+              csignal_correlator*       io_correlator,
+              csignal_correlation_mode  in_mode,
+              USIZE                     in_signal_length,
+              FLOAT64*                  in_signal,
+              USIZE*                    out_correlation_length,
+              FLOAT64**                 out_correlation
+            )
+    \brief  Cross-correlates in_signal with the reference of io_correlator.
+            Signals of the same length reuse the spectrum of the reference.
+ 
+    \param  io_correlator The correlator.
+    \param  in_mode The lags to calculate.
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The signal to search for the reference.
+    \param  out_correlation_length  The number of elements in
+                                    out_correlation, 0 if an error occurrs. If
+                                    non-zero on input it must be at least the
+                                    number of lags (see
+                                    csignal_correlation_mode) and
+                                    out_correlation must point to that many
+                                    elements.
+    \param  out_correlation The cross-correlation, newly created if it is null
+                            on input.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see convolve_with_filter for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_mode is unknown,
+                                              in_signal_length is zero, the
+                                              reference is longer than
+                                              in_signal in a mode other than
+                                              full, or out_correlation_length
+                                              is too small.
+ */
+csignal_error_code
+csignal_correlate (
+                   csignal_correlator*       io_correlator,
+                   csignal_correlation_mode  in_mode,
+                   USIZE                     in_signal_length,
+                   FLOAT64*                  in_signal,
+                   USIZE*                    out_correlation_length,
+                   FLOAT64**                 out_correlation
+                   );
+
+/*! \fn     csignal_error_code csignal_cross_correlate (
+              USIZE                     in_signal_length,
+              FLOAT64*                  in_signal,
+              USIZE                     in_reference_length,
+              FLOAT64*                  in_reference,
+              csignal_correlation_mode  in_mode,
+              USIZE*                    out_correlation_length,
+              FLOAT64**                 out_correlation
+            )
+    \brief  Cross-correlates in_signal with in_reference once, see
+            csignal_correlate. To correlate many signals with the same
+            reference create a correlator instead.
+ 
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The signal to search for the reference.
+    \param  in_reference_length The number of samples in in_reference.
+    \param  in_reference  The reference.
+    \param  in_mode The lags to calculate.
+    \param  out_correlation_length  The number of elements in
+                                    out_correlation, see csignal_correlate.
+    \param  out_correlation The cross-correlation, newly created if it is null
+                            on input.
+    \return Returns NO_ERROR upon succesful exection or one of the errors of
+            csignal_initialize_correlator and csignal_correlate.
+ */
+csignal_error_code
+csignal_cross_correlate (
+                         USIZE                     in_signal_length,
+                         FLOAT64*                  in_signal,
+                         USIZE                     in_reference_length,
+                         FLOAT64*                  in_reference,
+                         csignal_correlation_mode  in_mode,
+                         USIZE*                    out_correlation_length,
+                         FLOAT64**                 out_correlation
+                         );
+
+#endif  /*  __CORRELATE_H__  */
@@ -21,22 +21,34 @@
 #include "fir_filter.h"
 #include "kaiser_filter.h"
 #include "fft.h"
+#include "fft_kernels.h"
+#include "thread_pool.h"
 #include "bit_packer.h"
 #include "bit_stream.h"
 #include "conv.h"
 #include "detect.h"
+#include "window.h"
+#include "stft.h"
+#include "tone_bank.h"
+#include "psd.h"
+#include "block_convolver.h"
+#include "conv_kernels.h"
+#include "correlate.h"
+#include "polyphase.h"
 
 #include "csignal_error_codes.h"
 
 /*! \fn     void csignal_initialize( void )
-    \brief  Initializes the csignal library.
+    \brief  Initializes the csignal library and selects the fastest FFT
+            kernel supported by the CPU (see csignal_fft_select_kernel).
  
  */
 void
 csignal_initialize( void );
 
 /*! \fn     void csignal_terminate( void )
-    \brief  Terminates the csignal library.
+    \brief  Terminates the csignal library and releases the FFT plan cache and
+            the shared thread pool.
  
  */
 void
@@ -276,4 +288,54 @@ csignal_BFSK_determine_frequencies  (
                                      FLOAT64* out_bandwidth
                                      );
 
+/*! \fn     csignal_error_code csignal_demodulate_BFSK_symbol  (
+              UINT32    in_samples_per_symbol,
+              UINT32    in_sample_rate,
+              FLOAT32   in_carrier_frequency,
+              UINT32    in_separation_intervals,
+              USIZE     in_signal_length,
+              FLOAT64*  in_signal,
+              UINT32*   out_symbol
+            )
+    \brief  Demodulates the symbol in the first in_samples_per_symbol samples
+            of in_signal, the inphase signal minus the quadrature signal of
+            csignal_modulate_BFSK_symbol, i.e., cos( 2 * pi * ( Fc + Fm ) ),
+            where Fm is the frequency of symbol m.
+ 
+            The power at Fc + F0 and Fc + F1 is measured with the Goertzel
+            algorithm (see tone_bank.h), so the cost is two multiply-adds per
+            sample and does not depend on an FFT size. Both frequencies are
+            multiples of Fd, i.e., they fall on the DFT bins of a symbol and a
+            symbol has no power at the frequency of the other symbol.
+ 
+    \param  in_samples_per_symbol The number of samples used to represent a
+                                  symbol.
+    \param  in_sample_rate  The sample rate of in_signal.
+    \param  in_carrier_frequency  The carrier frequency of the signal.
+    \param  in_separation_intervals The number of Fd intervals between the
+                                    frequencies of both symbols.
+    \param  in_signal_length  The number of samples in in_signal, must be at
+                              least in_samples_per_symbol.
+    \param  in_signal The received signal aligned to the start of a symbol.
+    \param  out_symbol  The symbol (0 or 1) with the highest power.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_samples_per_symbol,
+                                              in_sample_rate or
+                                              in_separation_intervals are 0 or
+                                              in_signal_length is smaller than
+                                              in_samples_per_symbol.
+ */
+csignal_error_code
+csignal_demodulate_BFSK_symbol  (
+                                 UINT32    in_samples_per_symbol,
+                                 UINT32    in_sample_rate,
+                                 FLOAT32   in_carrier_frequency,
+                                 UINT32    in_separation_intervals,
+                                 USIZE     in_signal_length,
+                                 FLOAT64*  in_signal,
+                                 UINT32*   out_symbol
+                                 );
+
 #endif  /*  __CSIGNAL_H__ */
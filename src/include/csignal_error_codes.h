@@ -24,6 +24,9 @@
  \var CSIGNAL_ERROR_CODE_NO_RESULT
       Used to indicate to the caller that the error that occurred is that there
       is no result.
+ \var CSIGNAL_ERROR_CODE_THREAD_ERROR
+      Used to indicate that a thread or synchronization primitive could not be
+      created.
  */
 enum csignal_error_codes
 {
@@ -32,6 +35,7 @@ enum csignal_error_codes
   CSIGNAL_ERROR_CODE_LENGTH_MISMATCH          = -102,
   CSIGNAL_ERROR_CODE_INVALID_TYPE             = -103,
   CSIGNAL_ERROR_CODE_NO_RESULT                = -104,
+  CSIGNAL_ERROR_CODE_THREAD_ERROR             = -105,
 };
 
 /*! \var    csignal_error_code
@@ -2,7 +2,7 @@
     \brief  This file contains the headers for to calculate the FFT of a real-
             valued signal. The algorightm to calculate the FFT is from the
             following reference:
-
+ 
             Numerical recipes in C: the art of scientific computing by Press, et
             al. (Chapter 6)
             http://www2.units.it/ipl/students_area/imm2/files/Numerical_Recipes.pdf
@@ -14,6 +14,8 @@
 
 #include <cpcommon.h>
 
+#include "thread_pool.h"
+
 #include "csignal_error_codes.h"
 
 /*! \fn     USIZE csignal_calculate_closest_power_of_two  (
@@ -30,6 +32,1239 @@ csignal_calculate_closest_power_of_two  (
                                          USIZE in_number
                                          );
 
+/*! \def    CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH
+    \brief  Plans of at least this many complex points are executed with the
+            six-step algorithm: the N = N1 * N2 points are treated as an N1 x N2
+            matrix that is transposed, transformed with N2 FFTs of N1 points,
+            multiplied by the twiddle factors W^( n2 * k1 ), transposed,
+            transformed with N1 FFTs of N2 points and transposed again. Every
+            sub-FFT fits in the CPU caches, which the strided butterflies of a
+            single large transform do not, and the sub-FFTs and transposes are
+            spread over the threads of the pool returned by
+            csignal_get_thread_pool.
+ */
+#ifndef CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH
+#define CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH ( 1 << 21 )
+#endif
+
+/*! \var    csignal_fft_plan
+    \brief  Holds everything that can be computed once for an FFT of a given
+            length: the twiddle factors and the bit-reversal permutation.
+            Executing a plan performs no trigonometric calls and no memory
+            allocation, so a plan should be created once per transform length
+            and reused for every transform of that length.
+ 
+    \note   The twiddle factors are stored for the forward transform, i.e.,
+            W^k = exp( +2 * pi * i * k / N ) to match the sign convention of
+            the Numerical Recipes algorithm this library has always used. The
+            inverse transform uses their complex conjugates.
+ 
+    \note   Plans of CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH points or more hold a
+            scratch buffer for the transposes. The csignal_execute_* functions
+            use it, so they must not execute such a plan in two threads at the
+            same time. The one-shot functions (e.g., csignal_calculate_FFT)
+            allocate scratch space of their own for every call.
+ */
+typedef struct csignal_fft_plan_t
+{
+  /*! \var    fft_length
+      \brief  The number of complex points in the transform. Must be a power
+              of two.
+   */
+  USIZE     fft_length;
+  
+  /*! \var    bit_reversal
+      \brief  The bit-reversal permutation, i.e., bit_reversal[ i ] is the
+              index whose bits are the reverse of i's bits. fft_length elements.
+              Null for six-step plans.
+   */
+  USIZE*    bit_reversal;
+  
+  /*! \var    twiddles
+      \brief  The twiddle factors W^k for 0 <= k < 3 * fft_length / 4 stored
+              as interleaved real and imaginary components. Three quarters of
+              the circle are needed by the radix-4 butterflies (W^k, W^2k and
+              W^3k). Six-step plans only store 0 <= k < fft_length / 2 since
+              W^( k + fft_length / 2 ) = -W^k.
+   */
+  FLOAT64*  twiddles;
+  
+  /*! \var    column_plan
+      \brief  The plan for the N1-point FFTs of the six-step algorithm (see
+              CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH). Null for plans that are
+              executed directly.
+   */
+  struct csignal_fft_plan_t* column_plan;
+  
+  /*! \var    row_plan
+      \brief  The plan for the N2-point FFTs of the six-step algorithm. Null
+              for plans that are executed directly.
+   */
+  struct csignal_fft_plan_t* row_plan;
+  
+  /*! \var    scratch
+      \brief  2 * fft_length elements used by the transposes of the six-step
+              algorithm. Null for plans that are executed directly.
+   */
+  FLOAT64*  scratch;
+  
+  /*! \var    next
+      \brief  Used to chain plans together in the plan cache. Null for plans
+              that are not in the cache.
+   */
+  struct csignal_fft_plan_t* next;
+  
+} csignal_fft_plan;
+
+/*! \fn     csignal_error_code csignal_initialize_fft_plan (
+              USIZE              in_fft_length,
+              csignal_fft_plan** out_plan
+            )
+    \brief  Creates a new FFT plan for transforms of in_fft_length complex
+            points. The twiddle factors and bit-reversal permutation are
+            calculated here. Lengths of CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH or
+            more also create the plans of the six-step sub-FFTs.
+ 
+    \param  in_fft_length The number of complex points in the transform. Must
+                          be a power of two.
+    \param  out_plan  The newly created plan. Must be freed by the caller using
+                      csignal_destroy_fft_plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_fft_length is zero or not
+                                              a power of two.
+ */
+csignal_error_code
+csignal_initialize_fft_plan (
+                             USIZE              in_fft_length,
+                             csignal_fft_plan** out_plan
+                             );
+
+/*! \fn     csignal_error_code csignal_destroy_fft_plan (
+              csignal_fft_plan* io_plan
+            )
+    \brief  Frees the plan and all of its tables.
+ 
+    \note   Plans returned by csignal_get_fft_plan are owned by the plan cache
+            and must not be destroyed by the caller.
+ 
+    \param  io_plan The plan to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_plan is null.
+ */
+csignal_error_code
+csignal_destroy_fft_plan (
+                          csignal_fft_plan* io_plan
+                          );
+
+/*! \fn     csignal_error_code csignal_get_fft_plan (
+              USIZE              in_fft_length,
+              csignal_fft_plan** out_plan
+            )
+    \brief  Returns the cached plan for transforms of in_fft_length complex
+            points, creating and caching it if this is the first request for
+            that length.
+ 
+    \note   The cache is released by csignal_release_fft_plan_cache, which is
+            called from csignal_terminate. The returned plan must not be
+            destroyed by the caller.
+ 
+    \note   The cache is protected by csignal_lock_library, so plans may be
+            requested by several threads at the same time.
+ 
+    \param  in_fft_length The number of complex points in the transform. Must
+                          be a power of two.
+    \param  out_plan  The cached plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_fft_plan for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+ */
+csignal_error_code
+csignal_get_fft_plan (
+                      USIZE              in_fft_length,
+                      csignal_fft_plan** out_plan
+                      );
+
+/*! \fn     void csignal_release_fft_plan_cache( void )
+    \brief  Destroys every plan in the plan cache. Must not be called while
+            another thread is using the library.
+ */
+void
+csignal_release_fft_plan_cache( void );
+
+/*! \fn     csignal_error_code csignal_execute_FFT (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data
+            )
+    \brief  Calculates the FFT of io_data in place using in_plan.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued signal stored as interleaved real and
+                    imaginary components (2 * fft_length elements). Replaced by
+                    its FFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan or io_data are null.
+ */
+csignal_error_code
+csignal_execute_FFT (
+                     csignal_fft_plan* in_plan,
+                     FLOAT64*          io_data
+                     );
+
+/*! \fn     csignal_error_code csignal_execute_IFFT (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data
+            )
+    \brief  Calculates the unscaled IFFT of io_data in place using in_plan,
+            i.e., the result must be divided by fft_length to recover the
+            original signal.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued spectrum stored as interleaved real and
+                    imaginary components (2 * fft_length elements). Replaced by
+                    its IFFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan or io_data are null.
+ */
+csignal_error_code
+csignal_execute_IFFT (
+                      csignal_fft_plan* in_plan,
+                      FLOAT64*          io_data
+                      );
+
+/*! \fn     csignal_error_code csignal_execute_FFT_out_of_place (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          in_data,
+              FLOAT64*          out_data
+            )
+    \brief  Calculates the FFT of in_data into out_data using in_plan. The
+            bit-reversal permutation is done while copying the input so this is
+            no slower than csignal_execute_FFT and in_data is left untouched.
+ 
+    \note   This function, csignal_execute_FFT and the other execute functions
+            never allocate memory, so they can be used in real-time loops as
+            long as the plan is created beforehand. Buffers that are aligned to
+            32 bytes give the best performance with the vectorized kernels,
+            but any alignment is accepted.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued signal stored as interleaved real and
+                    imaginary components (2 * fft_length elements).
+    \param  out_data  The FFT of in_data (2 * fft_length elements). May be the
+                      same buffer as in_data, in which case the FFT is
+                      calculated in place, but must not otherwise overlap it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_FFT_out_of_place  (
+                                   csignal_fft_plan* in_plan,
+                                   FLOAT64*          in_data,
+                                   FLOAT64*          out_data
+                                   );
+
+/*! \fn     csignal_error_code csignal_execute_IFFT_out_of_place (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          in_data,
+              FLOAT64*          out_data
+            )
+    \brief  Calculates the unscaled IFFT of in_data into out_data using
+            in_plan. See csignal_execute_FFT_out_of_place.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued spectrum stored as interleaved real and
+                    imaginary components (2 * fft_length elements).
+    \param  out_data  The IFFT of in_data (2 * fft_length elements). May be
+                      the same buffer as in_data, but must not otherwise overlap
+                      it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_IFFT_out_of_place (
+                                   csignal_fft_plan* in_plan,
+                                   FLOAT64*          in_data,
+                                   FLOAT64*          out_data
+                                   );
+
+/*! \fn     csignal_error_code csignal_execute_batch_FFT (
+              csignal_fft_plan* in_plan,
+              USIZE             in_number_of_frames,
+              FLOAT64*          in_data,
+              FLOAT64*          out_data
+            )
+    \brief  Calculates the FFT of in_number_of_frames consecutive frames of
+            fft_length complex points with a single plan, i.e., frame f is
+            in_data[ 2 * fft_length * f ] to in_data[ 2 * fft_length * ( f + 1
+            ) - 1 ] and its FFT is stored at the same offset in out_data.
+ 
+    \param  in_plan The plan for the frame length.
+    \param  in_number_of_frames The number of frames in in_data.
+    \param  in_data The frames stored as interleaved real and imaginary
+                    components.
+    \param  out_data  The FFTs of the frames. May be the same buffer as
+                      in_data, but must not otherwise overlap it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_batch_FFT (
+                           csignal_fft_plan* in_plan,
+                           USIZE             in_number_of_frames,
+                           FLOAT64*          in_data,
+                           FLOAT64*          out_data
+                           );
+
+/*! \fn     csignal_error_code csignal_execute_batch_IFFT (
+              csignal_fft_plan* in_plan,
+              USIZE             in_number_of_frames,
+              FLOAT64*          in_data,
+              FLOAT64*          out_data
+            )
+    \brief  Calculates the unscaled IFFT of in_number_of_frames consecutive
+            frames. See csignal_execute_batch_FFT for the layout.
+ 
+    \param  in_plan The plan for the frame length.
+    \param  in_number_of_frames The number of frames in in_data.
+    \param  in_data The spectra stored as interleaved real and imaginary
+                    components.
+    \param  out_data  The IFFTs of the frames. May be the same buffer as
+                      in_data, but must not otherwise overlap it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_batch_IFFT  (
+                             csignal_fft_plan* in_plan,
+                             USIZE             in_number_of_frames,
+                             FLOAT64*          in_data,
+                             FLOAT64*          out_data
+                             );
+
+/*! \var    csignal_real_fft_plan
+    \brief  A plan for transforms of real-valued signals of signal_length
+            samples. The signal is treated as a complex signal of half the
+            length (even samples are the real components, odd samples are the
+            imaginary components), transformed with a complex FFT of
+            signal_length / 2 points and then split into the signal_length / 2
+            + 1 non-redundant bins of the real signal's spectrum. This halves
+            both the memory and the arithmetic of the equivalent complex FFT.
+ */
+typedef struct csignal_real_fft_plan_t
+{
+  /*! \var    signal_length
+      \brief  The number of real samples in the transform. Must be a power of
+              two greater than or equal to 2.
+   */
+  USIZE             signal_length;
+  
+  /*! \var    complex_plan
+      \brief  The plan for the complex FFT of signal_length / 2 points. Owned
+              by this plan.
+   */
+  csignal_fft_plan* complex_plan;
+  
+  /*! \var    twiddles
+      \brief  The twiddle factors W^k = exp( +2 * pi * i * k / signal_length )
+              for 0 <= k <= signal_length / 4 used to split the half-length
+              spectrum, stored as interleaved real and imaginary components.
+   */
+  FLOAT64*          twiddles;
+  
+  /*! \var    next
+      \brief  Used to chain plans together in the plan cache. Null for plans
+              that are not in the cache.
+   */
+  struct csignal_real_fft_plan_t* next;
+  
+} csignal_real_fft_plan;
+
+/*! \fn     csignal_error_code csignal_initialize_real_fft_plan (
+              USIZE                   in_signal_length,
+              csignal_real_fft_plan** out_plan
+            )
+    \brief  Creates a new plan for real-input transforms of in_signal_length
+            samples.
+ 
+    \param  in_signal_length  The number of real samples in the transform. Must
+                              be a power of two greater than or equal to 2.
+    \param  out_plan  The newly created plan. Must be freed by the caller using
+                      csignal_destroy_real_fft_plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_fft_plan for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_signal_length is less than
+                                              2 or not a power of two.
+ */
+csignal_error_code
+csignal_initialize_real_fft_plan (
+                                  USIZE                   in_signal_length,
+                                  csignal_real_fft_plan** out_plan
+                                  );
+
+/*! \fn     csignal_error_code csignal_destroy_real_fft_plan (
+              csignal_real_fft_plan* io_plan
+            )
+    \brief  Frees the plan, its tables and its complex plan.
+ 
+    \note   Plans returned by csignal_get_real_fft_plan are owned by the plan
+            cache and must not be destroyed by the caller.
+ 
+    \param  io_plan The plan to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_plan is null.
+ */
+csignal_error_code
+csignal_destroy_real_fft_plan (
+                               csignal_real_fft_plan* io_plan
+                               );
+
+/*! \fn     csignal_error_code csignal_get_real_fft_plan (
+              USIZE                   in_signal_length,
+              csignal_real_fft_plan** out_plan
+            )
+    \brief  Returns the cached real-input plan for in_signal_length samples,
+            creating and caching it if this is the first request for that
+            length. See csignal_get_fft_plan for the ownership and locking
+            rules.
+ 
+    \param  in_signal_length  The number of real samples in the transform.
+    \param  out_plan  The cached plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_real_fft_plan for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+ */
+csignal_error_code
+csignal_get_real_fft_plan (
+                           USIZE                   in_signal_length,
+                           csignal_real_fft_plan** out_plan
+                           );
+
+/*! \fn     csignal_error_code csignal_execute_real_FFT (
+              csignal_real_fft_plan* in_plan,
+              FLOAT64*               in_signal,
+              FLOAT64*               out_fft
+            )
+    \brief  Calculates the FFT of the real-valued signal in_signal and returns
+            the non-redundant bins 0 to signal_length / 2 (inclusive). The
+            remaining bins are the complex conjugates of these, i.e., X[ N - k ]
+            = conj( X[ k ] ).
+ 
+    \param  in_plan The plan for the signal length.
+    \param  in_signal The signal_length real samples to transform. May be the
+                      same buffer as out_fft.
+    \param  out_fft The signal_length / 2 + 1 bins stored as interleaved real
+                    and imaginary components (signal_length + 2 elements).
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+ */
+csignal_error_code
+csignal_execute_real_FFT (
+                          csignal_real_fft_plan* in_plan,
+                          FLOAT64*               in_signal,
+                          FLOAT64*               out_fft
+                          );
+
+/*! \fn     csignal_error_code csignal_execute_real_IFFT (
+              csignal_real_fft_plan* in_plan,
+              FLOAT64*               in_fft,
+              FLOAT64*               out_signal
+            )
+    \brief  Calculates the unscaled IFFT of the spectrum of a real-valued
+            signal given its non-redundant bins, i.e., the result must be
+            divided by signal_length to recover the original signal. This is
+            the inverse of csignal_execute_real_FFT.
+ 
+    \param  in_plan The plan for the signal length.
+    \param  in_fft  The signal_length / 2 + 1 bins stored as interleaved real
+                    and imaginary components (signal_length + 2 elements). May
+                    be the same buffer as out_signal.
+    \param  out_signal  The signal_length real samples of the IFFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+ */
+csignal_error_code
+csignal_execute_real_IFFT (
+                           csignal_real_fft_plan* in_plan,
+                           FLOAT64*               in_fft,
+                           FLOAT64*               out_signal
+                           );
+
+/*! \fn     USIZE csignal_get_real_fft_scratch_length (
+              csignal_real_fft_plan* in_plan
+            )
+    \brief  Returns the number of elements of scratch space
+            csignal_execute_real_FFT_with_scratch and
+            csignal_execute_real_IFFT_with_scratch need for in_plan. This is
+            signal_length if the complex FFT of the plan uses the six-step
+            algorithm (see CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH) and zero
+            otherwise, or if in_plan is null.
+ 
+    \param  in_plan The real-input plan.
+    \return The number of FLOAT64 elements of scratch space.
+ */
+USIZE
+csignal_get_real_fft_scratch_length (
+                                     csignal_real_fft_plan* in_plan
+                                     );
+
+/*! \fn     csignal_error_code csignal_execute_real_FFT_with_scratch (
+              csignal_real_fft_plan* in_plan,
+              FLOAT64*               in_scratch,
+              FLOAT64*               in_signal,
+              FLOAT64*               out_fft
+            )
+    \brief  Same as csignal_execute_real_FFT, but the work space of the
+            six-step algorithm is in_scratch instead of the plan's own. Several
+            threads may execute the same plan at the same time, e.g., a plan
+            returned by csignal_get_real_fft_plan, as long as each of them
+            passes its own scratch space.
+ 
+    \param  in_plan The plan for the signal length.
+    \param  in_scratch  csignal_get_real_fft_scratch_length( in_plan ) elements
+                        of work space. May be null if that is zero.
+    \param  in_signal The signal_length real samples to transform. May be the
+                      same buffer as out_fft.
+    \param  out_fft The signal_length / 2 + 1 bins stored as interleaved real
+                    and imaginary components (signal_length + 2 elements).
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan, in_signal or out_fft are
+                                        null, or in_scratch is null and the
+                                        plan needs scratch space.
+ */
+csignal_error_code
+csignal_execute_real_FFT_with_scratch (
+                                       csignal_real_fft_plan* in_plan,
+                                       FLOAT64*               in_scratch,
+                                       FLOAT64*               in_signal,
+                                       FLOAT64*               out_fft
+                                       );
+
+/*! \fn     csignal_error_code csignal_execute_real_IFFT_with_scratch (
+              csignal_real_fft_plan* in_plan,
+              FLOAT64*               in_scratch,
+              FLOAT64*               in_fft,
+              FLOAT64*               out_signal
+            )
+    \brief  Same as csignal_execute_real_IFFT, but the work space of the
+            six-step algorithm is in_scratch instead of the plan's own. See
+            csignal_execute_real_FFT_with_scratch.
+ 
+    \param  in_plan The plan for the signal length.
+    \param  in_scratch  csignal_get_real_fft_scratch_length( in_plan ) elements
+                        of work space. May be null if that is zero.
+    \param  in_fft  The signal_length / 2 + 1 bins stored as interleaved real
+                    and imaginary components (signal_length + 2 elements). May
+                    be the same buffer as out_signal.
+    \param  out_signal  The signal_length real samples of the IFFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan, in_fft or out_signal are
+                                        null, or in_scratch is null and the
+                                        plan needs scratch space.
+ */
+csignal_error_code
+csignal_execute_real_IFFT_with_scratch  (
+                                         csignal_real_fft_plan* in_plan,
+                                         FLOAT64*               in_scratch,
+                                         FLOAT64*               in_fft,
+                                         FLOAT64*               out_signal
+                                         );
+
+/*! \fn     csignal_error_code csignal_calculate_real_FFT (
+              USIZE      in_signal_length,
+              FLOAT64*   in_signal,
+              USIZE*     out_fft_length,
+              FLOAT64**  out_fft
+            )
+    \brief  Calculates the FFT of the real-valued input signal, in_signal, and
+            returns only the non-redundant bins. The signal is zero-padded to
+            the next power of two, N, larger than or equal to in_signal_length.
+ 
+    \note   If out_fft_length is non-zero and out_fft is non-Null, then no
+            buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_fft.
+ 
+    \param  in_signal_length  The number of elements in in_signal.
+    \param  in_signal The signal whose FFT is to be calculated.
+    \param  out_fft_length  The number of elements returned in out_fft. This
+                            will always be N + 2, i.e., N / 2 + 1 bins with
+                            real and imaginary components in adjacent indices.
+    \param  out_fft The bins of the FFT of in_signal from DC f=0Hz up to and
+                    including the sampling rate that in_signal was generated at
+                    divided by 2.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_signal, out_fft_length or out_fft
+                                        are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If out_fft_length is non-zero and
+                                              smaller than N + 2, or
+                                              in_signal_length is zero.
+ */
+csignal_error_code
+csignal_calculate_real_FFT (
+                            USIZE      in_signal_length,
+                            FLOAT64*   in_signal,
+                            USIZE*     out_fft_length,
+                            FLOAT64**  out_fft
+                            );
+
+/*! \fn     csignal_error_code csignal_calculate_real_IFFT (
+              USIZE      in_fft_length,
+              FLOAT64*   in_fft,
+              USIZE*     out_signal_length,
+              FLOAT64**  out_signal
+            )
+    \brief  Calculates the real-valued signal whose non-redundant FFT bins are
+            in_fft, i.e., the inverse of csignal_calculate_real_FFT. The result
+            is scaled by 1 / N so that a round trip returns the original
+            (zero-padded) signal.
+ 
+    \note   If out_signal_length is non-zero and out_signal is non-Null, then
+            no buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_signal.
+ 
+    \param  in_fft_length The number of elements in in_fft. Must be N + 2 where
+                          N is a power of two greater than or equal to 2.
+    \param  in_fft  The N / 2 + 1 bins stored as interleaved real and imaginary
+                    components.
+    \param  out_signal_length The number of elements returned in out_signal.
+                              This will always be N.
+    \param  out_signal  The N real samples of the signal.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_fft, out_signal_length or
+                                        out_signal are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_fft_length is not N + 2 or
+                                              out_signal_length is non-zero and
+                                              smaller than N.
+ */
+csignal_error_code
+csignal_calculate_real_IFFT (
+                             USIZE      in_fft_length,
+                             FLOAT64*   in_fft,
+                             USIZE*     out_signal_length,
+                             FLOAT64**  out_signal
+                             );
+
+/*! \def    CSIGNAL_EXACT_FFT_MAXIMUM_FACTORS
+    \brief  The maximum number of radix passes of an exact-length plan, i.e.,
+            the number of bits in a USIZE.
+ */
+#define CSIGNAL_EXACT_FFT_MAXIMUM_FACTORS ( sizeof( USIZE ) * 8 )
+
+/*! \enum   csignal_exact_fft_algorithm
+    \brief  The algorithm used by an exact-length plan.
+ 
+ \var CSIGNAL_EXACT_FFT_POWER_OF_TWO
+      The length is a power of two and the radix-4 plan is used directly.
+ \var CSIGNAL_EXACT_FFT_MIXED_RADIX
+      The length only has the prime factors 2, 3, 5 and 7 and is calculated
+      with a self-sorting (Stockham) mixed-radix FFT.
+ \var CSIGNAL_EXACT_FFT_BLUESTEIN
+      The length has a prime factor larger than 7. The DFT is rewritten as a
+      convolution with a chirp (Bluestein's algorithm) which is calculated
+      with power of two FFTs of at least 2 * fft_length - 1 points.
+ */
+typedef enum csignal_exact_fft_algorithm_t
+{
+  CSIGNAL_EXACT_FFT_POWER_OF_TWO  = 0,
+  CSIGNAL_EXACT_FFT_MIXED_RADIX   = 1,
+  CSIGNAL_EXACT_FFT_BLUESTEIN     = 2
+} csignal_exact_fft_algorithm;
+
+/*! \var    csignal_exact_fft_plan
+    \brief  A plan for complex transforms of any length. Unlike
+            csignal_fft_plan the signal is not zero-padded to the next power of
+            two so the bins are exactly k * sample_rate / fft_length.
+ 
+    \note   The plan contains scratch space used while executing it. A plan
+            must therefore not be executed by two threads at the same time.
+ */
+typedef struct csignal_exact_fft_plan_t
+{
+  /*! \var    fft_length
+      \brief  The number of complex points in the transform.
+   */
+  USIZE                       fft_length;
+  
+  /*! \var    algorithm
+      \brief  The algorithm selected for fft_length.
+   */
+  csignal_exact_fft_algorithm algorithm;
+  
+  /*! \var    number_of_factors
+      \brief  The number of radix passes (mixed-radix plans only).
+   */
+  USIZE                       number_of_factors;
+  
+  /*! \var    factors
+      \brief  The radix of each pass, one of 2, 3, 4, 5 or 7, in the order the
+              passes are executed (mixed-radix plans only).
+   */
+  USIZE                       factors[ CSIGNAL_EXACT_FFT_MAXIMUM_FACTORS ];
+  
+  /*! \var    twiddles
+      \brief  The fft_length roots of unity W^k = exp( +2 * pi * i * k /
+              fft_length ) stored as interleaved real and imaginary components
+              (mixed-radix plans only).
+   */
+  FLOAT64*                    twiddles;
+  
+  /*! \var    complex_plan
+      \brief  The power of two plan of fft_length points (power of two plans)
+              or convolution_length points (Bluestein plans). Owned by this
+              plan.
+   */
+  csignal_fft_plan*           complex_plan;
+  
+  /*! \var    convolution_length
+      \brief  The power of two length of the chirp convolution (Bluestein
+              plans only).
+   */
+  USIZE                       convolution_length;
+  
+  /*! \var    chirp
+      \brief  The chirp c[ k ] = exp( +pi * i * k^2 / fft_length ) for 0 <= k
+              < fft_length (Bluestein plans only).
+   */
+  FLOAT64*                    chirp;
+  
+  /*! \var    chirp_fft
+      \brief  The FFT of the conjugate chirp wrapped around to
+              convolution_length points, pre-scaled by 1 / convolution_length
+              (Bluestein plans only).
+   */
+  FLOAT64*                    chirp_fft;
+  
+  /*! \var    scratch
+      \brief  fft_length (mixed-radix) or convolution_length (Bluestein)
+              complex points of work space.
+   */
+  FLOAT64*                    scratch;
+  
+  /*! \var    next
+      \brief  Used to chain plans together in the plan cache. Null for plans
+              that are not in the cache.
+   */
+  struct csignal_exact_fft_plan_t* next;
+  
+} csignal_exact_fft_plan;
+
+/*! \fn     csignal_error_code csignal_initialize_exact_fft_plan (
+              USIZE                    in_fft_length,
+              csignal_exact_fft_plan** out_plan
+            )
+    \brief  Creates a new plan for complex transforms of exactly in_fft_length
+            points. Lengths whose prime factors are all 2, 3, 5 or 7 use the
+            mixed-radix algorithm, all other lengths use Bluestein's algorithm.
+ 
+    \param  in_fft_length The number of complex points in the transform. Must
+                          be greater than zero.
+    \param  out_plan  The newly created plan. Must be freed by the caller using
+                      csignal_destroy_exact_fft_plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_fft_length is zero.
+ */
+csignal_error_code
+csignal_initialize_exact_fft_plan (
+                                   USIZE                    in_fft_length,
+                                   csignal_exact_fft_plan** out_plan
+                                   );
+
+/*! \fn     csignal_error_code csignal_destroy_exact_fft_plan (
+              csignal_exact_fft_plan* io_plan
+            )
+    \brief  Frees the plan, its tables and its power of two plan.
+ 
+    \note   Plans returned by csignal_get_exact_fft_plan are owned by the plan
+            cache and must not be destroyed by the caller.
+ 
+    \param  io_plan The plan to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_plan is null.
+ */
+csignal_error_code
+csignal_destroy_exact_fft_plan (
+                                csignal_exact_fft_plan* io_plan
+                                );
+
+/*! \fn     csignal_error_code csignal_get_exact_fft_plan (
+              USIZE                    in_fft_length,
+              csignal_exact_fft_plan** out_plan
+            )
+    \brief  Returns the cached exact-length plan for in_fft_length points,
+            creating and caching it if this is the first request for that
+            length. See csignal_get_fft_plan for the ownership and locking
+            rules.
+ 
+    \note   The cache only protects the lookup. The returned plan holds
+            scratch space, so it must not be executed by two threads at the
+            same time (see csignal_exact_fft_plan).
+ 
+    \param  in_fft_length The number of complex points in the transform.
+    \param  out_plan  The cached plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_exact_fft_plan for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+ */
+csignal_error_code
+csignal_get_exact_fft_plan (
+                            USIZE                    in_fft_length,
+                            csignal_exact_fft_plan** out_plan
+                            );
+
+/*! \fn     csignal_error_code csignal_execute_exact_FFT (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                io_data
+            )
+    \brief  Calculates the FFT of io_data in place using in_plan.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued signal stored as interleaved real and
+                    imaginary components (2 * fft_length elements). Replaced by
+                    its FFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan or io_data are null.
+ */
+csignal_error_code
+csignal_execute_exact_FFT (
+                           csignal_exact_fft_plan* in_plan,
+                           FLOAT64*                io_data
+                           );
+
+/*! \fn     csignal_error_code csignal_execute_exact_IFFT (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                io_data
+            )
+    \brief  Calculates the unscaled IFFT of io_data in place using in_plan,
+            i.e., the result must be divided by fft_length to recover the
+            original signal.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued spectrum stored as interleaved real and
+                    imaginary components (2 * fft_length elements). Replaced by
+                    its IFFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan or io_data are null.
+ */
+csignal_error_code
+csignal_execute_exact_IFFT  (
+                             csignal_exact_fft_plan* in_plan,
+                             FLOAT64*                io_data
+                             );
+
+/*! \fn     csignal_error_code csignal_execute_exact_FFT_out_of_place (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                in_data,
+              FLOAT64*                out_data
+            )
+    \brief  Calculates the FFT of in_data into out_data using in_plan. Like
+            csignal_execute_FFT_out_of_place this never allocates memory and
+            in_data is left untouched. Mixed-radix plans write their first
+            pass directly from in_data, so no copy is needed.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued signal stored as interleaved real and
+                    imaginary components (2 * fft_length elements).
+    \param  out_data  The FFT of in_data (2 * fft_length elements). May be the
+                      same buffer as in_data, but must not otherwise overlap it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_exact_FFT_out_of_place  (
+                                         csignal_exact_fft_plan* in_plan,
+                                         FLOAT64*                in_data,
+                                         FLOAT64*                out_data
+                                         );
+
+/*! \fn     csignal_error_code csignal_execute_exact_IFFT_out_of_place (
+              csignal_exact_fft_plan* in_plan,
+              FLOAT64*                in_data,
+              FLOAT64*                out_data
+            )
+    \brief  Calculates the unscaled IFFT of in_data into out_data using
+            in_plan. See csignal_execute_exact_FFT_out_of_place.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued spectrum stored as interleaved real and
+                    imaginary components (2 * fft_length elements).
+    \param  out_data  The IFFT of in_data (2 * fft_length elements). May be
+                      the same buffer as in_data, but must not otherwise overlap
+                      it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_exact_IFFT_out_of_place (
+                                         csignal_exact_fft_plan* in_plan,
+                                         FLOAT64*                in_data,
+                                         FLOAT64*                out_data
+                                         );
+
+/*! \fn     csignal_error_code csignal_calculate_exact_FFT (
+              USIZE      in_signal_length,
+              FLOAT64*   in_signal,
+              USIZE*     out_fft_length,
+              FLOAT64**  out_fft
+            )
+    \brief  Calculates the FFT of the input signal, in_signal, without
+            zero-padding it, i.e., the same as csignal_calculate_FFT but bin k
+            is at k * sample_rate / in_signal_length and no time is spent on
+            padding when in_signal_length is not a power of two.
+ 
+    \note   If out_fft_length is non-zero and out_fft is non-Null, then no
+            buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_fft.
+ 
+    \note   The plan is taken from the plan cache but executed with scratch
+            space allocated for the call, so this function may be called by
+            several threads at the same time.
+ 
+    \param  in_signal_length  The number of elements in in_signal.
+    \param  in_signal The signal whose FFT is to be calculated.
+    \param  out_fft_length  The number of elements returned in out_fft. This
+                            will always be 2 * in_signal_length (a real and
+                            imaginary component are returned in adjacent
+                            indices).
+    \param  out_fft The FFT of in_signal with the positive frequency components
+                    first followed by the negative frequency components.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_signal, out_fft_length or out_fft
+                                        are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_signal_length is zero or
+                                              out_fft_length is non-zero and
+                                              smaller than 2 *
+                                              in_signal_length.
+ */
+csignal_error_code
+csignal_calculate_exact_FFT (
+                             USIZE      in_signal_length,
+                             FLOAT64*   in_signal,
+                             USIZE*     out_fft_length,
+                             FLOAT64**  out_fft
+                             );
+
+/*! \var    csignal_chirp_z_plan
+    \brief  A plan for the chirp-z transform (zoom FFT) of signal_length
+            samples evaluated at number_of_bins frequencies that are evenly
+            spaced over [ start_frequency, end_frequency ):
+ 
+              X[ k ] = sum_n x[ n ] exp( +2 * pi * i * f_k * n / Fs ),
+              f_k    = start_frequency
+                       + k * ( end_frequency - start_frequency )
+                       / number_of_bins.
+ 
+            Writing nk = ( n^2 + k^2 - ( k - n )^2 ) / 2 turns the sum into a
+            convolution with a chirp (as in Bluestein's algorithm) which is
+            calculated with power of two FFTs of signal_length + number_of_bins
+            - 1 or more points. The cost therefore depends on the number of
+            samples and bins, not on the resolution: a zero-padded FFT with the
+            same bin spacing needs Fs / spacing points.
+ 
+    \note   The chirp phases are calculated in double precision, their absolute
+            error grows with spacing / Fs * signal_length^2. The plan contains
+            scratch space used while executing it, so a plan must not be
+            executed by two threads at the same time.
+ */
+typedef struct csignal_chirp_z_plan_t
+{
+  /*! \var    signal_length
+      \brief  The number of samples transformed.
+   */
+  USIZE             signal_length;
+  
+  /*! \var    number_of_bins
+      \brief  The number of frequencies the transform is evaluated at.
+   */
+  USIZE             number_of_bins;
+  
+  /*! \var    convolution_length
+      \brief  The power of two length of the chirp convolution.
+   */
+  USIZE             convolution_length;
+  
+  /*! \var    complex_plan
+      \brief  The plan of convolution_length points. Owned by this plan.
+   */
+  csignal_fft_plan* complex_plan;
+  
+  /*! \var    input_chirp
+      \brief  exp( +2 * pi * i * ( s * n + r * n^2 / 2 ) ) for 0 <= n <
+              signal_length, where s is start_frequency / Fs and r is the bin
+              spacing divided by Fs, stored as interleaved real and imaginary
+              components.
+   */
+  FLOAT64*          input_chirp;
+  
+  /*! \var    output_chirp
+      \brief  exp( +2 * pi * i * r * k^2 / 2 ) for 0 <= k < number_of_bins.
+   */
+  FLOAT64*          output_chirp;
+  
+  /*! \var    chirp_fft
+      \brief  The FFT of exp( -2 * pi * i * r * m^2 / 2 ) for -signal_length
+              < m < number_of_bins wrapped around to convolution_length points,
+              pre-scaled by 1 / convolution_length.
+   */
+  FLOAT64*          chirp_fft;
+  
+  /*! \var    scratch
+      \brief  convolution_length complex points of work space.
+   */
+  FLOAT64*          scratch;
+  
+} csignal_chirp_z_plan;
+
+/*! \fn     csignal_error_code csignal_initialize_chirp_z_plan (
+              USIZE                  in_signal_length,
+              UINT32                 in_sample_rate,
+              FLOAT64                in_start_frequency,
+              FLOAT64                in_end_frequency,
+              USIZE                  in_number_of_bins,
+              csignal_chirp_z_plan** out_plan
+            )
+    \brief  Creates a plan that evaluates the spectrum of in_signal_length
+            samples at in_number_of_bins frequencies from in_start_frequency
+            (inclusive) to in_end_frequency (exclusive). With a start of 0, an
+            end of in_sample_rate and in_signal_length bins the transform is
+            the exact-length FFT.
+ 
+    \param  in_signal_length  The number of samples transformed. Must be
+                              greater than zero.
+    \param  in_sample_rate  The sample rate of the signal in Hz.
+    \param  in_start_frequency  The frequency of the first bin in Hz.
+    \param  in_end_frequency  The frequency one bin spacing after the last bin
+                              in Hz. May be smaller than in_start_frequency, in
+                              which case the frequencies decrease.
+    \param  in_number_of_bins The number of bins. Must be greater than zero.
+    \param  out_plan  The newly created plan. Must be freed by the caller using
+                      csignal_destroy_chirp_z_plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_fft_plan for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_signal_length,
+                                              in_sample_rate or
+                                              in_number_of_bins is zero.
+ */
+csignal_error_code
+csignal_initialize_chirp_z_plan (
+                                 USIZE                  in_signal_length,
+                                 UINT32                 in_sample_rate,
+                                 FLOAT64                in_start_frequency,
+                                 FLOAT64                in_end_frequency,
+                                 USIZE                  in_number_of_bins,
+                                 csignal_chirp_z_plan** out_plan
+                                 );
+
+/*! \fn     csignal_error_code csignal_destroy_chirp_z_plan (
+              csignal_chirp_z_plan* io_plan
+            )
+    \brief  Frees the plan, its tables and its power of two plan.
+ 
+    \param  io_plan The plan to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_plan is null.
+ */
+csignal_error_code
+csignal_destroy_chirp_z_plan  (
+                               csignal_chirp_z_plan* io_plan
+                               );
+
+/*! \fn     csignal_error_code csignal_execute_chirp_z (
+              csignal_chirp_z_plan* in_plan,
+              FLOAT64*              in_signal,
+              FLOAT64*              out_bins
+            )
+    \brief  Calculates the chirp-z transform of a complex-valued signal.
+ 
+    \param  in_plan The plan.
+    \param  in_signal The signal_length samples stored as interleaved real and
+                      imaginary components (2 * signal_length elements).
+    \param  out_bins  The number_of_bins bins stored as interleaved real and
+                      imaginary components (2 * number_of_bins elements). May
+                      be the same buffer as in_signal if it is large enough.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan, in_signal or out_bins are
+                                        null.
+ */
+csignal_error_code
+csignal_execute_chirp_z (
+                         csignal_chirp_z_plan* in_plan,
+                         FLOAT64*              in_signal,
+                         FLOAT64*              out_bins
+                         );
+
+/*! \fn     csignal_error_code csignal_execute_real_chirp_z (
+              csignal_chirp_z_plan* in_plan,
+              FLOAT64*              in_signal,
+              FLOAT64*              out_bins
+            )
+    \brief  Calculates the chirp-z transform of a real-valued signal.
+ 
+    \param  in_plan The plan.
+    \param  in_signal The signal_length real samples.
+    \param  out_bins  The number_of_bins bins stored as interleaved real and
+                      imaginary components (2 * number_of_bins elements).
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan, in_signal or out_bins are
+                                        null.
+ */
+csignal_error_code
+csignal_execute_real_chirp_z  (
+                               csignal_chirp_z_plan* in_plan,
+                               FLOAT64*              in_signal,
+                               FLOAT64*              out_bins
+                               );
+
+/*! \fn     csignal_error_code csignal_calculate_zoom_FFT (
+              USIZE      in_signal_length,
+              FLOAT64*   in_signal,
+              UINT32     in_sample_rate,
+              FLOAT64    in_start_frequency,
+              FLOAT64    in_end_frequency,
+              USIZE      in_number_of_bins,
+              USIZE*     out_fft_length,
+              FLOAT64**  out_fft
+            )
+    \brief  Calculates in_number_of_bins bins of the spectrum of the real
+            signal in_signal between in_start_frequency and in_end_frequency
+            with a temporary chirp-z plan (see csignal_chirp_z_plan). Callers
+            that zoom into many signals of the same length should create the
+            plan once and use csignal_execute_real_chirp_z.
+ 
+    \note   If out_fft_length is non-zero and out_fft is non-Null, then no
+            buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_fft.
+ 
+    \param  in_signal_length  The number of elements in in_signal.
+    \param  in_signal The signal whose spectrum is to be calculated.
+    \param  in_sample_rate  The sample rate of in_signal in Hz.
+    \param  in_start_frequency  The frequency of the first bin in Hz.
+    \param  in_end_frequency  The frequency one bin spacing after the last bin
+                              in Hz.
+    \param  in_number_of_bins The number of bins.
+    \param  out_fft_length  The number of elements returned in out_fft. This
+                            will always be 2 * in_number_of_bins.
+    \param  out_fft The bins stored as interleaved real and imaginary
+                    components.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_chirp_z_plan for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_signal, out_fft_length or out_fft
+                                        are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If out_fft_length is non-zero and
+                                              smaller than 2 *
+                                              in_number_of_bins.
+ */
+csignal_error_code
+csignal_calculate_zoom_FFT  (
+                             USIZE      in_signal_length,
+                             FLOAT64*   in_signal,
+                             UINT32     in_sample_rate,
+                             FLOAT64    in_start_frequency,
+                             FLOAT64    in_end_frequency,
+                             USIZE      in_number_of_bins,
+                             USIZE*     out_fft_length,
+                             FLOAT64**  out_fft
+                             );
+
+/*! \fn     csignal_error_code csignal_calculate_batch_FFT (
+              USIZE      in_number_of_frames,
+              USIZE      in_frame_length,
+              FLOAT64*   in_signal,
+              USIZE*     out_fft_length,
+              FLOAT64**  out_fft
+            )
+    \brief  Calculates the FFT of each of the in_number_of_frames consecutive
+            frames of in_frame_length real samples in in_signal. The result is
+            the same as calling csignal_calculate_FFT on every frame, but only
+            one plan lookup and (at most) one allocation are done and every
+            frame is transformed by the real-input plan directly into its slot
+            in out_fft.
+ 
+    \note   If out_fft_length is non-zero and out_fft is non-Null, then no
+            buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_fft.
+ 
+    \param  in_number_of_frames The number of frames in in_signal.
+    \param  in_frame_length The number of samples in each frame.
+    \param  in_signal The in_number_of_frames * in_frame_length samples.
+    \param  out_fft_length  The number of elements returned in out_fft. This
+                            will always be in_number_of_frames * 2 * N where N
+                            is the power of 2 larger than or equal to
+                            in_frame_length.
+    \param  out_fft The FFTs of the frames, frame f starts at index 2 * N * f
+                    and is laid out as the output of csignal_calculate_FFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_signal, out_fft_length or out_fft
+                                        are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_number_of_frames or
+                                              in_frame_length is zero, or
+                                              out_fft_length is non-zero and
+                                              too small.
+ */
+csignal_error_code
+csignal_calculate_batch_FFT (
+                             USIZE      in_number_of_frames,
+                             USIZE      in_frame_length,
+                             FLOAT64*   in_signal,
+                             USIZE*     out_fft_length,
+                             FLOAT64**  out_fft
+                             );
+
 /*! \fn     csignal_error_code csignal_calculate_FFT (
               USIZE      in_signal_length,
               FLOAT64*   in_signal,
@@ -75,5 +1310,341 @@ csignal_calculate_IFFT (
                        FLOAT64**  out_signal
                        );
 
+/*! \fn     csignal_error_code csignal_calculate_complex_IFFT (
+              USIZE      in_fft_length,
+              FLOAT64*   in_fft,
+              USIZE*     out_signal_length,
+              FLOAT64**  out_signal
+            )
+    \brief  Calculates the IFFT of the complex-valued spectrum in_fft, e.g.,
+            the output of csignal_calculate_FFT or csignal_calculate_exact_FFT,
+            and scales it by 1 / N so that a round trip returns the original
+            signal. Unlike csignal_calculate_IFFT the imaginary components of
+            in_fft are used.
+ 
+    \note   If out_signal_length is non-zero and out_signal is non-Null, then
+            no buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_signal.
+ 
+    \note   The plan is taken from the plan cache but executed with scratch
+            space allocated for the call, so this function may be called by
+            several threads at the same time.
+ 
+    \param  in_fft_length The number of elements in in_fft, i.e., 2 * N where
+                          N is the number of bins. N does not need to be a power
+                          of two.
+    \param  in_fft  The N bins stored as interleaved real and imaginary
+                    components.
+    \param  out_signal_length The number of elements returned in out_signal.
+                              This will always be in_fft_length.
+    \param  out_signal  The N complex samples of the signal stored as
+                        interleaved real and imaginary components. May be the
+                        same buffer as in_fft.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_fft, out_signal_length or
+                                        out_signal are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_fft_length is zero or odd,
+                                              out_signal_length is non-zero
+                                              and smaller than in_fft_length,
+                                              or out_signal partially overlaps
+                                              in_fft.
+ */
+csignal_error_code
+csignal_calculate_complex_IFFT  (
+                                 USIZE      in_fft_length,
+                                 FLOAT64*   in_fft,
+                                 USIZE*     out_signal_length,
+                                 FLOAT64**  out_signal
+                                 );
+
+
+/*! \var    csignal_fft_plan_float32
+    \brief  The FLOAT32 version of csignal_fft_plan. The transform is the same
+            radix-4 algorithm executed by the same kernel selection (see
+            fft_kernels.h), but twice as many complex values fit in a SIMD
+            register and the data and twiddle factors take half the memory
+            bandwidth.
+ 
+    \note   The twiddle factors are calculated in FLOAT64 and rounded, so the
+            error of a FLOAT32 transform only comes from the butterflies. It
+            grows with log2( fft_length ): measured against the FLOAT64 path
+            on uniformly distributed input with the scalar, SSE2 and AVX2
+            kernels the RMS error relative to the RMS of the spectrum is about
+            1.1e-7 at 2^10 points and 1.6e-7 at 2^20 points, and the largest
+            error of any bin is below 1e-6 of the spectrum's RMS. A round trip
+            of 2^16 16-bit samples through the FFT and IFFT is off by at most
+            0.014, so the samples are recovered exactly after rounding. The
+            NEON kernel has not been measured (see CSIGNAL_FFT_ENABLE_NEON).
+ 
+    \note   FLOAT32 plans are always executed directly, i.e., there is no
+            six-step variant (see CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH).
+ */
+typedef struct csignal_fft_plan_float32_t
+{
+  /*! \var    fft_length
+      \brief  The number of complex points in the transform. Must be a power
+              of two.
+   */
+  USIZE     fft_length;
+  
+  /*! \var    bit_reversal
+      \brief  The bit-reversal permutation, fft_length elements.
+   */
+  USIZE*    bit_reversal;
+  
+  /*! \var    twiddles
+      \brief  The twiddle factors W^k for 0 <= k < 3 * fft_length / 4 stored
+              as interleaved real and imaginary components.
+   */
+  FLOAT32*  twiddles;
+  
+  /*! \var    next
+      \brief  Used to chain plans together in the plan cache. Null for plans
+              that are not in the cache.
+   */
+  struct csignal_fft_plan_float32_t* next;
+  
+} csignal_fft_plan_float32;
+
+/*! \fn     csignal_error_code csignal_initialize_fft_plan_float32 (
+              USIZE                      in_fft_length,
+              csignal_fft_plan_float32** out_plan
+            )
+    \brief  Creates a new FLOAT32 FFT plan for transforms of in_fft_length
+            complex points.
+ 
+    \param  in_fft_length The number of complex points in the transform. Must
+                          be a power of two.
+    \param  out_plan  The newly created plan. Must be freed by the caller using
+                      csignal_destroy_fft_plan_float32.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_fft_length is zero or not
+                                              a power of two.
+ */
+csignal_error_code
+csignal_initialize_fft_plan_float32 (
+                                     USIZE                      in_fft_length,
+                                     csignal_fft_plan_float32** out_plan
+                                     );
+
+/*! \fn     csignal_error_code csignal_destroy_fft_plan_float32 (
+              csignal_fft_plan_float32* io_plan
+            )
+    \brief  Frees the plan and all of its tables.
+ 
+    \note   Plans returned by csignal_get_fft_plan_float32 are owned by the
+            plan cache and must not be destroyed by the caller.
+ 
+    \param  io_plan The plan to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_plan is null.
+ */
+csignal_error_code
+csignal_destroy_fft_plan_float32  (
+                                   csignal_fft_plan_float32* io_plan
+                                   );
+
+/*! \fn     csignal_error_code csignal_get_fft_plan_float32 (
+              USIZE                      in_fft_length,
+              csignal_fft_plan_float32** out_plan
+            )
+    \brief  Returns the cached FLOAT32 plan for transforms of in_fft_length
+            complex points, creating and caching it if this is the first
+            request for that length. See csignal_get_fft_plan for the
+            ownership and locking rules.
+ 
+    \param  in_fft_length The number of complex points in the transform. Must
+                          be a power of two.
+    \param  out_plan  The cached plan.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_fft_plan_float32 for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_plan is null.
+ */
+csignal_error_code
+csignal_get_fft_plan_float32  (
+                               USIZE                      in_fft_length,
+                               csignal_fft_plan_float32** out_plan
+                               );
+
+/*! \fn     csignal_error_code csignal_execute_FFT_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data
+            )
+    \brief  Calculates the FFT of io_data in place using in_plan. See
+            csignal_execute_FFT.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued signal stored as interleaved real and
+                    imaginary components (2 * fft_length elements). Replaced by
+                    its FFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan or io_data are null.
+ */
+csignal_error_code
+csignal_execute_FFT_float32 (
+                             csignal_fft_plan_float32* in_plan,
+                             FLOAT32*                  io_data
+                             );
+
+/*! \fn     csignal_error_code csignal_execute_IFFT_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data
+            )
+    \brief  Calculates the unscaled IFFT of io_data in place using in_plan.
+            See csignal_execute_IFFT.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued spectrum stored as interleaved real and
+                    imaginary components (2 * fft_length elements). Replaced by
+                    its IFFT.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_plan or io_data are null.
+ */
+csignal_error_code
+csignal_execute_IFFT_float32  (
+                               csignal_fft_plan_float32* in_plan,
+                               FLOAT32*                  io_data
+                               );
+
+/*! \fn     csignal_error_code csignal_execute_FFT_out_of_place_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  in_data,
+              FLOAT32*                  out_data
+            )
+    \brief  Calculates the FFT of in_data into out_data using in_plan. See
+            csignal_execute_FFT_out_of_place.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued signal stored as interleaved real and
+                    imaginary components (2 * fft_length elements).
+    \param  out_data  The FFT of in_data (2 * fft_length elements). May be the
+                      same buffer as in_data, but must not otherwise overlap it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_FFT_out_of_place_float32  (
+                                           csignal_fft_plan_float32* in_plan,
+                                           FLOAT32*                  in_data,
+                                           FLOAT32*                  out_data
+                                           );
+
+/*! \fn     csignal_error_code csignal_execute_IFFT_out_of_place_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  in_data,
+              FLOAT32*                  out_data
+            )
+    \brief  Calculates the unscaled IFFT of in_data into out_data using
+            in_plan. See csignal_execute_FFT_out_of_place.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued spectrum stored as interleaved real and
+                    imaginary components (2 * fft_length elements).
+    \param  out_data  The IFFT of in_data (2 * fft_length elements). May be
+                      the same buffer as in_data, but must not otherwise overlap
+                      it.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_data and out_data partially
+                                              overlap.
+ */
+csignal_error_code
+csignal_execute_IFFT_out_of_place_float32 (
+                                           csignal_fft_plan_float32* in_plan,
+                                           FLOAT32*                  in_data,
+                                           FLOAT32*                  out_data
+                                           );
+
+/*! \fn     csignal_error_code csignal_calculate_FFT_float32 (
+              USIZE      in_signal_length,
+              FLOAT32*   in_signal,
+              USIZE*     out_fft_length,
+              FLOAT32**  out_fft
+            )
+    \brief  The FLOAT32 version of csignal_calculate_FFT: in_signal is
+            zero-padded to the next power of two and its FFT is returned with
+            the same layout.
+ 
+    \note   If out_fft_length is non-zero and out_fft is non-Null, then no
+            buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_fft.
+ 
+    \param  in_signal_length  The number of elements in in_signal.
+    \param  in_signal The signal whose FFT is to be calculated.
+    \param  out_fft_length  The number of elements returned in out_fft, i.e.,
+                            2 times the power of 2 larger than or equal to
+                            in_signal_length.
+    \param  out_fft The FFT of in_signal stored as interleaved real and
+                    imaginary components.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_signal, out_fft_length or out_fft
+                                        are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If out_fft_length is non-zero and
+                                              too small.
+ */
+csignal_error_code
+csignal_calculate_FFT_float32 (
+                               USIZE      in_signal_length,
+                               FLOAT32*   in_signal,
+                               USIZE*     out_fft_length,
+                               FLOAT32**  out_fft
+                               );
+
+/*! \fn     csignal_error_code csignal_calculate_complex_IFFT_float32 (
+              USIZE      in_fft_length,
+              FLOAT32*   in_fft,
+              USIZE*     out_signal_length,
+              FLOAT32**  out_signal
+            )
+    \brief  The FLOAT32 version of csignal_calculate_complex_IFFT, i.e., the
+            IFFT of the complex-valued spectrum in_fft scaled by 1 / N, except
+            that the number of bins must be a power of two.
+ 
+    \note   If out_signal_length is non-zero and out_signal is non-Null, then
+            no buffer will be allocated by this function. Otherwise, the caller
+            needs to free out_signal.
+ 
+    \param  in_fft_length The number of elements in in_fft, i.e., 2 * N where
+                          N is the number of bins.
+    \param  in_fft  The N bins stored as interleaved real and imaginary
+                    components.
+    \param  out_signal_length The number of elements returned in out_signal.
+                              This will always be in_fft_length.
+    \param  out_signal  The N complex samples of the signal stored as
+                        interleaved real and imaginary components. May be the
+                        same buffer as in_fft.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_fft, out_signal_length or
+                                        out_signal are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_fft_length / 2 is not a
+                                              power of two, or
+                                              out_signal_length is non-zero
+                                              and smaller than in_fft_length.
+ */
+csignal_error_code
+csignal_calculate_complex_IFFT_float32  (
+                                         USIZE      in_fft_length,
+                                         FLOAT32*   in_fft,
+                                         USIZE*     out_signal_length,
+                                         FLOAT32**  out_signal
+                                         );
 
 #endif  /*  __FFT_H__ */
@@ -0,0 +1,183 @@
+/*! \file   fft_kernels.h
+    \brief  The butterfly and bit-reversal kernels used to execute FFT plans.
+            A scalar implementation is always available and vectorized
+            implementations are provided for x86 (SSE2, AVX2) and ARM64
+            (NEON). The kernel used by all FFT plans is chosen when the library
+            is initialized based on the features of the CPU the library is
+            running on. FLOAT32 plans use the same selection, with twice as
+            many complex values per register.
+ 
+    \note   The AVX2 kernel requires a GCC compatible compiler (it is compiled
+            with a target attribute so the rest of the library does not need to
+            be built for AVX2). The SSE2 kernel is available on any x86
+            compiler that supports SSE2 intrinsics.
+ 
+    \note   The NEON kernel has not been built or verified on ARM64 hardware
+            yet, so it is only compiled, and selected by
+            csignal_fft_select_kernel, when the library is built with
+            CSIGNAL_FFT_ENABLE_NEON defined (e.g., -DCSIGNAL_FFT_ENABLE_NEON).
+            Other ARM64 builds use the scalar kernel.
+ 
+    \author Brent Carrara
+ */
+#ifndef __FFT_KERNELS_H__
+#define __FFT_KERNELS_H__
+
+#include <cpcommon.h>
+
+#include "fft.h"
+
+#include "csignal_error_codes.h"
+
+/*! \enum   csignal_fft_kernel_type
+    \brief  The FFT kernel implementations.
+ 
+ \var CSIGNAL_FFT_KERNEL_SCALAR
+      Portable C implementation, always available.
+ \var CSIGNAL_FFT_KERNEL_SSE2
+      Processes one complex value per 128-bit register.
+ \var CSIGNAL_FFT_KERNEL_AVX2
+      Processes two complex values per 256-bit register using fused
+      multiply-add.
+ \var CSIGNAL_FFT_KERNEL_NEON
+      Processes one complex value per 128-bit register on ARM64. Only
+      supported when built with CSIGNAL_FFT_ENABLE_NEON.
+ */
+typedef enum csignal_fft_kernel_type_t
+{
+  CSIGNAL_FFT_KERNEL_SCALAR = 0,
+  CSIGNAL_FFT_KERNEL_SSE2   = 1,
+  CSIGNAL_FFT_KERNEL_AVX2   = 2,
+  CSIGNAL_FFT_KERNEL_NEON   = 3
+} csignal_fft_kernel_type;
+
+/*! \fn     void csignal_fft_select_kernel( void )
+    \brief  Selects the fastest kernel supported by this build of the library
+            and the CPU it is running on. Called by csignal_initialize.
+ */
+void
+csignal_fft_select_kernel( void );
+
+/*! \fn     csignal_error_code csignal_fft_set_kernel (
+              csignal_fft_kernel_type in_type
+            )
+    \brief  Forces the kernel used by all FFT plans. Used to compare kernels
+            or to fall back to the scalar implementation.
+ 
+    \param  in_type The kernel to use.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_INVALID_PARAMETER  If the kernel is not supported by
+                                              this build or this CPU.
+ */
+csignal_error_code
+csignal_fft_set_kernel  (
+                         csignal_fft_kernel_type in_type
+                         );
+
+/*! \fn     csignal_fft_kernel_type csignal_fft_get_kernel( void )
+    \brief  Returns the kernel currently used by all FFT plans.
+ */
+csignal_fft_kernel_type
+csignal_fft_get_kernel( void );
+
+/*! \fn     void csignal_fft_run_kernel (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          io_data,
+              CHAR              in_sign
+            )
+    \brief  Calculates the FFT (or IFFT) of io_data in place with the selected
+            kernel, i.e., permutes io_data into bit-reversed order and then
+            performs the radix-4 butterflies.
+ 
+    \note   Six-step plans (see CSIGNAL_FFT_SIX_STEP_MINIMUM_LENGTH) have no
+            bit-reversal table and must be executed with the functions in
+            fft.h, which run the kernel on their sub-FFTs.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued signal stored as interleaved real and
+                    imaginary components.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_fft_run_kernel  (
+                         csignal_fft_plan* in_plan,
+                         FLOAT64*          io_data,
+                         CHAR              in_sign
+                         );
+
+/*! \fn     void csignal_fft_run_kernel_out_of_place (
+              csignal_fft_plan* in_plan,
+              FLOAT64*          in_data,
+              FLOAT64*          out_data,
+              CHAR              in_sign
+            )
+    \brief  Calculates the FFT (or IFFT) of in_data into out_data with the
+            selected kernel. The bit-reversal permutation is done while copying
+            in_data to out_data so no separate copy pass is needed.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued signal stored as interleaved real and
+                    imaginary components. Not modified unless it is the same
+                    buffer as out_data.
+    \param  out_data  The transform of in_data (2 * fft_length elements). May
+                      be the same buffer as in_data, but must not otherwise
+                      overlap it.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_fft_run_kernel_out_of_place (
+                                     csignal_fft_plan* in_plan,
+                                     FLOAT64*          in_data,
+                                     FLOAT64*          out_data,
+                                     CHAR              in_sign
+                                     );
+
+/*! \fn     void csignal_fft_run_kernel_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  io_data,
+              CHAR                      in_sign
+            )
+    \brief  The FLOAT32 version of csignal_fft_run_kernel.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  io_data The complex-valued signal stored as interleaved real and
+                    imaginary components.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_fft_run_kernel_float32  (
+                                 csignal_fft_plan_float32* in_plan,
+                                 FLOAT32*                  io_data,
+                                 CHAR                      in_sign
+                                 );
+
+/*! \fn     void csignal_fft_run_kernel_out_of_place_float32 (
+              csignal_fft_plan_float32* in_plan,
+              FLOAT32*                  in_data,
+              FLOAT32*                  out_data,
+              CHAR                      in_sign
+            )
+    \brief  The FLOAT32 version of csignal_fft_run_kernel_out_of_place.
+ 
+    \param  in_plan The plan for the transform length.
+    \param  in_data The complex-valued signal stored as interleaved real and
+                    imaginary components.
+    \param  out_data  The transform of in_data (2 * fft_length elements). May
+                      be the same buffer as in_data, but must not otherwise
+                      overlap it.
+    \param  in_sign If +1 the FFT will be calculated, if -1 the IFFT will be
+                    calculated.
+ */
+void
+csignal_fft_run_kernel_out_of_place_float32 (
+                                             csignal_fft_plan_float32* in_plan,
+                                             FLOAT32*                  in_data,
+                                             FLOAT32*                  out_data,
+                                             CHAR                      in_sign
+                                             );
+
+#endif  /*  __FFT_KERNELS_H__ */
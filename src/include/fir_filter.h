@@ -93,6 +93,16 @@ typedef struct fir_passband_filter_t
    */
   FLOAT64*  coefficients;
   
+  /*! \var    symmetric
+      \brief  CPC_TRUE if the coefficients are symmetric, i.e., coefficient j
+              equals coefficient number_of_taps - 1 - j, as for the linear
+              phase Kaiser filters. Filtering then uses the folded kernels (see
+              convolve_symmetric). It is CPC_FALSE after
+              csignal_initialize_passband_filter and must be reset to
+              CPC_FALSE if the coefficients are changed by other means.
+   */
+  CPC_BOOL  symmetric;
+  
 } fir_passband_filter;
 
 /*! \fn     csignal_error_code csignal_initialize_passband_filter (
@@ -193,6 +203,91 @@ csignal_filter_signal (
                        FLOAT64**            out_filtered_signal
                        );
 
+/*! \fn     csignal_error_code csignal_filter_with_mode  (
+              fir_passband_filter*     in_filter,
+              csignal_convolution_mode in_mode,
+              USIZE                    in_signal_length,
+              FLOAT64*                 in_signal,
+              USIZE*                   out_filtered_signal_length,
+              FLOAT64**                out_filtered_signal
+            )
+    \brief  Filters in_signal like csignal_filter_signal, but only calculates
+            the part of the output selected by in_mode (see
+            csignal_convolution_mode). CSIGNAL_CONVOLUTION_MODE_SAME returns
+            in_signal_length samples with the group delay of a linear-phase
+            filter removed, so no samples have to be copied or skipped by the
+            caller. CSIGNAL_CONVOLUTION_MODE_VALID returns only the samples for
+            which the filter overlaps in_signal completely.
+ 
+    \param  in_filter The filter to apply to in_signal.
+    \param  in_mode The part of the filtered signal to calculate.
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The samples to filter.
+    \param  out_filtered_signal_length  The length of the filtered signal, see
+                                        convolve_with_mode.
+    \param  out_filtered_signal The filtered signal.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see convolve_with_mode for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_filer, in_signal,
+                                        out_filtered_signal_length or
+                                        out_filtered_signal are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_signal_length is 0 or the
+                                              number of taps in in_filter is 0.
+ */
+csignal_error_code
+csignal_filter_with_mode  (
+                           fir_passband_filter*     in_filter,
+                           csignal_convolution_mode in_mode,
+                           USIZE                    in_signal_length,
+                           FLOAT64*                 in_signal,
+                           USIZE*                   out_filtered_signal_length,
+                           FLOAT64**                out_filtered_signal
+                           );
+
+/*! \fn     csignal_error_code csignal_filter_decimated  (
+              fir_passband_filter*     in_filter,
+              csignal_convolution_mode in_mode,
+              USIZE                    in_decimation,
+              USIZE                    in_signal_length,
+              FLOAT64*                 in_signal,
+              USIZE*                   out_filtered_signal_length,
+              FLOAT64**                out_filtered_signal
+            )
+    \brief  Filters in_signal like csignal_filter_with_mode, but only
+            calculates every in_decimation-th sample of the selected part,
+            starting with its first (see convolve_decimated). This replaces
+            filtering the whole signal and discarding the samples in between.
+ 
+    \param  in_filter The filter to apply to in_signal.
+    \param  in_mode The part of the filtered signal to calculate.
+    \param  in_decimation The distance between the calculated samples.
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The samples to filter.
+    \param  out_filtered_signal_length  The length of the filtered signal, see
+                                        convolve_decimated.
+    \param  out_filtered_signal The decimated filtered signal.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see convolve_decimated for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_filer, in_signal,
+                                        out_filtered_signal_length or
+                                        out_filtered_signal are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_signal_length is 0, the
+                                              number of taps in in_filter is 0
+                                              or in_decimation is 0.
+ */
+csignal_error_code
+csignal_filter_decimated  (
+                           fir_passband_filter*     in_filter,
+                           csignal_convolution_mode in_mode,
+                           USIZE                    in_decimation,
+                           USIZE                    in_signal_length,
+                           FLOAT64*                 in_signal,
+                           USIZE*                   out_filtered_signal_length,
+                           FLOAT64**                out_filtered_signal
+                           );
+
 /*! \fn     csignal_error_code csignal_filter_get_group_delay  (
               fir_passband_filter* in_filter,
               UINT32*              out_group_delay
@@ -231,4 +326,171 @@ csignal_filter_get_filter_length  (
                                    UINT32* in_filter_length
                                    );
 
+/*! \def    CSIGNAL_FIR_FILTER_STATE_SEGMENT_LENGTH
+    \brief  The largest number of input samples a fir_filter_state filters
+            with one call of the convolution kernels. The delay line holds
+            number_of_taps - 1 plus this many samples twice, so longer
+            segments trade memory for fewer kernel calls per block.
+ */
+#ifndef CSIGNAL_FIR_FILTER_STATE_SEGMENT_LENGTH
+#define CSIGNAL_FIR_FILTER_STATE_SEGMENT_LENGTH 256
+#endif
+
+/*! \var    fir_filter_state
+    \brief  The history of a stream filtered by a fir_passband_filter, so that
+            a stream can be filtered block by block with exactly one output per
+            input sample and no discontinuities between blocks, i.e., the
+            outputs of all blocks are the first samples of the full
+            convolution of the concatenated blocks with the filter taps.
+ 
+            The delay line is circular with delay_line_length samples, each of
+            which is stored twice, at position p and p + delay_line_length.
+            The last delay_line_length samples are therefore always contiguous
+            in memory and the taps are applied to them without checking for
+            the wraparound of the delay line.
+ 
+    \note   The state refers to, but does not own, its filter. The filter must
+            outlive the state and a state must not be used by two threads at
+            the same time.
+ */
+typedef struct fir_filter_state_t
+{
+  /*! \var    filter
+      \brief  The filter whose taps are applied to the stream.
+   */
+  fir_passband_filter*  filter;
+  
+  /*! \var    delay_line_length
+      \brief  The number of samples in the circular delay line, i.e.,
+              number_of_taps - 1 plus the segment length.
+   */
+  USIZE                 delay_line_length;
+  
+  /*! \var    delay_line
+      \brief  The 2 * delay_line_length samples of the double-buffered delay
+              line, initially zero.
+   */
+  FLOAT64*              delay_line;
+  
+  /*! \var    position
+      \brief  The position in the delay line of the next input sample.
+   */
+  USIZE                 position;
+  
+} fir_filter_state;
+
+/*! \fn     csignal_error_code csignal_initialize_fir_filter_state (
+              fir_passband_filter*  in_filter,
+              fir_filter_state**    out_state
+            )
+    \brief  Creates a state for filtering a stream with in_filter. The stream
+            starts out with a history of zeros.
+ 
+    \param  in_filter The filter to apply, see fir_filter_state.
+    \param  out_state The newly created state. Must be freed by the caller
+                      using csignal_destroy_fir_filter_state.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see cpc_safe_malloc for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters or the
+                                        coefficients of in_filter are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_filter has no taps.
+ */
+csignal_error_code
+csignal_initialize_fir_filter_state  (
+                                      fir_passband_filter*  in_filter,
+                                      fir_filter_state**    out_state
+                                      );
+
+/*! \fn     csignal_error_code csignal_destroy_fir_filter_state (
+              fir_filter_state* io_state
+            )
+    \brief  Frees the state and its delay line, but not its filter.
+ 
+    \param  io_state  The state to free.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see cpc_safe_free for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_state is null.
+ */
+csignal_error_code
+csignal_destroy_fir_filter_state (
+                                  fir_filter_state* io_state
+                                  );
+
+/*! \fn     csignal_error_code csignal_reset_fir_filter_state (
+              fir_filter_state* io_state
+            )
+    \brief  Clears the history of the stream, e.g., to start a new stream.
+ 
+    \param  io_state  The state to reset.
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_state is null.
+ */
+csignal_error_code
+csignal_reset_fir_filter_state (
+                                fir_filter_state* io_state
+                                );
+
+/*! \fn     csignal_error_code csignal_fir_filter_state_process (
+              fir_filter_state* io_state,
+              USIZE             in_number_of_samples,
+              FLOAT64*          in_samples,
+              FLOAT64*          out_samples
+            )
+    \brief  Filters the next in_number_of_samples samples of the stream. Output
+            i is the sum over the taps j of coefficients[ j ] times the input
+            sample j samples before input i, where the samples before the
+            first call are zero. Blocks may have any length and the function
+            does not allocate memory.
+ 
+    \param  io_state  The state of the stream, updated with in_samples.
+    \param  in_number_of_samples  The number of samples in in_samples and
+                                  out_samples. May be zero.
+    \param  in_samples  The next samples of the stream.
+    \param  out_samples The filtered samples. May be the same array as
+                        in_samples to filter in place.
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+ */
+csignal_error_code
+csignal_fir_filter_state_process (
+                                  fir_filter_state* io_state,
+                                  USIZE             in_number_of_samples,
+                                  FLOAT64*          in_samples,
+                                  FLOAT64*          out_samples
+                                  );
+
+/*! \fn     csignal_error_code csignal_fir_filter_state_push (
+              fir_filter_state* io_state,
+              USIZE             in_number_of_samples,
+              FLOAT64*          in_samples
+            )
+    \brief  Appends in_samples to the stream without filtering them, for
+            filters that calculate only some of the outputs (see
+            polyphase.h). Afterwards the last delay_line_length samples of the
+            stream, the newest last, are delay_line[ position ] to
+            delay_line[ position + delay_line_length - 1 ].
+ 
+    \param  io_state  The state of the stream, updated with in_samples.
+    \param  in_number_of_samples  The number of samples in in_samples, at most
+                                  CSIGNAL_FIR_FILTER_STATE_SEGMENT_LENGTH, so
+                                  that the taps still fit behind the oldest
+                                  new sample.
+    \param  in_samples  The next samples of the stream.
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_number_of_samples is too
+                                              large.
+ */
+csignal_error_code
+csignal_fir_filter_state_push (
+                               fir_filter_state* io_state,
+                               USIZE             in_number_of_samples,
+                               FLOAT64*          in_samples
+                               );
+
 #endif  /*  __FIR_FILTER_H__  */
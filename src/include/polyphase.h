@@ -0,0 +1,298 @@
+/*! \file   polyphase.h
+    \brief  Polyphase decimating and interpolating FIR filters, i.e., FIR
+            filters combined with an integer sample rate change that only
+            calculate the outputs that are kept.
+ 
+            Filtering with h and then keeping every Mth sample
+            (decimation) calculates M outputs for every one that is kept. The
+            decimator only calculates the kept outputs, so it does
+            number_of_taps / M multiplies per input sample instead of
+            number_of_taps.
+ 
+            Inserting L - 1 zeros after every sample and then filtering with h
+            (interpolation) multiplies most taps with zeros. Output n * L + p
+            only depends on the taps h[ k * L + p ], the pth phase of the
+            filter, so the interpolator filters the input with each of the L
+            phases of number_of_taps / L taps and interleaves the results. It
+            does number_of_taps multiplies per input sample instead of
+            number_of_taps * L.
+ 
+            Both filter a stream block by block and keep its history like a
+            fir_filter_state, so blocks may have any length and the processing
+            functions do not allocate memory.
+ 
+    \author Brent Carrara
+ */
+#ifndef __POLYPHASE_H__
+#define __POLYPHASE_H__
+
+#include <cpcommon.h>
+
+#include "fir_filter.h"
+
+#include "csignal_error_codes.h"
+
+/*! \var    fir_decimator
+    \brief  A FIR filter followed by keeping every decimation-th output,
+            starting with the output for the first input sample of the
+            stream, i.e., output n is
+ 
+              y[ n ] = sum_j h[ j ] * x[ n * decimation - j ].
+ 
+    \note   The decimator refers to, but does not own, its filter. The filter
+            must outlive the decimator.
+ */
+typedef struct fir_decimator_t
+{
+  /*! \var    state
+      \brief  The history of the input stream.
+   */
+  fir_filter_state* state;
+  
+  /*! \var    decimation
+      \brief  The number of input samples per output sample.
+   */
+  USIZE             decimation;
+  
+  /*! \var    skip
+      \brief  The number of input samples before the next one whose output is
+              kept.
+   */
+  USIZE             skip;
+  
+} fir_decimator;
+
+/*! \var    fir_interpolator
+    \brief  Inserting interpolation - 1 zeros after every input sample followed
+            by a FIR filter, scaled by interpolation so that the passband keeps
+            its amplitude, i.e., output n * interpolation + p is
+ 
+              y[ n * L + p ] = L * sum_k h[ k * L + p ] * x[ n - k ]
+ 
+            with L the interpolation.
+ 
+    \note   The interpolator copies the taps of its filter into its phases,
+            but its history refers to the filter, so the filter must outlive
+            the interpolator.
+ */
+typedef struct fir_interpolator_t
+{
+  /*! \var    state
+      \brief  The history of the input stream.
+   */
+  fir_filter_state* state;
+  
+  /*! \var    interpolation
+      \brief  The number of output samples per input sample.
+   */
+  USIZE             interpolation;
+  
+  /*! \var    phase_length
+      \brief  The number of taps in each phase, number_of_taps divided by
+              interpolation rounded up.
+   */
+  USIZE             phase_length;
+  
+  /*! \var    phases
+      \brief  The interpolation phases of phase_length taps each, one after
+              the other and scaled by interpolation. Phase p holds the taps
+              h[ k * interpolation + p ], padded with zeros.
+   */
+  FLOAT64*          phases;
+  
+  /*! \var    buffer
+      \brief  The outputs of one phase for one segment of input samples (see
+              CSIGNAL_FIR_FILTER_STATE_SEGMENT_LENGTH) before they are
+              interleaved.
+   */
+  FLOAT64*          buffer;
+  
+} fir_interpolator;
+
+/*! \fn     csignal_error_code csignal_initialize_fir_decimator (
+              fir_passband_filter*  in_filter,
+              USIZE                 in_decimation,
+              fir_decimator**       out_decimator
+            )
+    \brief  Creates a decimator that filters with in_filter and keeps every
+            in_decimation-th output. The stream starts out with a history of
+            zeros. in_filter should be a lowpass filter with its cutoff below
+            half the output sample rate, e.g., from
+            csignal_inititalize_kaiser_lowpass_filter.
+ 
+    \param  in_filter The filter to apply, see fir_decimator.
+    \param  in_decimation The decimation factor M.
+    \param  out_decimator The newly created decimator. Must be freed by the
+                          caller using csignal_destroy_fir_decimator.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see csignal_initialize_fir_filter_state for other possible
+            errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_filter or out_decimator are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_decimation is zero.
+ */
+csignal_error_code
+csignal_initialize_fir_decimator (
+                                  fir_passband_filter*  in_filter,
+                                  USIZE                 in_decimation,
+                                  fir_decimator**       out_decimator
+                                  );
+
+/*! \fn     csignal_error_code csignal_destroy_fir_decimator (
+              fir_decimator* io_decimator
+            )
+    \brief  Frees the decimator and its history, but not its filter.
+ 
+    \param  io_decimator  The decimator to free.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see cpc_safe_free for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_decimator is null.
+ */
+csignal_error_code
+csignal_destroy_fir_decimator  (
+                                fir_decimator* io_decimator
+                                );
+
+/*! \fn     csignal_error_code csignal_reset_fir_decimator (
+              fir_decimator* io_decimator
+            )
+    \brief  Clears the history of the stream, the next input sample is the
+            first of a new stream.
+ 
+    \param  io_decimator  The decimator to reset.
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_decimator is null.
+ */
+csignal_error_code
+csignal_reset_fir_decimator  (
+                              fir_decimator* io_decimator
+                              );
+
+/*! \fn     csignal_error_code csignal_fir_decimator_process (
+              fir_decimator*  io_decimator,
+              USIZE           in_number_of_samples,
+              FLOAT64*        in_samples,
+              USIZE*          out_number_of_outputs,
+              FLOAT64*        out_samples
+            )
+    \brief  Filters and decimates the next in_number_of_samples samples of the
+            stream. Depending on where the block starts relative to the kept
+            outputs it produces in_number_of_samples / M outputs, rounded down
+            or up.
+ 
+    \param  io_decimator  The decimator, updated with in_samples.
+    \param  in_number_of_samples  The number of samples in in_samples. May be
+                                  zero.
+    \param  in_samples  The next samples of the stream.
+    \param  out_number_of_outputs The number of outputs written to
+                                  out_samples.
+    \param  out_samples The outputs. Must hold at least
+                        ( in_number_of_samples + M - 1 ) / M samples and must
+                        not overlap in_samples.
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+ */
+csignal_error_code
+csignal_fir_decimator_process  (
+                                fir_decimator*  io_decimator,
+                                USIZE           in_number_of_samples,
+                                FLOAT64*        in_samples,
+                                USIZE*          out_number_of_outputs,
+                                FLOAT64*        out_samples
+                                );
+
+/*! \fn     csignal_error_code csignal_initialize_fir_interpolator (
+              fir_passband_filter*  in_filter,
+              USIZE                 in_interpolation,
+              fir_interpolator**    out_interpolator
+            )
+    \brief  Creates an interpolator that inserts in_interpolation - 1 zeros
+            after every sample and filters with in_filter. The stream starts
+            out with a history of zeros. in_filter should be a lowpass filter
+            with its cutoff below half the input sample rate, designed for the
+            output sample rate.
+ 
+    \param  in_filter The filter to apply, see fir_interpolator.
+    \param  in_interpolation  The interpolation factor L.
+    \param  out_interpolator  The newly created interpolator. Must be freed
+                              by the caller using
+                              csignal_destroy_fir_interpolator.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see csignal_initialize_fir_filter_state and cpc_safe_malloc for
+            other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_filter or out_interpolator are
+                                        null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_interpolation is zero.
+ */
+csignal_error_code
+csignal_initialize_fir_interpolator  (
+                                      fir_passband_filter*  in_filter,
+                                      USIZE                 in_interpolation,
+                                      fir_interpolator**    out_interpolator
+                                      );
+
+/*! \fn     csignal_error_code csignal_destroy_fir_interpolator (
+              fir_interpolator* io_interpolator
+            )
+    \brief  Frees the interpolator, its phases and its history, but not its
+            filter.
+ 
+    \param  io_interpolator The interpolator to free.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see cpc_safe_free for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_interpolator is null.
+ */
+csignal_error_code
+csignal_destroy_fir_interpolator (
+                                  fir_interpolator* io_interpolator
+                                  );
+
+/*! \fn     csignal_error_code csignal_reset_fir_interpolator (
+              fir_interpolator* io_interpolator
+            )
+    \brief  Clears the history of the stream, the next input sample is the
+            first of a new stream.
+ 
+    \param  io_interpolator The interpolator to reset.
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_interpolator is null.
+ */
+csignal_error_code
+csignal_reset_fir_interpolator (
+                                fir_interpolator* io_interpolator
+                                );
+
+/*! \fn     csignal_error_code csignal_fir_interpolator_process (
+              fir_interpolator* io_interpolator,
+              USIZE             in_number_of_samples,
+              FLOAT64*          in_samples,
+              FLOAT64*          out_samples
+            )
+    \brief  Interpolates the next in_number_of_samples samples of the stream,
+            producing in_number_of_samples * L outputs.
+ 
+    \param  io_interpolator The interpolator, updated with in_samples.
+    \param  in_number_of_samples  The number of samples in in_samples. May be
+                                  zero.
+    \param  in_samples  The next samples of the stream.
+    \param  out_samples The in_number_of_samples * L outputs. Must not overlap
+                        in_samples.
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+ */
+csignal_error_code
+csignal_fir_interpolator_process (
+                                  fir_interpolator* io_interpolator,
+                                  USIZE             in_number_of_samples,
+                                  FLOAT64*          in_samples,
+                                  FLOAT64*          out_samples
+                                  );
+
+#endif  /*  __POLYPHASE_H__  */
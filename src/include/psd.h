@@ -0,0 +1,90 @@
+/*! \file   psd.h
+    \brief  Power spectral density (PSD) estimation with Welch's method.
+ 
+            The signal is cut into segments of segment_length samples that
+            overlap by overlap_length samples. Every segment is multiplied by a
+            window and transformed with a real-input FFT, and the squared
+            magnitudes of the bins are averaged over all segments. Averaging
+            reduces the variance of the estimate at the cost of the frequency
+            resolution, which is sample_rate / segment_length.
+ 
+    \author Brent Carrara
+ */
+#ifndef __PSD_H__
+#define __PSD_H__
+
+#include <cpcommon.h>
+
+#include "window.h"
+
+#include "csignal_error_codes.h"
+
+/*! \fn     csignal_error_code csignal_calculate_welch_PSD (
+              USIZE               in_signal_length,
+              FLOAT64*            in_signal,
+              UINT32              in_sample_rate,
+              USIZE               in_segment_length,
+              USIZE               in_overlap_length,
+              csignal_window_type in_window_type,
+              FLOAT64             in_window_parameter,
+              USIZE               in_psd_length,
+              FLOAT64*            out_psd
+            )
+    \brief  Calculates the one-sided PSD of in_signal with Welch's method.
+            Bin k is the density at k * in_sample_rate / in_segment_length Hz
+            in units of in_signal squared per Hz:
+ 
+              P[ k ] = c / ( Fs * sum( w^2 ) ) * mean( |X_m[ k ]|^2 ),
+ 
+            where X_m is the FFT of the m-th windowed segment and c is 1 for
+            the DC and Nyquist bins and 2 for the others, so the sum of P
+            times the bin width is the mean power of in_signal.
+ 
+    \note   Segments are spread over the threads of the pool returned by
+            csignal_get_thread_pool. Each thread averages its own buffer, so no
+            memory is allocated per segment. The segments are summed in groups
+            that do not depend on the number of threads, so the PSD is the
+            same for any number of threads.
+ 
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The real-valued signal.
+    \param  in_sample_rate  The sample rate of in_signal in Hz.
+    \param  in_segment_length The number of samples in a segment, which is also
+                              the FFT length. Must be a power of two greater
+                              than or equal to 2.
+    \param  in_overlap_length The number of samples consecutive segments share,
+                              e.g., in_segment_length / 2. Samples after the
+                              last complete segment are ignored.
+    \param  in_window_type  The window applied to every segment. The periodic
+                            form of the window is used.
+    \param  in_window_parameter The shape parameter of the window, see
+                                csignal_calculate_window.
+    \param  in_psd_length The number of elements in out_psd. Must be at least
+                          in_segment_length / 2 + 1.
+    \param  out_psd The in_segment_length / 2 + 1 bins of the PSD.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_calculate_window for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_signal or out_psd are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_sample_rate is zero,
+                                              in_segment_length is not a power
+                                              of two, in_overlap_length is not
+                                              smaller than in_segment_length,
+                                              in_signal_length is smaller than
+                                              in_segment_length or
+                                              in_psd_length is too small.
+ */
+csignal_error_code
+csignal_calculate_welch_PSD (
+                             USIZE               in_signal_length,
+                             FLOAT64*            in_signal,
+                             UINT32              in_sample_rate,
+                             USIZE               in_segment_length,
+                             USIZE               in_overlap_length,
+                             csignal_window_type in_window_type,
+                             FLOAT64             in_window_parameter,
+                             USIZE               in_psd_length,
+                             FLOAT64*            out_psd
+                             );
+
+#endif  /*  __PSD_H__  */
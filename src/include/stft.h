@@ -0,0 +1,449 @@
+/*! \file   stft.h
+    \brief  Streaming short-time Fourier transform (STFT) and its inverse.
+ 
+            The STFT cuts the input into frames of window_length samples that
+            start hop_length samples apart. Each frame is multiplied by the
+            analysis window, zero-padded to fft_length samples and transformed
+            with a real-input FFT, producing fft_length / 2 + 1 bins. Samples
+            are accepted in blocks of any size and complete frames are written
+            to a ring of preallocated frames that the caller drains, so no
+            memory is allocated after the object is created.
+ 
+            The inverse (ISTFT) transforms each frame back, multiplies it by
+            the synthesis window and overlap-adds it, normalizing every output
+            sample by the sum of the squared windows that overlapped it. When
+            both use the same window the ISTFT of the STFT returns the original
+            samples wherever that sum is non-zero, for any hop that is not
+            larger than the window.
+ 
+    \author Brent Carrara
+ */
+#ifndef __STFT_H__
+#define __STFT_H__
+
+#include <cpcommon.h>
+
+#include "fft.h"
+#include "window.h"
+
+#include "csignal_error_codes.h"
+
+/*! \enum   csignal_stft_output_type
+    \brief  The content of the frames produced by an STFT.
+ 
+ \var CSIGNAL_STFT_OUTPUT_COMPLEX
+      fft_length / 2 + 1 bins stored as interleaved real and imaginary
+      components (fft_length + 2 elements). This is the input of the ISTFT.
+ \var CSIGNAL_STFT_OUTPUT_MAGNITUDE
+      The magnitudes of the fft_length / 2 + 1 bins.
+ */
+typedef enum csignal_stft_output_type_t
+{
+  CSIGNAL_STFT_OUTPUT_COMPLEX   = 0,
+  CSIGNAL_STFT_OUTPUT_MAGNITUDE = 1
+} csignal_stft_output_type;
+
+/*! \var    csignal_stft
+    \brief  The state of a streaming STFT.
+ */
+typedef struct csignal_stft_t
+{
+  /*! \var    window_length
+      \brief  The number of samples in a frame.
+   */
+  USIZE                     window_length;
+  
+  /*! \var    hop_length
+      \brief  The number of samples between the starts of consecutive frames.
+   */
+  USIZE                     hop_length;
+  
+  /*! \var    fft_length
+      \brief  The length of the FFT each frame is zero-padded to.
+   */
+  USIZE                     fft_length;
+  
+  /*! \var    output_type
+      \brief  The content of the frames in the ring.
+   */
+  csignal_stft_output_type  output_type;
+  
+  /*! \var    frame_length
+      \brief  The number of FLOAT64 elements in one frame of the ring, i.e.,
+              fft_length + 2 for complex frames and fft_length / 2 + 1 for
+              magnitude frames.
+   */
+  USIZE                     frame_length;
+  
+  /*! \var    window
+      \brief  The window_length coefficients of the analysis window.
+   */
+  FLOAT64*                  window;
+  
+  /*! \var    samples
+      \brief  The window_length most recent samples that have not yet been
+              shifted out by a hop.
+   */
+  FLOAT64*                  samples;
+  
+  /*! \var    number_of_samples
+      \brief  The number of valid samples in samples.
+   */
+  USIZE                     number_of_samples;
+  
+  /*! \var    fft_buffer
+      \brief  fft_length + 2 elements holding the windowed frame and its FFT.
+   */
+  FLOAT64*                  fft_buffer;
+  
+  /*! \var    plan
+      \brief  The real-input FFT plan for fft_length samples. Owned by the
+              STFT so that STFTs can be used from different threads.
+   */
+  csignal_real_fft_plan*    plan;
+  
+  /*! \var    frames
+      \brief  The ring of number_of_frames * frame_length elements.
+   */
+  FLOAT64*                  frames;
+  
+  /*! \var    number_of_frames
+      \brief  The number of frames the ring can hold.
+   */
+  USIZE                     number_of_frames;
+  
+  /*! \var    read_index
+      \brief  The index in the ring of the oldest frame.
+   */
+  USIZE                     read_index;
+  
+  /*! \var    frame_count
+      \brief  The number of frames in the ring that have not been read.
+   */
+  USIZE                     frame_count;
+  
+} csignal_stft;
+
+/*! \var    csignal_istft
+    \brief  The state of a streaming inverse STFT.
+ */
+typedef struct csignal_istft_t
+{
+  /*! \var    window_length
+      \brief  The number of samples in a frame.
+   */
+  USIZE                   window_length;
+  
+  /*! \var    hop_length
+      \brief  The number of samples between the starts of consecutive frames,
+              i.e., the number of samples produced by each frame.
+   */
+  USIZE                   hop_length;
+  
+  /*! \var    fft_length
+      \brief  The length of the FFT of the frames.
+   */
+  USIZE                   fft_length;
+  
+  /*! \var    window
+      \brief  The window_length coefficients of the synthesis window.
+   */
+  FLOAT64*                window;
+  
+  /*! \var    fft_buffer
+      \brief  fft_length + 2 elements holding a frame and its IFFT.
+   */
+  FLOAT64*                fft_buffer;
+  
+  /*! \var    accumulator
+      \brief  The overlap-added, windowed frames of the window_length samples
+              that have not been output yet.
+   */
+  FLOAT64*                accumulator;
+  
+  /*! \var    window_sum
+      \brief  The sum of the squared windows added to each sample of
+              accumulator, used to normalize the output.
+   */
+  FLOAT64*                window_sum;
+  
+  /*! \var    plan
+      \brief  The real-input FFT plan for fft_length samples. Owned by the
+              ISTFT.
+   */
+  csignal_real_fft_plan*  plan;
+  
+} csignal_istft;
+
+/*! \fn     csignal_error_code csignal_initialize_stft (
+              USIZE                    in_window_length,
+              USIZE                    in_hop_length,
+              USIZE                    in_fft_length,
+              csignal_window_type      in_window_type,
+              FLOAT64                  in_window_parameter,
+              csignal_stft_output_type in_output_type,
+              USIZE                    in_number_of_frames,
+              csignal_stft**           out_stft
+            )
+    \brief  Creates an STFT. The analysis window is the periodic window of
+            in_window_length points (see csignal_calculate_window).
+ 
+    \param  in_window_length  The number of samples in a frame.
+    \param  in_hop_length The number of samples between the starts of
+                          consecutive frames. Must be between 1 and
+                          in_window_length.
+    \param  in_fft_length The FFT length. Must be a power of two larger than or
+                          equal to in_window_length and at least 2.
+    \param  in_window_type  The analysis window.
+    \param  in_window_parameter The window's shape parameter (see
+                                csignal_calculate_window).
+    \param  in_output_type  The content of the frames in the ring.
+    \param  in_number_of_frames The number of frames the ring can hold.
+    \param  out_stft  The newly created STFT. Must be freed by the caller using
+                      csignal_destroy_stft.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_calculate_window and cpc_safe_malloc for more error
+            codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_stft is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If any of the lengths are invalid.
+            CSIGNAL_ERROR_CODE_INVALID_TYPE If in_output_type is not an output
+                                            type.
+ */
+csignal_error_code
+csignal_initialize_stft (
+                         USIZE                    in_window_length,
+                         USIZE                    in_hop_length,
+                         USIZE                    in_fft_length,
+                         csignal_window_type      in_window_type,
+                         FLOAT64                  in_window_parameter,
+                         csignal_stft_output_type in_output_type,
+                         USIZE                    in_number_of_frames,
+                         csignal_stft**           out_stft
+                         );
+
+/*! \fn     csignal_error_code csignal_destroy_stft (
+              csignal_stft* io_stft
+            )
+    \brief  Frees the STFT and all of its buffers.
+ 
+    \param  io_stft The STFT to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_stft is null.
+ */
+csignal_error_code
+csignal_destroy_stft  (
+                       csignal_stft* io_stft
+                       );
+
+/*! \fn     csignal_error_code csignal_reset_stft (
+              csignal_stft* io_stft
+            )
+    \brief  Discards the buffered samples and every frame in the ring, i.e.,
+            the next sample added starts a new stream.
+ 
+    \param  io_stft The STFT to reset.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_stft is null.
+ */
+csignal_error_code
+csignal_reset_stft  (
+                     csignal_stft* io_stft
+                     );
+
+/*! \fn     csignal_error_code csignal_stft_add_samples (
+              csignal_stft* io_stft,
+              USIZE         in_number_of_samples,
+              FLOAT64*      in_samples,
+              USIZE*        out_number_of_samples_consumed
+            )
+    \brief  Adds samples to the STFT and writes every frame they complete to
+            the ring. If the ring fills up the function stops before the
+            sample that would complete the next frame, so no frame is ever
+            lost: the caller reads frames and adds the remaining samples.
+ 
+    \param  io_stft The STFT.
+    \param  in_number_of_samples  The number of samples in in_samples.
+    \param  in_samples  The next samples of the stream.
+    \param  out_number_of_samples_consumed  The number of samples from the
+                                            start of in_samples that were added.
+                                            Equal to in_number_of_samples unless
+                                            the ring is full.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+ */
+csignal_error_code
+csignal_stft_add_samples  (
+                           csignal_stft* io_stft,
+                           USIZE         in_number_of_samples,
+                           FLOAT64*      in_samples,
+                           USIZE*        out_number_of_samples_consumed
+                           );
+
+/*! \fn     USIZE csignal_stft_get_number_of_frames (
+              csignal_stft* in_stft
+            )
+    \brief  Returns the number of frames in the ring that have not been read,
+            or 0 if in_stft is null.
+ */
+USIZE
+csignal_stft_get_number_of_frames (
+                                   csignal_stft* in_stft
+                                   );
+
+/*! \fn     USIZE csignal_stft_get_frame_length (
+              csignal_stft* in_stft
+            )
+    \brief  Returns the number of FLOAT64 elements in a frame, or 0 if in_stft
+            is null.
+ */
+USIZE
+csignal_stft_get_frame_length (
+                               csignal_stft* in_stft
+                               );
+
+/*! \fn     csignal_error_code csignal_stft_read_frame (
+              csignal_stft* io_stft,
+              USIZE         in_frame_length,
+              FLOAT64*      out_frame
+            )
+    \brief  Copies the oldest frame in the ring to out_frame and removes it
+            from the ring.
+ 
+    \param  io_stft The STFT.
+    \param  in_frame_length The number of elements in out_frame. Must be at
+                            least frame_length.
+    \param  out_frame The oldest frame.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_frame_length is too small.
+            CSIGNAL_ERROR_CODE_NO_DATA  If the ring is empty.
+ */
+csignal_error_code
+csignal_stft_read_frame (
+                         csignal_stft* io_stft,
+                         USIZE         in_frame_length,
+                         FLOAT64*      out_frame
+                         );
+
+/*! \fn     csignal_error_code csignal_initialize_istft (
+              USIZE               in_window_length,
+              USIZE               in_hop_length,
+              USIZE               in_fft_length,
+              csignal_window_type in_window_type,
+              FLOAT64             in_window_parameter,
+              csignal_istft**     out_istft
+            )
+    \brief  Creates an inverse STFT. The parameters must match those of the
+            STFT that produced the frames.
+ 
+    \param  in_window_length  The number of samples in a frame.
+    \param  in_hop_length The number of samples between the starts of
+                          consecutive frames. Must be between 1 and
+                          in_window_length.
+    \param  in_fft_length The FFT length. Must be a power of two larger than or
+                          equal to in_window_length and at least 2.
+    \param  in_window_type  The synthesis window.
+    \param  in_window_parameter The window's shape parameter (see
+                                csignal_calculate_window).
+    \param  out_istft The newly created ISTFT. Must be freed by the caller using
+                      csignal_destroy_istft.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_calculate_window and cpc_safe_malloc for more error
+            codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_istft is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If any of the lengths are invalid.
+ */
+csignal_error_code
+csignal_initialize_istft  (
+                           USIZE               in_window_length,
+                           USIZE               in_hop_length,
+                           USIZE               in_fft_length,
+                           csignal_window_type in_window_type,
+                           FLOAT64             in_window_parameter,
+                           csignal_istft**     out_istft
+                           );
+
+/*! \fn     csignal_error_code csignal_destroy_istft (
+              csignal_istft* io_istft
+            )
+    \brief  Frees the ISTFT and all of its buffers.
+ 
+    \param  io_istft  The ISTFT to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_istft is null.
+ */
+csignal_error_code
+csignal_destroy_istft (
+                       csignal_istft* io_istft
+                       );
+
+/*! \fn     csignal_error_code csignal_istft_add_frame (
+              csignal_istft* io_istft,
+              USIZE          in_frame_length,
+              FLOAT64*       in_frame,
+              USIZE          in_signal_length,
+              FLOAT64*       out_signal
+            )
+    \brief  Overlap-adds the inverse of a complex STFT frame and outputs the
+            hop_length samples that no later frame overlaps, i.e., frame m
+            produces samples m * hop_length to ( m + 1 ) * hop_length - 1 of
+            the stream.
+ 
+    \param  io_istft  The ISTFT.
+    \param  in_frame_length The number of elements in in_frame. Must be
+                            fft_length + 2.
+    \param  in_frame  The fft_length / 2 + 1 bins stored as interleaved real
+                      and imaginary components. Not modified.
+    \param  in_signal_length  The number of elements in out_signal. Must be at
+                              least hop_length.
+    \param  out_signal  The next hop_length samples of the stream.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_frame_length or
+                                              in_signal_length are invalid.
+ */
+csignal_error_code
+csignal_istft_add_frame (
+                         csignal_istft* io_istft,
+                         USIZE          in_frame_length,
+                         FLOAT64*       in_frame,
+                         USIZE          in_signal_length,
+                         FLOAT64*       out_signal
+                         );
+
+/*! \fn     csignal_error_code csignal_istft_flush (
+              csignal_istft* io_istft,
+              USIZE          in_signal_length,
+              FLOAT64*       out_signal
+            )
+    \brief  Outputs the window_length - hop_length samples of the last frame
+            that are still waiting to be overlapped and resets the ISTFT.
+ 
+    \param  io_istft  The ISTFT.
+    \param  in_signal_length  The number of elements in out_signal. Must be at
+                              least window_length - hop_length.
+    \param  out_signal  The last window_length - hop_length samples of the
+                        stream.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the pointers are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_signal_length is too small.
+ */
+csignal_error_code
+csignal_istft_flush (
+                     csignal_istft* io_istft,
+                     USIZE          in_signal_length,
+                     FLOAT64*       out_signal
+                     );
+
+#endif  /*  __STFT_H__  */
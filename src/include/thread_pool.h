@@ -0,0 +1,174 @@
+/*! \file   thread_pool.h
+    \brief  A fixed-size pool of worker threads used to split large transforms
+            into independent pieces of work. The pool executes one parallel
+            loop at a time: a task function is called once for every index in
+            [ 0, number of tasks ) and the caller blocks, taking part in the
+            work, until every index has been processed.
+ 
+    \note   The library does not create a pool by default, i.e., every
+            algorithm runs on the calling thread until
+            csignal_set_number_of_threads is called with a value larger than
+            one.
+ 
+    \author Brent Carrara
+ */
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <cpcommon.h>
+
+#include "csignal_error_codes.h"
+
+/*! \var    csignal_thread_pool
+    \brief  Opaque handle to a pool of worker threads. The definition depends
+            on the threading library of the platform (POSIX threads or Win32
+            threads) and is private to thread_pool.c.
+ */
+typedef struct csignal_thread_pool_t csignal_thread_pool;
+
+/*! \var    csignal_thread_pool_task
+    \brief  The work executed by the pool. Called once for each task index,
+            possibly concurrently from different threads, so a task must only
+            write to memory that no other index writes to.
+ 
+    \param  in_argument The argument passed to csignal_thread_pool_run.
+    \param  in_index  The index of the task, 0 <= in_index < number of tasks.
+ */
+typedef void ( *csignal_thread_pool_task )  (
+                                             void* in_argument,
+                                             USIZE in_index
+                                             );
+
+/*! \fn     csignal_error_code csignal_initialize_thread_pool (
+              USIZE                 in_number_of_threads,
+              csignal_thread_pool** out_pool
+            )
+    \brief  Creates a pool that executes tasks on in_number_of_threads
+            threads. The thread that calls csignal_thread_pool_run counts as
+            one of them, so in_number_of_threads - 1 worker threads are
+            started.
+ 
+    \param  in_number_of_threads  The number of threads tasks are spread over.
+                                  Must be at least one.
+    \param  out_pool  The newly created pool. Must be freed by the caller using
+                      csignal_destroy_thread_pool.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_malloc for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_pool is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_number_of_threads is zero.
+            CSIGNAL_ERROR_CODE_THREAD_ERROR If a worker thread could not be
+                                            created.
+ */
+csignal_error_code
+csignal_initialize_thread_pool  (
+                                 USIZE                 in_number_of_threads,
+                                 csignal_thread_pool** out_pool
+                                 );
+
+/*! \fn     csignal_error_code csignal_destroy_thread_pool (
+              csignal_thread_pool* io_pool
+            )
+    \brief  Stops and joins the worker threads and frees the pool. Must not be
+            called while the pool is executing tasks.
+ 
+    \param  io_pool The pool to free.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see cpc_safe_free for more error codes):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_pool is null.
+ */
+csignal_error_code
+csignal_destroy_thread_pool (
+                             csignal_thread_pool* io_pool
+                             );
+
+/*! \fn     USIZE csignal_thread_pool_get_number_of_threads (
+              csignal_thread_pool* in_pool
+            )
+    \brief  Returns the number of threads tasks are spread over, including the
+            calling thread, or 1 if in_pool is null.
+ */
+USIZE
+csignal_thread_pool_get_number_of_threads (
+                                           csignal_thread_pool* in_pool
+                                           );
+
+/*! \fn     void csignal_thread_pool_run (
+              csignal_thread_pool*     in_pool,
+              USIZE                    in_number_of_tasks,
+              csignal_thread_pool_task in_task,
+              void*                    in_argument
+            )
+    \brief  Calls in_task( in_argument, i ) for 0 <= i < in_number_of_tasks
+            spread over the threads of in_pool and returns when every call has
+            completed. If in_pool is null the tasks are executed in order on
+            the calling thread.
+ 
+    \note   Concurrent calls on the same pool are serialized. A task must not
+            call csignal_thread_pool_run on the pool that is executing it.
+ 
+    \param  in_pool The pool to execute the tasks on, or null.
+    \param  in_number_of_tasks  The number of task indices.
+    \param  in_task The work to execute for each index.
+    \param  in_argument Passed unchanged to every call of in_task.
+ */
+void
+csignal_thread_pool_run (
+                         csignal_thread_pool*     in_pool,
+                         USIZE                    in_number_of_tasks,
+                         csignal_thread_pool_task in_task,
+                         void*                    in_argument
+                         );
+
+/*! \fn     csignal_error_code csignal_set_number_of_threads (
+              USIZE in_number_of_threads
+            )
+    \brief  Sets the number of threads the library may use to execute large
+            transforms (see csignal_get_thread_pool). A value of 0 or 1
+            releases the shared pool so that everything runs on the calling
+            thread, which is the default.
+ 
+    \note   Must not be called while another thread is executing a transform.
+ 
+    \param  in_number_of_threads  The number of threads, including the
+                                  calling thread.
+    \return Returns NO_ERROR upon succesful exection or one of these errors
+            (see csignal_initialize_thread_pool for more error codes).
+ */
+csignal_error_code
+csignal_set_number_of_threads (
+                               USIZE in_number_of_threads
+                               );
+
+/*! \fn     csignal_thread_pool* csignal_get_thread_pool( void )
+    \brief  Returns the pool shared by the library's algorithms, or null if
+            csignal_set_number_of_threads has not been called with a value
+            larger than one.
+ */
+csignal_thread_pool*
+csignal_get_thread_pool( void );
+
+/*! \fn     void csignal_release_thread_pool( void )
+    \brief  Destroys the shared pool. Called by csignal_terminate.
+ */
+void
+csignal_release_thread_pool( void );
+
+/*! \fn     void csignal_lock_library( void )
+    \brief  Acquires the process-wide lock that protects the library's global
+            state, e.g., the FFT plan caches, so that it can be used from
+            several threads at the same time. The lock is not recursive and
+            must only be held for short lookups, never while calling a
+            function that may acquire it again.
+ */
+void
+csignal_lock_library( void );
+
+/*! \fn     void csignal_unlock_library( void )
+    \brief  Releases the lock acquired by csignal_lock_library.
+ */
+void
+csignal_unlock_library( void );
+
+#endif  /*  __THREAD_POOL_H__  */
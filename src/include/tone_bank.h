@@ -0,0 +1,221 @@
+/*! \file   tone_bank.h
+    \brief  Measures the power of a signal at a small set of frequencies
+            without a full FFT.
+ 
+            The Goertzel algorithm calculates a single DFT coefficient of a
+            block of samples with one multiply-add per sample, at any
+            (including non-integer bin) frequency. The tone bank tracks the
+            same coefficients over a sliding window of the most recent samples
+            with a sliding DFT, i.e., an O(1) update per sample per tone. To
+            keep rounding errors from accumulating in the recursion, the
+            coefficients are recalculated from the window with the Goertzel
+            algorithm every window_length samples, which does not change the
+            amortized cost.
+ 
+            Both calculate, for a window of N samples x ending with the most
+            recent sample x[ n ] and a frequency f,
+ 
+              Y = sum_{j=0}^{N-1} x[ n - j ] * exp( 2 * pi * i * f * j / Fs )
+ 
+            and report its power |Y|^2, which is the power of the DFT bin at f
+            of the window.
+ 
+    \author Brent Carrara
+ */
+#ifndef __TONE_BANK_H__
+#define __TONE_BANK_H__
+
+#include <cpcommon.h>
+
+#include "csignal_error_codes.h"
+
+/*! \var    csignal_tone_bank
+    \brief  The state of a sliding DFT evaluated at a set of frequencies.
+ */
+typedef struct csignal_tone_bank_t
+{
+  /*! \var    number_of_tones
+      \brief  The number of frequencies tracked.
+   */
+  USIZE     number_of_tones;
+  
+  /*! \var    window_length
+      \brief  The number of most recent samples the power is measured over.
+   */
+  USIZE     window_length;
+  
+  /*! \var    rotations
+      \brief  exp( 2 * pi * i * f / Fs ) for every tone, stored as interleaved
+              real and imaginary components.
+   */
+  FLOAT64*  rotations;
+  
+  /*! \var    window_rotations
+      \brief  exp( 2 * pi * i * f * window_length / Fs ) for every tone, the
+              phase of the sample that leaves the window, stored as
+              interleaved real and imaginary components.
+   */
+  FLOAT64*  window_rotations;
+  
+  /*! \var    states
+      \brief  The DFT coefficient Y of every tone, stored as interleaved real
+              and imaginary components.
+   */
+  FLOAT64*  states;
+  
+  /*! \var    history
+      \brief  A ring of the window_length most recent samples. The window is
+              zero-filled until window_length samples have been added.
+   */
+  FLOAT64*  history;
+  
+  /*! \var    history_index
+      \brief  The position in history of the oldest sample, which is replaced
+              by the next sample added.
+   */
+  USIZE     history_index;
+} csignal_tone_bank;
+
+/*! \fn     csignal_error_code csignal_calculate_goertzel_power (
+              FLOAT64   in_frequency,
+              UINT32    in_sample_rate,
+              USIZE     in_signal_length,
+              FLOAT64*  in_signal,
+              FLOAT64*  out_power
+            )
+    \brief  Calculates the power |Y|^2 of in_signal at in_frequency with the
+            Goertzel algorithm.
+ 
+    \param  in_frequency  The frequency to measure in Hz.
+    \param  in_sample_rate  The sample rate of in_signal in Hz.
+    \param  in_signal_length  The number of samples in in_signal.
+    \param  in_signal The samples, oldest first.
+    \param  out_power The power at in_frequency.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_signal or out_power are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_sample_rate or
+                                              in_signal_length are zero.
+ */
+csignal_error_code
+csignal_calculate_goertzel_power  (
+                                   FLOAT64   in_frequency,
+                                   UINT32    in_sample_rate,
+                                   USIZE     in_signal_length,
+                                   FLOAT64*  in_signal,
+                                   FLOAT64*  out_power
+                                   );
+
+/*! \fn     csignal_error_code csignal_initialize_tone_bank (
+              USIZE               in_number_of_tones,
+              FLOAT64*            in_frequencies,
+              UINT32              in_sample_rate,
+              USIZE               in_window_length,
+              csignal_tone_bank** out_tone_bank
+            )
+    \brief  Creates a tone bank that measures the power at in_frequencies over
+            the in_window_length most recent samples.
+ 
+    \param  in_number_of_tones  The number of frequencies in in_frequencies.
+    \param  in_frequencies  The frequencies to measure in Hz.
+    \param  in_sample_rate  The sample rate of the samples in Hz.
+    \param  in_window_length  The number of samples the power is measured
+                              over. Frequencies that are multiples of
+                              in_sample_rate / in_window_length fall exactly on
+                              DFT bins and do not leak into each other.
+    \param  out_tone_bank The tone bank. Must be destroyed with
+                          csignal_destroy_tone_bank.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_frequencies or out_tone_bank are
+                                        null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_number_of_tones,
+                                              in_sample_rate or
+                                              in_window_length are zero.
+ */
+csignal_error_code
+csignal_initialize_tone_bank  (
+                               USIZE               in_number_of_tones,
+                               FLOAT64*            in_frequencies,
+                               UINT32              in_sample_rate,
+                               USIZE               in_window_length,
+                               csignal_tone_bank** out_tone_bank
+                               );
+
+/*! \fn     csignal_error_code csignal_destroy_tone_bank (
+              csignal_tone_bank* io_tone_bank
+            )
+    \brief  Releases the memory of a tone bank.
+ 
+    \param  io_tone_bank  The tone bank to destroy.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_tone_bank is null.
+ */
+csignal_error_code
+csignal_destroy_tone_bank (
+                           csignal_tone_bank* io_tone_bank
+                           );
+
+/*! \fn     csignal_error_code csignal_reset_tone_bank (
+              csignal_tone_bank* io_tone_bank
+            )
+    \brief  Discards all samples added to the tone bank.
+ 
+    \param  io_tone_bank  The tone bank to reset.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_tone_bank is null.
+ */
+csignal_error_code
+csignal_reset_tone_bank (
+                         csignal_tone_bank* io_tone_bank
+                         );
+
+/*! \fn     csignal_error_code csignal_tone_bank_add_samples (
+              csignal_tone_bank* io_tone_bank,
+              USIZE              in_number_of_samples,
+              FLOAT64*           in_samples
+            )
+    \brief  Slides the window of the tone bank over in_samples.
+ 
+    \param  io_tone_bank  The tone bank.
+    \param  in_number_of_samples  The number of samples in in_samples.
+    \param  in_samples  The samples, oldest first.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If io_tone_bank or in_samples are null.
+ */
+csignal_error_code
+csignal_tone_bank_add_samples (
+                               csignal_tone_bank* io_tone_bank,
+                               USIZE              in_number_of_samples,
+                               FLOAT64*           in_samples
+                               );
+
+/*! \fn     csignal_error_code csignal_tone_bank_get_power (
+              csignal_tone_bank* in_tone_bank,
+              USIZE              in_number_of_tones,
+              FLOAT64*           out_power
+            )
+    \brief  Returns the power |Y|^2 of every tone over the current window.
+ 
+    \param  in_tone_bank  The tone bank.
+    \param  in_number_of_tones  The number of elements in out_power, must be at
+                                least the number of tones of the bank.
+    \param  out_power The power of every tone, in the order of the frequencies
+                      the bank was initialized with.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_tone_bank or out_power are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_number_of_tones is smaller
+                                              than the number of tones.
+ */
+csignal_error_code
+csignal_tone_bank_get_power (
+                             csignal_tone_bank* in_tone_bank,
+                             USIZE              in_number_of_tones,
+                             FLOAT64*           out_power
+                             );
+
+#endif  /*  __TONE_BANK_H__  */
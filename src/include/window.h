@@ -0,0 +1,81 @@
+/*! \file   window.h
+    \brief  Window functions applied to frames of a signal before spectral
+            analysis (e.g., the STFT) to reduce the leakage caused by the
+            discontinuities at the frame boundaries.
+ 
+    \author Brent Carrara
+ */
+#ifndef __WINDOW_H__
+#define __WINDOW_H__
+
+#include <cpcommon.h>
+
+#include "csignal_error_codes.h"
+
+/*! \enum   csignal_window_type
+    \brief  The supported window functions.
+ 
+ \var CSIGNAL_WINDOW_RECTANGULAR
+      All coefficients are one, i.e., the frame is not modified.
+ \var CSIGNAL_WINDOW_HANN
+      0.5 - 0.5 * cos( 2 * pi * n / M ).
+ \var CSIGNAL_WINDOW_HAMMING
+      0.54 - 0.46 * cos( 2 * pi * n / M ).
+ \var CSIGNAL_WINDOW_BLACKMAN
+      0.42 - 0.5 * cos( 2 * pi * n / M ) + 0.08 * cos( 4 * pi * n / M ).
+ \var CSIGNAL_WINDOW_KAISER
+      I0( beta * sqrt( 1 - ( 2 * n / M - 1 )^2 ) ) / I0( beta ), the same
+      window used by the Kaiser filter design in kaiser_filter.h.
+ */
+typedef enum csignal_window_type_t
+{
+  CSIGNAL_WINDOW_RECTANGULAR  = 0,
+  CSIGNAL_WINDOW_HANN         = 1,
+  CSIGNAL_WINDOW_HAMMING      = 2,
+  CSIGNAL_WINDOW_BLACKMAN     = 3,
+  CSIGNAL_WINDOW_KAISER       = 4
+} csignal_window_type;
+
+/*! \fn     csignal_error_code csignal_calculate_window (
+              csignal_window_type in_type,
+              FLOAT64             in_parameter,
+              CPC_BOOL            in_periodic,
+              USIZE               in_window_length,
+              FLOAT64*            out_window
+            )
+    \brief  Calculates the in_window_length coefficients of a window.
+ 
+    \note   A symmetric window (M = in_window_length - 1) is the one used for
+            filter design. A periodic window (M = in_window_length) is the
+            symmetric window of in_window_length + 1 points without its last
+            point, which is the window to use for spectral analysis: it is
+            exactly periodic in the frame length, so shifted copies of a Hann
+            window with a hop of in_window_length / 2 (or / 4) sum to a
+            constant.
+ 
+    \param  in_type The window function.
+    \param  in_parameter  The shape parameter beta of the Kaiser window. Larger
+                          values give lower sidelobes and a wider main lobe.
+                          Ignored by the other windows.
+    \param  in_periodic If true the periodic window is calculated, otherwise the
+                        symmetric window.
+    \param  in_window_length  The number of coefficients.
+    \param  out_window  The in_window_length coefficients.
+    \return Returns NO_ERROR upon succesful exection or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If out_window is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If in_window_length is zero or
+                                              in_parameter is negative for a
+                                              Kaiser window.
+            CSIGNAL_ERROR_CODE_INVALID_TYPE If in_type is not a window type.
+ */
+csignal_error_code
+csignal_calculate_window  (
+                           csignal_window_type in_type,
+                           FLOAT64             in_parameter,
+                           CPC_BOOL            in_periodic,
+                           USIZE               in_window_length,
+                           FLOAT64*            out_window
+                           );
+
+#endif  /*  __WINDOW_H__  */
@@ -517,6 +517,9 @@ csignal_set_kaiser_weights  (
                M_PI * ( ( i - middle_tap ) * 1.0 )
                );
     }
+    
+    //  The window and the ideal response are even about the middle tap
+    io_filter->symmetric = CPC_TRUE;
   }
   
   return( return_value );
@@ -819,6 +822,9 @@ csignal_set_kaiser_lowpass_weights  (
                io_filter->coefficients[ i ]
                );
     }
+    
+    //  Both the window and the sinc are even about the middle tap
+    io_filter->symmetric = CPC_TRUE;
   }
   
   return( return_value );
@@ -0,0 +1,505 @@
+/*! \file   polyphase.c
+    \brief  The implementation of the polyphase decimator and interpolator.
+ 
+    \author Brent Carrara
+ */
+#include "polyphase.h"
+
+#include "conv_kernels.h"
+
+csignal_error_code
+csignal_initialize_fir_decimator (
+                                  fir_passband_filter*  in_filter,
+                                  USIZE                 in_decimation,
+                                  fir_decimator**       out_decimator
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_filter || NULL == out_decimator )
+  {
+    CPC_ERROR (
+               "Filter (0x%x) or decimator (0x%x) are null.",
+               in_filter,
+               out_decimator
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_decimation )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Decimation must be positive." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_decimator = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_decimator, sizeof( fir_decimator ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      fir_decimator* decimator = *out_decimator;
+      
+      decimator->state      = NULL;
+      decimator->decimation = in_decimation;
+      decimator->skip       = 0;
+      
+      return_value =
+        csignal_initialize_fir_filter_state (
+                                             in_filter,
+                                             &( decimator->state )
+                                             );
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not initialize decimator: 0x%x.", return_value );
+        
+        cpc_safe_free( ( void** ) out_decimator );
+        
+        *out_decimator = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc decimator: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_fir_decimator  (
+                                fir_decimator* io_decimator
+                                )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_decimator )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Decimator is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_decimator->state )
+    {
+      return_value = csignal_destroy_fir_filter_state( io_decimator->state );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_decimator );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_reset_fir_decimator  (
+                              fir_decimator* io_decimator
+                              )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_decimator )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Decimator is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    return_value = csignal_reset_fir_filter_state( io_decimator->state );
+    
+    io_decimator->skip = 0;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_fir_decimator_process  (
+                                fir_decimator*  io_decimator,
+                                USIZE           in_number_of_samples,
+                                FLOAT64*        in_samples,
+                                USIZE*          out_number_of_outputs,
+                                FLOAT64*        out_samples
+                                )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == io_decimator
+       || NULL == io_decimator->state
+       || NULL == in_samples
+       || NULL == out_number_of_outputs
+       || NULL == out_samples
+       )
+  {
+    CPC_ERROR (
+               "Decimator (0x%x), input (0x%x), number of outputs (0x%x),"
+               " or output (0x%x) are null.",
+               io_decimator,
+               in_samples,
+               out_number_of_outputs,
+               out_samples
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    fir_filter_state* state = io_decimator->state;
+    
+    USIZE decimation      = io_decimator->decimation;
+    USIZE number_of_taps  = state->filter->number_of_taps;
+    USIZE length          = state->delay_line_length;
+    USIZE segment_length  = length - number_of_taps + 1;
+    
+    USIZE offset = 0;
+    
+    *out_number_of_outputs = 0;
+    
+    while  (
+            offset < in_number_of_samples
+            && CPC_ERROR_CODE_NO_ERROR == return_value
+            )
+    {
+      USIZE count =
+        CPC_MIN( USIZE, segment_length, in_number_of_samples - offset );
+      
+      return_value =
+        csignal_fir_filter_state_push( state, count, in_samples + offset );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        USIZE skip = io_decimator->skip;
+        
+        if( skip < count )
+        {
+          //  Only the outputs of every decimation-th sample are calculated,
+          //  starting skip samples into the segment, which is what the
+          //  polyphase decomposition of the filter amounts to
+          USIZE first   = state->position + length - count + skip;
+          USIZE outputs = ( count - skip - 1 ) / decimation + 1;
+          
+          FLOAT64* output = out_samples + *out_number_of_outputs;
+          
+          if( state->filter->symmetric )
+          {
+            csignal_conv_run_symmetric_kernel (
+                                               state->position + length,
+                                               state->delay_line,
+                                               number_of_taps,
+                                               state->filter->coefficients,
+                                               first,
+                                               decimation,
+                                               outputs,
+                                               output
+                                               );
+          }
+          else
+          {
+            csignal_conv_run_strided_kernel (
+                                             state->position + length,
+                                             state->delay_line,
+                                             number_of_taps,
+                                             state->filter->coefficients,
+                                             first,
+                                             decimation,
+                                             outputs,
+                                             output
+                                             );
+          }
+          
+          io_decimator->skip = skip + outputs * decimation - count;
+          
+          *out_number_of_outputs += outputs;
+        }
+        else
+        {
+          io_decimator->skip = skip - count;
+        }
+      }
+      
+      offset += count;
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_fir_interpolator  (
+                                      fir_passband_filter*  in_filter,
+                                      USIZE                 in_interpolation,
+                                      fir_interpolator**    out_interpolator
+                                      )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == in_filter
+       || NULL == in_filter->coefficients
+       || NULL == out_interpolator
+       )
+  {
+    CPC_ERROR (
+               "Filter (0x%x), its coefficients, or interpolator (0x%x) are"
+               " null.",
+               in_filter,
+               out_interpolator
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_interpolation )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Interpolation must be positive." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_interpolator = NULL;
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) out_interpolator,
+                       sizeof( fir_interpolator )
+                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      fir_interpolator* interpolator = *out_interpolator;
+      
+      interpolator->state         = NULL;
+      interpolator->interpolation = in_interpolation;
+      interpolator->phase_length  =
+        ( in_filter->number_of_taps + in_interpolation - 1 )
+        / in_interpolation;
+      interpolator->phases        = NULL;
+      interpolator->buffer        = NULL;
+      
+      //  The history is sized for all of the taps, which leaves room for the
+      //  phase_length taps of each phase
+      return_value =
+        csignal_initialize_fir_filter_state (
+                                             in_filter,
+                                             &( interpolator->state )
+                                             );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( interpolator->phases ),
+                           sizeof( FLOAT64 ) * in_interpolation
+                           * interpolator->phase_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( interpolator->buffer ),
+                           sizeof( FLOAT64 )
+                           * CSIGNAL_FIR_FILTER_STATE_SEGMENT_LENGTH
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        USIZE phase_length = interpolator->phase_length;
+        
+        //  Phase p gets every interpolation-th tap starting at tap p, scaled
+        //  by interpolation for the samples that the zeros take the place of
+        for( USIZE p = 0; p < in_interpolation; p++ )
+        {
+          for( USIZE k = 0; k < phase_length; k++ )
+          {
+            USIZE tap = k * in_interpolation + p;
+            
+            interpolator->phases[ p * phase_length + k ] =
+              ( tap < in_filter->number_of_taps )
+              ? in_interpolation * in_filter->coefficients[ tap ]
+              : 0.0;
+          }
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not initialize interpolator: 0x%x.", return_value );
+        
+        csignal_destroy_fir_interpolator( *out_interpolator );
+        
+        *out_interpolator = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc interpolator: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_fir_interpolator (
+                                  fir_interpolator* io_interpolator
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_interpolator )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Interpolator is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_interpolator->state )
+    {
+      return_value =
+        csignal_destroy_fir_filter_state( io_interpolator->state );
+    }
+    
+    if  (
+         CPC_ERROR_CODE_NO_ERROR == return_value
+         && NULL != io_interpolator->phases
+         )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_interpolator->phases ) );
+    }
+    
+    if  (
+         CPC_ERROR_CODE_NO_ERROR == return_value
+         && NULL != io_interpolator->buffer
+         )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_interpolator->buffer ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_interpolator );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_reset_fir_interpolator (
+                                fir_interpolator* io_interpolator
+                                )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_interpolator )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Interpolator is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    return_value = csignal_reset_fir_filter_state( io_interpolator->state );
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_fir_interpolator_process (
+                                  fir_interpolator* io_interpolator,
+                                  USIZE             in_number_of_samples,
+                                  FLOAT64*          in_samples,
+                                  FLOAT64*          out_samples
+                                  )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == io_interpolator
+       || NULL == io_interpolator->state
+       || NULL == io_interpolator->phases
+       || NULL == io_interpolator->buffer
+       || NULL == in_samples
+       || NULL == out_samples
+       )
+  {
+    CPC_ERROR (
+               "Interpolator (0x%x), input (0x%x), or output (0x%x) are null.",
+               io_interpolator,
+               in_samples,
+               out_samples
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    fir_filter_state* state = io_interpolator->state;
+    
+    USIZE interpolation   = io_interpolator->interpolation;
+    USIZE phase_length    = io_interpolator->phase_length;
+    USIZE length          = state->delay_line_length;
+    USIZE segment_length  = length - state->filter->number_of_taps + 1;
+    
+    FLOAT64* buffer = io_interpolator->buffer;
+    
+    USIZE offset = 0;
+    
+    while  (
+            offset < in_number_of_samples
+            && CPC_ERROR_CODE_NO_ERROR == return_value
+            )
+    {
+      USIZE count =
+        CPC_MIN( USIZE, segment_length, in_number_of_samples - offset );
+      
+      return_value =
+        csignal_fir_filter_state_push( state, count, in_samples + offset );
+      
+      //  Each phase filters the input samples at the input rate and fills
+      //  every interpolation-th output, so the zeros are never multiplied
+      for (
+           USIZE p = 0;
+           p < interpolation && CPC_ERROR_CODE_NO_ERROR == return_value;
+           p++
+           )
+      {
+        FLOAT64* output = out_samples + offset * interpolation + p;
+        
+        csignal_conv_run_kernel (
+                                 state->position + length,
+                                 state->delay_line,
+                                 phase_length,
+                                 io_interpolator->phases + p * phase_length,
+                                 state->position + length - count,
+                                 count,
+                                 buffer
+                                 );
+        
+        for( USIZE i = 0; i < count; i++ )
+        {
+          output[ i * interpolation ] = buffer[ i ];
+        }
+      }
+      
+      offset += count;
+    }
+  }
+  
+  return( return_value );
+}
@@ -0,0 +1,372 @@
+/*! \file   psd.c
+    \brief  The implementation of Welch's PSD estimator.
+ 
+    \author Brent Carrara
+ */
+#include "psd.h"
+
+#include "fft.h"
+#include "thread_pool.h"
+
+/*! \def    CSIGNAL_WELCH_NUMBER_OF_GROUPS
+    \brief  The maximum number of groups the segments of a Welch PSD are
+            divided into. Every group is summed into its own accumulator and
+            the accumulators are added in order, so the PSD does not depend on
+            the number of threads.
+ */
+#define CSIGNAL_WELCH_NUMBER_OF_GROUPS  64
+
+/*! \var    csignal_welch_job
+    \brief  The state shared by the tasks of a Welch PSD. The segments are
+            divided into contiguous groups that are each summed into their own
+            accumulator, and every task sums a contiguous range of groups.
+ */
+typedef struct csignal_welch_job_t
+{
+  /*! \var    signal
+      \brief  The signal being analyzed.
+   */
+  FLOAT64*                signal;
+  
+  /*! \var    window
+      \brief  The segment_length coefficients of the window.
+   */
+  FLOAT64*                window;
+  
+  /*! \var    plan
+      \brief  The real-input plan for segment_length samples.
+   */
+  csignal_real_fft_plan*  plan;
+  
+  /*! \var    segment_length
+      \brief  The number of samples in a segment.
+   */
+  USIZE                   segment_length;
+  
+  /*! \var    step_length
+      \brief  The number of samples between the starts of consecutive
+              segments, i.e., segment_length - overlap_length.
+   */
+  USIZE                   step_length;
+  
+  /*! \var    number_of_segments
+      \brief  The number of complete segments in the signal.
+   */
+  USIZE                   number_of_segments;
+  
+  /*! \var    number_of_groups
+      \brief  The number of groups the segments are divided into.
+   */
+  USIZE                   number_of_groups;
+  
+  /*! \var    number_of_tasks
+      \brief  The number of ranges the groups are divided into.
+   */
+  USIZE                   number_of_tasks;
+  
+  /*! \var    buffers
+      \brief  One FFT buffer of segment_length + 2 elements per task.
+   */
+  FLOAT64*                buffers;
+  
+  /*! \var    scratch
+      \brief  The work space of the FFTs of a task, scratch_length elements
+              per task, or null if the plan needs none. The plan is shared with
+              other threads, so its own scratch space is not used.
+   */
+  FLOAT64*                scratch;
+  
+  /*! \var    scratch_length
+      \brief  csignal_get_real_fft_scratch_length( plan ).
+   */
+  USIZE                   scratch_length;
+  
+  /*! \var    accumulators
+      \brief  One sum of |X[ k ]|^2 of segment_length / 2 + 1 elements per
+              group.
+   */
+  FLOAT64*                accumulators;
+  
+} csignal_welch_job;
+
+/*! \fn     void csignal_welch_task (
+              void* in_job,
+              USIZE in_index
+            )
+    \brief  Sums |X[ k ]|^2 of the windowed segments of every group in range
+            in_index into the accumulator of that group.
+ 
+    \param  in_job  The csignal_welch_job.
+    \param  in_index  The range of groups to sum.
+ */
+void
+csignal_welch_task  (
+                     void* in_job,
+                     USIZE in_index
+                     );
+
+csignal_error_code
+csignal_calculate_welch_PSD (
+                             USIZE               in_signal_length,
+                             FLOAT64*            in_signal,
+                             UINT32              in_sample_rate,
+                             USIZE               in_segment_length,
+                             USIZE               in_overlap_length,
+                             csignal_window_type in_window_type,
+                             FLOAT64             in_window_parameter,
+                             USIZE               in_psd_length,
+                             FLOAT64*            out_psd
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_signal || NULL == out_psd )
+  {
+    CPC_ERROR( "Signal (0x%x) or PSD (0x%x) are null.", in_signal, out_psd );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           0 == in_sample_rate
+           || 2 > in_segment_length
+           || 0 != ( in_segment_length & ( in_segment_length - 1 ) )
+           || in_overlap_length >= in_segment_length
+           || in_signal_length < in_segment_length
+           || in_psd_length < in_segment_length / 2 + 1
+           )
+  {
+    CPC_ERROR (
+               "Sample rate (%d), segment (%d), overlap (%d), signal (%d) or"
+               " PSD (%d) lengths are invalid.",
+               in_sample_rate,
+               in_segment_length,
+               in_overlap_length,
+               in_signal_length,
+               in_psd_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    USIZE number_of_bins = in_segment_length / 2 + 1;
+    
+    csignal_thread_pool* pool = csignal_get_thread_pool();
+    
+    csignal_welch_job job;
+    
+    job.signal              = in_signal;
+    job.window              = NULL;
+    job.plan                = NULL;
+    job.segment_length      = in_segment_length;
+    job.step_length         = in_segment_length - in_overlap_length;
+    job.number_of_segments  =
+      ( in_signal_length - in_segment_length ) / job.step_length + 1;
+    job.buffers             = NULL;
+    job.scratch             = NULL;
+    job.scratch_length      = 0;
+    job.accumulators        = NULL;
+    
+    return_value = csignal_get_real_fft_plan( in_segment_length, &job.plan );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      //  A six-step transform already runs on the pool and must not be
+      //  called from one of its tasks
+      if( NULL != job.plan->complex_plan->row_plan )
+      {
+        pool = NULL;
+      }
+      
+      job.number_of_groups  =
+        CPC_MIN (
+                 USIZE,
+                 CSIGNAL_WELCH_NUMBER_OF_GROUPS,
+                 job.number_of_segments
+                 );
+      job.number_of_tasks   =
+        CPC_MIN (
+                 USIZE,
+                 csignal_thread_pool_get_number_of_threads( pool ),
+                 job.number_of_groups
+                 );
+      job.scratch_length    = csignal_get_real_fft_scratch_length( job.plan );
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &job.window,
+                         sizeof( FLOAT64 ) * in_segment_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &job.buffers,
+                         sizeof( FLOAT64 ) * ( in_segment_length + 2 )
+                         * job.number_of_tasks
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value && 0 < job.scratch_length )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &job.scratch,
+                         sizeof( FLOAT64 ) * job.scratch_length
+                         * job.number_of_tasks
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &job.accumulators,
+                         sizeof( FLOAT64 ) * number_of_bins
+                         * job.number_of_groups
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value =
+        csignal_calculate_window  (
+                                   in_window_type,
+                                   in_window_parameter,
+                                   CPC_TRUE,
+                                   in_segment_length,
+                                   job.window
+                                   );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      FLOAT64 window_power = 0.0;
+      FLOAT64 scale        = 0.0;
+      
+      csignal_thread_pool_run (
+                               pool,
+                               job.number_of_tasks,
+                               csignal_welch_task,
+                               &job
+                               );
+      
+      for( USIZE i = 0; i < in_segment_length; i++ )
+      {
+        window_power += job.window[ i ] * job.window[ i ];
+      }
+      
+      scale =
+        1.0
+        / (
+           ( in_sample_rate * 1.0 )
+           * window_power
+           * ( job.number_of_segments * 1.0 )
+           );
+      
+      for( USIZE k = 0; k < number_of_bins; k++ )
+      {
+        FLOAT64 sum = 0.0;
+        
+        for( USIZE g = 0; g < job.number_of_groups; g++ )
+        {
+          sum += job.accumulators[ g * number_of_bins + k ];
+        }
+        
+        //  The negative frequencies fold onto all bins but DC and Nyquist
+        out_psd[ k ] =
+          ( 0 == k || number_of_bins - 1 == k ? 1.0 : 2.0 ) * scale * sum;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not calculate PSD: 0x%x.", return_value );
+    }
+    
+    if( NULL != job.window )
+    {
+      cpc_safe_free( ( void** ) &job.window );
+    }
+    
+    if( NULL != job.buffers )
+    {
+      cpc_safe_free( ( void** ) &job.buffers );
+    }
+    
+    if( NULL != job.scratch )
+    {
+      cpc_safe_free( ( void** ) &job.scratch );
+    }
+    
+    if( NULL != job.accumulators )
+    {
+      cpc_safe_free( ( void** ) &job.accumulators );
+    }
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_welch_task  (
+                     void* in_job,
+                     USIZE in_index
+                     )
+{
+  csignal_welch_job* job = ( csignal_welch_job* ) in_job;
+  
+  USIZE number_of_bins  = job->segment_length / 2 + 1;
+  USIZE first_group     =
+    ( job->number_of_groups * in_index ) / job->number_of_tasks;
+  USIZE last_group      =
+    ( job->number_of_groups * ( in_index + 1 ) ) / job->number_of_tasks;
+  
+  FLOAT64* buffer   = job->buffers + in_index * ( job->segment_length + 2 );
+  FLOAT64* scratch  = NULL;
+  
+  if( NULL != job->scratch )
+  {
+    scratch = job->scratch + in_index * job->scratch_length;
+  }
+  
+  for( USIZE g = first_group; g < last_group; g++ )
+  {
+    USIZE first_segment =
+      ( job->number_of_segments * g ) / job->number_of_groups;
+    USIZE last_segment  =
+      ( job->number_of_segments * ( g + 1 ) ) / job->number_of_groups;
+    
+    FLOAT64* accumulator = job->accumulators + g * number_of_bins;
+    
+    for( USIZE k = 0; k < number_of_bins; k++ )
+    {
+      accumulator[ k ] = 0.0;
+    }
+    
+    for( USIZE m = first_segment; m < last_segment; m++ )
+    {
+      FLOAT64* segment = job->signal + m * job->step_length;
+      
+      for( USIZE i = 0; i < job->segment_length; i++ )
+      {
+        buffer[ i ] = segment[ i ] * job->window[ i ];
+      }
+      
+      csignal_execute_real_FFT_with_scratch (
+                                             job->plan,
+                                             scratch,
+                                             buffer,
+                                             buffer
+                                             );
+      
+      for( USIZE k = 0; k < number_of_bins; k++ )
+      {
+        accumulator[ k ] +=
+          buffer[ 2 * k ] * buffer[ 2 * k ]
+          + buffer[ 2 * k + 1 ] * buffer[ 2 * k + 1 ];
+      }
+    }
+  }
+}
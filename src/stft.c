@@ -0,0 +1,805 @@
+/*! \file   stft.c
+    \brief  The implementation of the streaming STFT and ISTFT.
+ 
+    \author Brent Carrara
+ */
+#include "stft.h"
+
+#include <math.h>
+
+/*! \def    CSIGNAL_ISTFT_MINIMUM_WINDOW_SUM
+    \brief  Output samples whose sum of squared windows is not larger than
+            this are set to zero instead of being normalized, e.g., the first
+            sample of a stream analyzed with a periodic Hann window.
+ */
+#define CSIGNAL_ISTFT_MINIMUM_WINDOW_SUM  1e-10
+
+/*! \fn     csignal_error_code csignal_stft_check_lengths (
+              USIZE in_window_length,
+              USIZE in_hop_length,
+              USIZE in_fft_length
+            )
+    \brief  Validates the lengths shared by the STFT and ISTFT.
+ 
+    \return Returns NO_ERROR if the lengths are valid or
+            CPC_ERROR_CODE_INVALID_PARAMETER otherwise.
+ */
+csignal_error_code
+csignal_stft_check_lengths  (
+                             USIZE in_window_length,
+                             USIZE in_hop_length,
+                             USIZE in_fft_length
+                             );
+
+/*! \fn     void csignal_stft_calculate_frame (
+              csignal_stft* io_stft
+            )
+    \brief  Windows the window_length buffered samples, transforms them into
+            the next free frame of the ring and shifts the buffered samples by
+            hop_length.
+ 
+    \param  io_stft The STFT. The buffer must be full and the ring must not be.
+ */
+void
+csignal_stft_calculate_frame  (
+                               csignal_stft* io_stft
+                               );
+
+csignal_error_code
+csignal_initialize_stft (
+                         USIZE                    in_window_length,
+                         USIZE                    in_hop_length,
+                         USIZE                    in_fft_length,
+                         csignal_window_type      in_window_type,
+                         FLOAT64                  in_window_parameter,
+                         csignal_stft_output_type in_output_type,
+                         USIZE                    in_number_of_frames,
+                         csignal_stft**           out_stft
+                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_stft )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "STFT is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           CSIGNAL_STFT_OUTPUT_COMPLEX != in_output_type
+           && CSIGNAL_STFT_OUTPUT_MAGNITUDE != in_output_type
+           )
+  {
+    CPC_ERROR( "Unknown STFT output type %d.", in_output_type );
+    
+    return_value = CSIGNAL_ERROR_CODE_INVALID_TYPE;
+  }
+  else if( 0 == in_number_of_frames )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Number of frames is zero." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    return_value =
+      csignal_stft_check_lengths  (
+                                   in_window_length,
+                                   in_hop_length,
+                                   in_fft_length
+                                   );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value )
+  {
+    *out_stft = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_stft, sizeof( csignal_stft ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_stft* stft = *out_stft;
+      
+      stft->window_length     = in_window_length;
+      stft->hop_length        = in_hop_length;
+      stft->fft_length        = in_fft_length;
+      stft->output_type       = in_output_type;
+      stft->frame_length      =
+        CSIGNAL_STFT_OUTPUT_COMPLEX == in_output_type
+        ? in_fft_length + 2
+        : in_fft_length / 2 + 1;
+      stft->window            = NULL;
+      stft->samples           = NULL;
+      stft->number_of_samples = 0;
+      stft->fft_buffer        = NULL;
+      stft->plan              = NULL;
+      stft->frames            = NULL;
+      stft->number_of_frames  = in_number_of_frames;
+      stft->read_index        = 0;
+      stft->frame_count       = 0;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( stft->window ),
+                         sizeof( FLOAT64 ) * in_window_length
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( stft->samples ),
+                           sizeof( FLOAT64 ) * in_window_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( stft->fft_buffer ),
+                           sizeof( FLOAT64 ) * ( in_fft_length + 2 )
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( stft->frames ),
+                           sizeof( FLOAT64 ) * stft->frame_length
+                           * in_number_of_frames
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          csignal_initialize_real_fft_plan( in_fft_length, &( stft->plan ) );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          csignal_calculate_window  (
+                                     in_window_type,
+                                     in_window_parameter,
+                                     CPC_TRUE,
+                                     in_window_length,
+                                     stft->window
+                                     );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not initialize STFT: 0x%x.", return_value );
+        
+        csignal_destroy_stft( *out_stft );
+        
+        *out_stft = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc STFT: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_stft  (
+                       csignal_stft* io_stft
+                       )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_stft )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "STFT is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_stft->window )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_stft->window ) );
+    }
+    
+    if( NULL != io_stft->samples )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_stft->samples ) );
+    }
+    
+    if( NULL != io_stft->fft_buffer )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_stft->fft_buffer ) );
+    }
+    
+    if( NULL != io_stft->frames )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_stft->frames ) );
+    }
+    
+    if( NULL != io_stft->plan )
+    {
+      return_value = csignal_destroy_real_fft_plan( io_stft->plan );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_stft );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_reset_stft  (
+                     csignal_stft* io_stft
+                     )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_stft )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "STFT is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    io_stft->number_of_samples  = 0;
+    io_stft->read_index         = 0;
+    io_stft->frame_count        = 0;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_stft_add_samples  (
+                           csignal_stft* io_stft,
+                           USIZE         in_number_of_samples,
+                           FLOAT64*      in_samples,
+                           USIZE*        out_number_of_samples_consumed
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       NULL == io_stft
+       || NULL == in_samples
+       || NULL == out_number_of_samples_consumed
+       )
+  {
+    CPC_ERROR (
+               "STFT (0x%x), samples (0x%x) or consumed (0x%x) are null.",
+               io_stft,
+               in_samples,
+               out_number_of_samples_consumed
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    USIZE consumed = 0;
+    
+    while( consumed < in_number_of_samples )
+    {
+      USIZE number_to_copy =
+        CPC_MIN (
+                 USIZE,
+                 io_stft->window_length - io_stft->number_of_samples,
+                 in_number_of_samples - consumed
+                 );
+      
+      //  The sample that completes a frame is only taken if the frame can be
+      //  stored, so the caller can resume from the returned count
+      if  (
+           number_to_copy
+           == io_stft->window_length - io_stft->number_of_samples
+           && io_stft->frame_count == io_stft->number_of_frames
+           )
+      {
+        number_to_copy--;
+      }
+      
+      CPC_MEMCPY  (
+                   io_stft->samples + io_stft->number_of_samples,
+                   in_samples + consumed,
+                   sizeof( FLOAT64 ) * number_to_copy
+                   );
+      
+      io_stft->number_of_samples  += number_to_copy;
+      consumed                    += number_to_copy;
+      
+      if( io_stft->number_of_samples == io_stft->window_length )
+      {
+        csignal_stft_calculate_frame( io_stft );
+      }
+      else if( consumed < in_number_of_samples )
+      {
+        break;
+      }
+    }
+    
+    *out_number_of_samples_consumed = consumed;
+  }
+  
+  return( return_value );
+}
+
+USIZE
+csignal_stft_get_number_of_frames (
+                                   csignal_stft* in_stft
+                                   )
+{
+  return( NULL == in_stft ? 0 : in_stft->frame_count );
+}
+
+USIZE
+csignal_stft_get_frame_length (
+                               csignal_stft* in_stft
+                               )
+{
+  return( NULL == in_stft ? 0 : in_stft->frame_length );
+}
+
+csignal_error_code
+csignal_stft_read_frame (
+                         csignal_stft* io_stft,
+                         USIZE         in_frame_length,
+                         FLOAT64*      out_frame
+                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_stft || NULL == out_frame )
+  {
+    CPC_ERROR( "STFT (0x%x) or frame (0x%x) are null.", io_stft, out_frame );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( in_frame_length < io_stft->frame_length )
+  {
+    CPC_ERROR (
+               "Frame length (%d) must be at least %d.",
+               in_frame_length,
+               io_stft->frame_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if( 0 == io_stft->frame_count )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_TRACE, "No STFT frames to read." );
+    
+    return_value = CSIGNAL_ERROR_CODE_NO_DATA;
+  }
+  else
+  {
+    CPC_MEMCPY  (
+                 out_frame,
+                 io_stft->frames + io_stft->read_index * io_stft->frame_length,
+                 sizeof( FLOAT64 ) * io_stft->frame_length
+                 );
+    
+    io_stft->read_index =
+      ( io_stft->read_index + 1 ) % io_stft->number_of_frames;
+    io_stft->frame_count--;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_istft  (
+                           USIZE               in_window_length,
+                           USIZE               in_hop_length,
+                           USIZE               in_fft_length,
+                           csignal_window_type in_window_type,
+                           FLOAT64             in_window_parameter,
+                           csignal_istft**     out_istft
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_istft )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "ISTFT is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    return_value =
+      csignal_stft_check_lengths  (
+                                   in_window_length,
+                                   in_hop_length,
+                                   in_fft_length
+                                   );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == return_value )
+  {
+    *out_istft = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_istft, sizeof( csignal_istft ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_istft* istft = *out_istft;
+      
+      istft->window_length  = in_window_length;
+      istft->hop_length     = in_hop_length;
+      istft->fft_length     = in_fft_length;
+      istft->window         = NULL;
+      istft->fft_buffer     = NULL;
+      istft->accumulator    = NULL;
+      istft->window_sum     = NULL;
+      istft->plan           = NULL;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( istft->window ),
+                         sizeof( FLOAT64 ) * in_window_length
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( istft->fft_buffer ),
+                           sizeof( FLOAT64 ) * ( in_fft_length + 2 )
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( istft->accumulator ),
+                           sizeof( FLOAT64 ) * in_window_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( istft->window_sum ),
+                           sizeof( FLOAT64 ) * in_window_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          csignal_initialize_real_fft_plan( in_fft_length, &( istft->plan ) );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          csignal_calculate_window  (
+                                     in_window_type,
+                                     in_window_parameter,
+                                     CPC_TRUE,
+                                     in_window_length,
+                                     istft->window
+                                     );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        for( USIZE i = 0; i < in_window_length; i++ )
+        {
+          istft->accumulator[ i ] = 0.0;
+          istft->window_sum[ i ]  = 0.0;
+        }
+      }
+      else
+      {
+        CPC_ERROR( "Could not initialize ISTFT: 0x%x.", return_value );
+        
+        csignal_destroy_istft( *out_istft );
+        
+        *out_istft = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc ISTFT: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_istft (
+                       csignal_istft* io_istft
+                       )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_istft )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "ISTFT is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_istft->window )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_istft->window ) );
+    }
+    
+    if( NULL != io_istft->fft_buffer )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_istft->fft_buffer ) );
+    }
+    
+    if( NULL != io_istft->accumulator )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_istft->accumulator ) );
+    }
+    
+    if( NULL != io_istft->window_sum )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_istft->window_sum ) );
+    }
+    
+    if( NULL != io_istft->plan )
+    {
+      return_value = csignal_destroy_real_fft_plan( io_istft->plan );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_istft );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_istft_add_frame (
+                         csignal_istft* io_istft,
+                         USIZE          in_frame_length,
+                         FLOAT64*       in_frame,
+                         USIZE          in_signal_length,
+                         FLOAT64*       out_signal
+                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_istft || NULL == in_frame || NULL == out_signal )
+  {
+    CPC_ERROR (
+               "ISTFT (0x%x), frame (0x%x) or signal (0x%x) are null.",
+               io_istft,
+               in_frame,
+               out_signal
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           in_frame_length != io_istft->fft_length + 2
+           || in_signal_length < io_istft->hop_length
+           )
+  {
+    CPC_ERROR (
+               "Frame length (%d) must be %d and signal length (%d) at least"
+               " %d.",
+               in_frame_length,
+               io_istft->fft_length + 2,
+               in_signal_length,
+               io_istft->hop_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    USIZE window_length = io_istft->window_length;
+    USIZE hop_length    = io_istft->hop_length;
+    FLOAT64 scale       = 1.0 / ( io_istft->fft_length * 1.0 );
+    
+    CPC_MEMCPY  (
+                 io_istft->fft_buffer,
+                 in_frame,
+                 sizeof( FLOAT64 ) * in_frame_length
+                 );
+    
+    return_value =
+      csignal_execute_real_IFFT (
+                                 io_istft->plan,
+                                 io_istft->fft_buffer,
+                                 io_istft->fft_buffer
+                                 );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      for( USIZE i = 0; i < window_length; i++ )
+      {
+        FLOAT64 window = io_istft->window[ i ];
+        
+        io_istft->accumulator[ i ] +=
+          window * scale * io_istft->fft_buffer[ i ];
+        io_istft->window_sum[ i ]  += window * window;
+      }
+      
+      //  No later frame overlaps the first hop_length samples
+      for( USIZE i = 0; i < hop_length; i++ )
+      {
+        out_signal[ i ] =
+          CSIGNAL_ISTFT_MINIMUM_WINDOW_SUM < io_istft->window_sum[ i ]
+          ? io_istft->accumulator[ i ] / io_istft->window_sum[ i ]
+          : 0.0;
+      }
+      
+      for( USIZE i = 0; i < window_length; i++ )
+      {
+        if( i + hop_length < window_length )
+        {
+          io_istft->accumulator[ i ] = io_istft->accumulator[ i + hop_length ];
+          io_istft->window_sum[ i ]  = io_istft->window_sum[ i + hop_length ];
+        }
+        else
+        {
+          io_istft->accumulator[ i ]  = 0.0;
+          io_istft->window_sum[ i ]   = 0.0;
+        }
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not calculate IFFT: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_istft_flush (
+                     csignal_istft* io_istft,
+                     USIZE          in_signal_length,
+                     FLOAT64*       out_signal
+                     )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_istft || NULL == out_signal )
+  {
+    CPC_ERROR (
+               "ISTFT (0x%x) or signal (0x%x) are null.",
+               io_istft,
+               out_signal
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( in_signal_length < io_istft->window_length - io_istft->hop_length )
+  {
+    CPC_ERROR (
+               "Signal length (%d) must be at least %d.",
+               in_signal_length,
+               io_istft->window_length - io_istft->hop_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    for( USIZE i = 0; i < io_istft->window_length; i++ )
+    {
+      if( i < io_istft->window_length - io_istft->hop_length )
+      {
+        out_signal[ i ] =
+          CSIGNAL_ISTFT_MINIMUM_WINDOW_SUM < io_istft->window_sum[ i ]
+          ? io_istft->accumulator[ i ] / io_istft->window_sum[ i ]
+          : 0.0;
+      }
+      
+      io_istft->accumulator[ i ]  = 0.0;
+      io_istft->window_sum[ i ]   = 0.0;
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_stft_check_lengths  (
+                             USIZE in_window_length,
+                             USIZE in_hop_length,
+                             USIZE in_fft_length
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       0 == in_window_length
+       || 0 == in_hop_length
+       || in_hop_length > in_window_length
+       || 2 > in_fft_length
+       || in_fft_length < in_window_length
+       || 0 != ( in_fft_length & ( in_fft_length - 1 ) )
+       )
+  {
+    CPC_ERROR (
+               "Window (%d), hop (%d) or FFT (%d) lengths are invalid.",
+               in_window_length,
+               in_hop_length,
+               in_fft_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_stft_calculate_frame  (
+                               csignal_stft* io_stft
+                               )
+{
+  USIZE window_length = io_stft->window_length;
+  USIZE hop_length    = io_stft->hop_length;
+  FLOAT64* buffer     = io_stft->fft_buffer;
+  
+  USIZE write_index =
+    ( io_stft->read_index + io_stft->frame_count ) % io_stft->number_of_frames;
+  
+  FLOAT64* frame = io_stft->frames + write_index * io_stft->frame_length;
+  
+  for( USIZE i = 0; i < window_length; i++ )
+  {
+    buffer[ i ] = io_stft->samples[ i ] * io_stft->window[ i ];
+  }
+  
+  for( USIZE i = window_length; i < io_stft->fft_length; i++ )
+  {
+    buffer[ i ] = 0.0;
+  }
+  
+  if( CSIGNAL_STFT_OUTPUT_COMPLEX == io_stft->output_type )
+  {
+    csignal_execute_real_FFT( io_stft->plan, buffer, frame );
+  }
+  else
+  {
+    csignal_execute_real_FFT( io_stft->plan, buffer, buffer );
+    
+    for( USIZE k = 0; k < io_stft->frame_length; k++ )
+    {
+      frame[ k ] =
+        sqrt  (
+               buffer[ 2 * k ] * buffer[ 2 * k ]
+               + buffer[ 2 * k + 1 ] * buffer[ 2 * k + 1 ]
+               );
+    }
+  }
+  
+  io_stft->frame_count++;
+  
+  for( USIZE i = 0; i + hop_length < window_length; i++ )
+  {
+    io_stft->samples[ i ] = io_stft->samples[ i + hop_length ];
+  }
+  
+  io_stft->number_of_samples = window_length - hop_length;
+}
@@ -0,0 +1,520 @@
+/*! \file   thread_pool.c
+    \brief  The implementation of the worker thread pool and the library
+            lock. POSIX threads are used on every platform except Windows,
+            where the Win32 thread, critical section, slim reader/writer lock
+            and condition variable APIs are used instead.
+ 
+    \author Brent Carrara
+ */
+#include "thread_pool.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+typedef HANDLE              csignal_thread;
+typedef CRITICAL_SECTION    csignal_mutex;
+typedef CONDITION_VARIABLE  csignal_condition;
+typedef SRWLOCK             csignal_static_mutex;
+
+#define CSIGNAL_MUTEX_LOCK( x )       EnterCriticalSection( x )
+#define CSIGNAL_MUTEX_UNLOCK( x )     LeaveCriticalSection( x )
+#define CSIGNAL_CONDITION_WAIT( c, m )  \
+  SleepConditionVariableCS( c, m, INFINITE )
+#define CSIGNAL_CONDITION_BROADCAST( c )  WakeAllConditionVariable( c )
+
+#define CSIGNAL_STATIC_MUTEX_INITIALIZER  SRWLOCK_INIT
+#define CSIGNAL_STATIC_MUTEX_LOCK( x )    AcquireSRWLockExclusive( x )
+#define CSIGNAL_STATIC_MUTEX_UNLOCK( x )  ReleaseSRWLockExclusive( x )
+#else
+#include <pthread.h>
+
+typedef pthread_t       csignal_thread;
+typedef pthread_mutex_t csignal_mutex;
+typedef pthread_cond_t  csignal_condition;
+typedef pthread_mutex_t csignal_static_mutex;
+
+#define CSIGNAL_MUTEX_LOCK( x )       pthread_mutex_lock( x )
+#define CSIGNAL_MUTEX_UNLOCK( x )     pthread_mutex_unlock( x )
+#define CSIGNAL_CONDITION_WAIT( c, m )  pthread_cond_wait( c, m )
+#define CSIGNAL_CONDITION_BROADCAST( c )  pthread_cond_broadcast( c )
+
+#define CSIGNAL_STATIC_MUTEX_INITIALIZER  PTHREAD_MUTEX_INITIALIZER
+#define CSIGNAL_STATIC_MUTEX_LOCK( x )    pthread_mutex_lock( x )
+#define CSIGNAL_STATIC_MUTEX_UNLOCK( x )  pthread_mutex_unlock( x )
+#endif
+
+/*! \var    csignal_thread_pool_t
+    \brief  The state shared by the threads of a pool. Everything below the
+            locks is protected by lock.
+ */
+struct csignal_thread_pool_t
+{
+  /*! \var    number_of_threads
+      \brief  The number of threads tasks are spread over, including the
+              thread that calls csignal_thread_pool_run.
+   */
+  USIZE                     number_of_threads;
+  
+  /*! \var    threads
+      \brief  The number_of_threads - 1 worker threads.
+   */
+  csignal_thread*           threads;
+  
+  /*! \var    submit_lock
+      \brief  Held by csignal_thread_pool_run for the duration of a parallel
+              loop so that concurrent callers are serialized.
+   */
+  csignal_mutex             submit_lock;
+  
+  /*! \var    lock
+      \brief  Protects the job state below.
+   */
+  csignal_mutex             lock;
+  
+  /*! \var    work_available
+      \brief  Signalled when a new job is posted or the pool is shut down.
+   */
+  csignal_condition         work_available;
+  
+  /*! \var    work_done
+      \brief  Signalled when the last task of a job completes.
+   */
+  csignal_condition         work_done;
+  
+  /*! \var    task
+      \brief  The work of the current job.
+   */
+  csignal_thread_pool_task  task;
+  
+  /*! \var    argument
+      \brief  The argument of the current job.
+   */
+  void*                     argument;
+  
+  /*! \var    number_of_tasks
+      \brief  The number of task indices in the current job.
+   */
+  USIZE                     number_of_tasks;
+  
+  /*! \var    next_task
+      \brief  The next task index to hand out.
+   */
+  USIZE                     next_task;
+  
+  /*! \var    completed_tasks
+      \brief  The number of task indices that have completed.
+   */
+  USIZE                     completed_tasks;
+  
+  /*! \var    generation
+      \brief  Incremented every time a job is posted so that a worker can tell
+              a new job from the one it has already worked on.
+   */
+  USIZE                     generation;
+  
+  /*! \var    shutdown
+      \brief  Set by csignal_destroy_thread_pool to stop the workers.
+   */
+  CPC_BOOL                  shutdown;
+};
+
+/*! \var    csignal_shared_thread_pool
+    \brief  The pool returned by csignal_get_thread_pool. Null unless
+            csignal_set_number_of_threads was called with a value larger than
+            one.
+ */
+static csignal_thread_pool* csignal_shared_thread_pool = NULL;
+
+/*! \var    csignal_library_lock
+    \brief  The lock taken by csignal_lock_library. Statically initialized so
+            that it can be used before csignal_initialize is called.
+ */
+static csignal_static_mutex csignal_library_lock =
+  CSIGNAL_STATIC_MUTEX_INITIALIZER;
+
+/*! \fn     void csignal_thread_pool_work (
+              csignal_thread_pool* io_pool
+            )
+    \brief  Executes task indices of the current job until none are left.
+            Must be called with io_pool->lock held, the lock is released while
+            a task executes and held again when the function returns.
+ 
+    \param  io_pool The pool whose current job is executed.
+ */
+void
+csignal_thread_pool_work  (
+                           csignal_thread_pool* io_pool
+                           );
+
+/*! \fn     void* csignal_thread_pool_worker (
+              void* in_pool
+            )
+    \brief  The entry point of a worker thread. Waits for jobs and executes
+            their tasks until the pool is shut down.
+ 
+    \param  in_pool The pool the worker belongs to.
+ */
+#ifdef _WIN32
+DWORD WINAPI
+csignal_thread_pool_worker  (
+                             LPVOID in_pool
+                             );
+#else
+void*
+csignal_thread_pool_worker  (
+                             void* in_pool
+                             );
+#endif
+
+csignal_error_code
+csignal_initialize_thread_pool  (
+                                 USIZE                 in_number_of_threads,
+                                 csignal_thread_pool** out_pool
+                                 )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_pool )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Pool is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_number_of_threads )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Number of threads is zero." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_pool = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_pool, sizeof( csignal_thread_pool ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      ( *out_pool )->threads = NULL;
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value && 1 < in_number_of_threads )
+    {
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( ( *out_pool )->threads ),
+                         sizeof( csignal_thread ) * ( in_number_of_threads - 1 )
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_thread_pool* pool = *out_pool;
+      
+      pool->number_of_threads = 1;
+      pool->task              = NULL;
+      pool->argument          = NULL;
+      pool->number_of_tasks   = 0;
+      pool->next_task         = 0;
+      pool->completed_tasks   = 0;
+      pool->generation        = 0;
+      pool->shutdown          = CPC_FALSE;
+      
+#ifdef _WIN32
+      InitializeCriticalSection( &( pool->submit_lock ) );
+      InitializeCriticalSection( &( pool->lock ) );
+      InitializeConditionVariable( &( pool->work_available ) );
+      InitializeConditionVariable( &( pool->work_done ) );
+#else
+      pthread_mutex_init( &( pool->submit_lock ), NULL );
+      pthread_mutex_init( &( pool->lock ), NULL );
+      pthread_cond_init( &( pool->work_available ), NULL );
+      pthread_cond_init( &( pool->work_done ), NULL );
+#endif
+      
+      //  number_of_threads only counts workers that were started, so that a
+      //  failure part of the way through leaves a pool that can be destroyed.
+      for( USIZE i = 0; i < in_number_of_threads - 1; i++ )
+      {
+#ifdef _WIN32
+        pool->threads[ i ] =
+          CreateThread( NULL, 0, csignal_thread_pool_worker, pool, 0, NULL );
+        
+        if( NULL == pool->threads[ i ] )
+#else
+        if  (
+             0 != pthread_create  (
+                                   &( pool->threads[ i ] ),
+                                   NULL,
+                                   csignal_thread_pool_worker,
+                                   pool
+                                   )
+             )
+#endif
+        {
+          CPC_ERROR( "Could not create worker thread %d.", i );
+          
+          return_value = CSIGNAL_ERROR_CODE_THREAD_ERROR;
+          
+          break;
+        }
+        
+        pool->number_of_threads++;
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        csignal_destroy_thread_pool( pool );
+        
+        *out_pool = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc pool: 0x%x.", return_value );
+      
+      if( NULL != *out_pool )
+      {
+        cpc_safe_free( ( void** ) out_pool );
+      }
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_thread_pool (
+                             csignal_thread_pool* io_pool
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_pool )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Pool is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    CSIGNAL_MUTEX_LOCK( &( io_pool->lock ) );
+    
+    io_pool->shutdown = CPC_TRUE;
+    
+    CSIGNAL_CONDITION_BROADCAST( &( io_pool->work_available ) );
+    CSIGNAL_MUTEX_UNLOCK( &( io_pool->lock ) );
+    
+    for( USIZE i = 0; i < io_pool->number_of_threads - 1; i++ )
+    {
+#ifdef _WIN32
+      WaitForSingleObject( io_pool->threads[ i ], INFINITE );
+      CloseHandle( io_pool->threads[ i ] );
+#else
+      pthread_join( io_pool->threads[ i ], NULL );
+#endif
+    }
+
+#ifdef _WIN32
+    DeleteCriticalSection( &( io_pool->submit_lock ) );
+    DeleteCriticalSection( &( io_pool->lock ) );
+#else
+    pthread_mutex_destroy( &( io_pool->submit_lock ) );
+    pthread_mutex_destroy( &( io_pool->lock ) );
+    pthread_cond_destroy( &( io_pool->work_available ) );
+    pthread_cond_destroy( &( io_pool->work_done ) );
+#endif
+    
+    if( NULL != io_pool->threads )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_pool->threads ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_pool );
+    }
+  }
+  
+  return( return_value );
+}
+
+USIZE
+csignal_thread_pool_get_number_of_threads (
+                                           csignal_thread_pool* in_pool
+                                           )
+{
+  return( NULL == in_pool ? 1 : in_pool->number_of_threads );
+}
+
+void
+csignal_thread_pool_run (
+                         csignal_thread_pool*     in_pool,
+                         USIZE                    in_number_of_tasks,
+                         csignal_thread_pool_task in_task,
+                         void*                    in_argument
+                         )
+{
+  if( NULL == in_task )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Task is null." );
+  }
+  else if  (
+            NULL == in_pool
+            || 1 == in_pool->number_of_threads
+            || 1 >= in_number_of_tasks
+            )
+  {
+    for( USIZE i = 0; i < in_number_of_tasks; i++ )
+    {
+      in_task( in_argument, i );
+    }
+  }
+  else
+  {
+    CSIGNAL_MUTEX_LOCK( &( in_pool->submit_lock ) );
+    CSIGNAL_MUTEX_LOCK( &( in_pool->lock ) );
+    
+    in_pool->task             = in_task;
+    in_pool->argument         = in_argument;
+    in_pool->number_of_tasks  = in_number_of_tasks;
+    in_pool->next_task        = 0;
+    in_pool->completed_tasks  = 0;
+    
+    in_pool->generation++;
+    
+    CSIGNAL_CONDITION_BROADCAST( &( in_pool->work_available ) );
+    
+    csignal_thread_pool_work( in_pool );
+    
+    while( in_pool->completed_tasks < in_pool->number_of_tasks )
+    {
+      CSIGNAL_CONDITION_WAIT( &( in_pool->work_done ), &( in_pool->lock ) );
+    }
+    
+    CSIGNAL_MUTEX_UNLOCK( &( in_pool->lock ) );
+    CSIGNAL_MUTEX_UNLOCK( &( in_pool->submit_lock ) );
+  }
+}
+
+void
+csignal_thread_pool_work  (
+                           csignal_thread_pool* io_pool
+                           )
+{
+  while( io_pool->next_task < io_pool->number_of_tasks )
+  {
+    USIZE index = io_pool->next_task++;
+    
+    CSIGNAL_MUTEX_UNLOCK( &( io_pool->lock ) );
+    
+    io_pool->task( io_pool->argument, index );
+    
+    CSIGNAL_MUTEX_LOCK( &( io_pool->lock ) );
+    
+    io_pool->completed_tasks++;
+    
+    if( io_pool->completed_tasks == io_pool->number_of_tasks )
+    {
+      CSIGNAL_CONDITION_BROADCAST( &( io_pool->work_done ) );
+    }
+  }
+}
+
+#ifdef _WIN32
+DWORD WINAPI
+csignal_thread_pool_worker  (
+                             LPVOID in_pool
+                             )
+#else
+void*
+csignal_thread_pool_worker  (
+                             void* in_pool
+                             )
+#endif
+{
+  csignal_thread_pool* pool = ( csignal_thread_pool* ) in_pool;
+  
+  CSIGNAL_MUTEX_LOCK( &( pool->lock ) );
+  
+  USIZE generation = pool->generation;
+  
+  while( !pool->shutdown )
+  {
+    if( generation == pool->generation )
+    {
+      CSIGNAL_CONDITION_WAIT( &( pool->work_available ), &( pool->lock ) );
+    }
+    else
+    {
+      generation = pool->generation;
+      
+      csignal_thread_pool_work( pool );
+    }
+  }
+  
+  CSIGNAL_MUTEX_UNLOCK( &( pool->lock ) );
+  
+  return( 0 );
+}
+
+csignal_error_code
+csignal_set_number_of_threads (
+                               USIZE in_number_of_threads
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if  (
+       csignal_thread_pool_get_number_of_threads( csignal_shared_thread_pool )
+       != CPC_MAX( USIZE, in_number_of_threads, 1 )
+       )
+  {
+    csignal_release_thread_pool();
+    
+    if( 1 < in_number_of_threads )
+    {
+      return_value =
+        csignal_initialize_thread_pool  (
+                                         in_number_of_threads,
+                                         &csignal_shared_thread_pool
+                                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        CPC_ERROR( "Could not create thread pool: 0x%x.", return_value );
+      }
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_thread_pool*
+csignal_get_thread_pool( void )
+{
+  return( csignal_shared_thread_pool );
+}
+
+void
+csignal_release_thread_pool( void )
+{
+  if( NULL != csignal_shared_thread_pool )
+  {
+    csignal_destroy_thread_pool( csignal_shared_thread_pool );
+    
+    csignal_shared_thread_pool = NULL;
+  }
+}
+
+void
+csignal_lock_library( void )
+{
+  CSIGNAL_STATIC_MUTEX_LOCK( &csignal_library_lock );
+}
+
+void
+csignal_unlock_library( void )
+{
+  CSIGNAL_STATIC_MUTEX_UNLOCK( &csignal_library_lock );
+}
@@ -0,0 +1,452 @@
+/*! \file   tone_bank.c
+    \brief  The implementation of the Goertzel algorithm and the tone bank.
+ 
+    \author Brent Carrara
+ */
+#include "tone_bank.h"
+
+#include <math.h>
+
+/*! \fn     void csignal_goertzel (
+              FLOAT64  in_phase_increment,
+              USIZE    in_signal_length,
+              FLOAT64* in_signal,
+              FLOAT64* out_real,
+              FLOAT64* out_imaginary
+            )
+    \brief  Calculates Y = sum_j x[ N - 1 - j ] * exp( i * w * j ) of the N
+            samples in in_signal with the Goertzel recursion
+ 
+              s[ n ] = x[ n ] + 2 * cos( w ) * s[ n - 1 ] - s[ n - 2 ]
+              Y      = s[ N - 1 ] - exp( -i * w ) * s[ N - 2 ]
+ 
+    \param  in_phase_increment  The frequency w in radians per sample.
+    \param  in_signal_length  The number of samples N.
+    \param  in_signal The samples, oldest first.
+    \param  out_real  The real component of Y.
+    \param  out_imaginary The imaginary component of Y.
+ */
+void
+csignal_goertzel  (
+                   FLOAT64  in_phase_increment,
+                   USIZE    in_signal_length,
+                   FLOAT64* in_signal,
+                   FLOAT64* out_real,
+                   FLOAT64* out_imaginary
+                   );
+
+/*! \fn     void csignal_tone_bank_synchronize (
+              csignal_tone_bank* io_tone_bank
+            )
+    \brief  Recalculates the state of every tone from the samples in the
+            history with the Goertzel algorithm. history_index must be zero,
+            i.e., the history must be ordered oldest first.
+ 
+    \param  io_tone_bank  The tone bank.
+ */
+void
+csignal_tone_bank_synchronize (
+                               csignal_tone_bank* io_tone_bank
+                               );
+
+csignal_error_code
+csignal_calculate_goertzel_power  (
+                                   FLOAT64   in_frequency,
+                                   UINT32    in_sample_rate,
+                                   USIZE     in_signal_length,
+                                   FLOAT64*  in_signal,
+                                   FLOAT64*  out_power
+                                   )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_signal || NULL == out_power )
+  {
+    CPC_ERROR (
+               "Signal (0x%x) or power (0x%x) are null.",
+               in_signal,
+               out_power
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_sample_rate || 0 == in_signal_length )
+  {
+    CPC_ERROR (
+               "Sample rate (%d) and signal length (%d) must be positive.",
+               in_sample_rate,
+               in_signal_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    FLOAT64 real      = 0.0;
+    FLOAT64 imaginary = 0.0;
+    
+    csignal_goertzel  (
+                       2.0 * M_PI * in_frequency / ( in_sample_rate * 1.0 ),
+                       in_signal_length,
+                       in_signal,
+                       &real,
+                       &imaginary
+                       );
+    
+    *out_power = real * real + imaginary * imaginary;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_initialize_tone_bank  (
+                               USIZE               in_number_of_tones,
+                               FLOAT64*            in_frequencies,
+                               UINT32              in_sample_rate,
+                               USIZE               in_window_length,
+                               csignal_tone_bank** out_tone_bank
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_frequencies || NULL == out_tone_bank )
+  {
+    CPC_ERROR (
+               "Frequencies (0x%x) or tone bank (0x%x) are null.",
+               in_frequencies,
+               out_tone_bank
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if (
+           0 == in_number_of_tones
+           || 0 == in_sample_rate
+           || 0 == in_window_length
+           )
+  {
+    CPC_ERROR (
+               "Number of tones (%d), sample rate (%d) and window length (%d)"
+               " must be positive.",
+               in_number_of_tones,
+               in_sample_rate,
+               in_window_length
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    *out_tone_bank = NULL;
+    
+    return_value =
+      cpc_safe_malloc( ( void** ) out_tone_bank, sizeof( csignal_tone_bank ) );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      csignal_tone_bank* tone_bank = *out_tone_bank;
+      
+      tone_bank->number_of_tones  = in_number_of_tones;
+      tone_bank->window_length    = in_window_length;
+      tone_bank->rotations        = NULL;
+      tone_bank->window_rotations = NULL;
+      tone_bank->states           = NULL;
+      tone_bank->history          = NULL;
+      tone_bank->history_index    = 0;
+      
+      return_value =
+        cpc_safe_malloc (
+                         ( void** ) &( tone_bank->rotations ),
+                         sizeof( FLOAT64 ) * 2 * in_number_of_tones
+                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( tone_bank->window_rotations ),
+                           sizeof( FLOAT64 ) * 2 * in_number_of_tones
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( tone_bank->states ),
+                           sizeof( FLOAT64 ) * 2 * in_number_of_tones
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        return_value =
+          cpc_safe_malloc (
+                           ( void** ) &( tone_bank->history ),
+                           sizeof( FLOAT64 ) * in_window_length
+                           );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == return_value )
+      {
+        for( USIZE i = 0; i < in_number_of_tones; i++ )
+        {
+          FLOAT64 phase =
+            2.0 * M_PI * in_frequencies[ i ] / ( in_sample_rate * 1.0 );
+          FLOAT64 window_phase = phase * ( in_window_length * 1.0 );
+          
+          tone_bank->rotations[ 2 * i ]             = cos( phase );
+          tone_bank->rotations[ 2 * i + 1 ]         = sin( phase );
+          tone_bank->window_rotations[ 2 * i ]      = cos( window_phase );
+          tone_bank->window_rotations[ 2 * i + 1 ]  = sin( window_phase );
+        }
+        
+        return_value = csignal_reset_tone_bank( tone_bank );
+      }
+      else
+      {
+        CPC_ERROR( "Could not initialize tone bank: 0x%x.", return_value );
+        
+        csignal_destroy_tone_bank( *out_tone_bank );
+        
+        *out_tone_bank = NULL;
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc tone bank: 0x%x.", return_value );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_destroy_tone_bank (
+                           csignal_tone_bank* io_tone_bank
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_tone_bank )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Tone bank is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    if( NULL != io_tone_bank->rotations )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_tone_bank->rotations ) );
+    }
+    
+    if( NULL != io_tone_bank->window_rotations )
+    {
+      return_value =
+        cpc_safe_free( ( void** ) &( io_tone_bank->window_rotations ) );
+    }
+    
+    if( NULL != io_tone_bank->states )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_tone_bank->states ) );
+    }
+    
+    if( NULL != io_tone_bank->history )
+    {
+      return_value = cpc_safe_free( ( void** ) &( io_tone_bank->history ) );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      return_value = cpc_safe_free( ( void** ) &io_tone_bank );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_reset_tone_bank (
+                         csignal_tone_bank* io_tone_bank
+                         )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_tone_bank )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Tone bank is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    for( USIZE i = 0; i < 2 * io_tone_bank->number_of_tones; i++ )
+    {
+      io_tone_bank->states[ i ] = 0.0;
+    }
+    
+    for( USIZE i = 0; i < io_tone_bank->window_length; i++ )
+    {
+      io_tone_bank->history[ i ] = 0.0;
+    }
+    
+    io_tone_bank->history_index = 0;
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_tone_bank_add_samples (
+                               csignal_tone_bank* io_tone_bank,
+                               USIZE              in_number_of_samples,
+                               FLOAT64*           in_samples
+                               )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == io_tone_bank || NULL == in_samples )
+  {
+    CPC_ERROR (
+               "Tone bank (0x%x) or samples (0x%x) are null.",
+               io_tone_bank,
+               in_samples
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    USIZE number_of_tones     = io_tone_bank->number_of_tones;
+    FLOAT64* rotations        = io_tone_bank->rotations;
+    FLOAT64* window_rotations = io_tone_bank->window_rotations;
+    FLOAT64* states           = io_tone_bank->states;
+    
+    for( USIZE n = 0; n < in_number_of_samples; n++ )
+    {
+      FLOAT64 sample  = in_samples[ n ];
+      FLOAT64 oldest  =
+        io_tone_bank->history[ io_tone_bank->history_index ];
+      
+      io_tone_bank->history[ io_tone_bank->history_index ] = sample;
+      
+      //  Y' = x[ n ] + exp( i * w ) * Y - exp( i * w * N ) * x[ n - N ]
+      for( USIZE t = 0; t < number_of_tones; t++ )
+      {
+        FLOAT64 real      = states[ 2 * t ];
+        FLOAT64 imaginary = states[ 2 * t + 1 ];
+        
+        states[ 2 * t ]     =
+          sample
+          + rotations[ 2 * t ] * real
+          - rotations[ 2 * t + 1 ] * imaginary
+          - window_rotations[ 2 * t ] * oldest;
+        states[ 2 * t + 1 ] =
+          rotations[ 2 * t ] * imaginary
+          + rotations[ 2 * t + 1 ] * real
+          - window_rotations[ 2 * t + 1 ] * oldest;
+      }
+      
+      io_tone_bank->history_index++;
+      
+      if( io_tone_bank->history_index == io_tone_bank->window_length )
+      {
+        io_tone_bank->history_index = 0;
+        
+        csignal_tone_bank_synchronize( io_tone_bank );
+      }
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+csignal_tone_bank_get_power (
+                             csignal_tone_bank* in_tone_bank,
+                             USIZE              in_number_of_tones,
+                             FLOAT64*           out_power
+                             )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_tone_bank || NULL == out_power )
+  {
+    CPC_ERROR (
+               "Tone bank (0x%x) or power (0x%x) are null.",
+               in_tone_bank,
+               out_power
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( in_number_of_tones < in_tone_bank->number_of_tones )
+  {
+    CPC_ERROR (
+               "Number of tones (%d) must be at least %d.",
+               in_number_of_tones,
+               in_tone_bank->number_of_tones
+               );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    for( USIZE t = 0; t < in_tone_bank->number_of_tones; t++ )
+    {
+      FLOAT64 real      = in_tone_bank->states[ 2 * t ];
+      FLOAT64 imaginary = in_tone_bank->states[ 2 * t + 1 ];
+      
+      out_power[ t ] = real * real + imaginary * imaginary;
+    }
+  }
+  
+  return( return_value );
+}
+
+void
+csignal_goertzel  (
+                   FLOAT64  in_phase_increment,
+                   USIZE    in_signal_length,
+                   FLOAT64* in_signal,
+                   FLOAT64* out_real,
+                   FLOAT64* out_imaginary
+                   )
+{
+  FLOAT64 coefficient = 2.0 * cos( in_phase_increment );
+  FLOAT64 previous    = 0.0;
+  FLOAT64 current     = 0.0;
+  
+  for( USIZE n = 0; n < in_signal_length; n++ )
+  {
+    FLOAT64 next = in_signal[ n ] + coefficient * current - previous;
+    
+    previous  = current;
+    current   = next;
+  }
+  
+  *out_real       = current - cos( in_phase_increment ) * previous;
+  *out_imaginary  = sin( in_phase_increment ) * previous;
+}
+
+void
+csignal_tone_bank_synchronize (
+                               csignal_tone_bank* io_tone_bank
+                               )
+{
+  for( USIZE t = 0; t < io_tone_bank->number_of_tones; t++ )
+  {
+    csignal_goertzel  (
+                       atan2  (
+                               io_tone_bank->rotations[ 2 * t + 1 ],
+                               io_tone_bank->rotations[ 2 * t ]
+                               ),
+                       io_tone_bank->window_length,
+                       io_tone_bank->history,
+                       &( io_tone_bank->states[ 2 * t ] ),
+                       &( io_tone_bank->states[ 2 * t + 1 ] )
+                       );
+  }
+}
@@ -0,0 +1,90 @@
+/*! \file   window.c
+    \brief  The implementation of the window functions.
+ 
+    \author Brent Carrara
+ */
+#include "window.h"
+
+#include <math.h>
+
+csignal_error_code
+csignal_calculate_window  (
+                           csignal_window_type in_type,
+                           FLOAT64             in_parameter,
+                           CPC_BOOL            in_periodic,
+                           USIZE               in_window_length,
+                           FLOAT64*            out_window
+                           )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == out_window )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Window is null." );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else if( 0 == in_window_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Window length is zero." );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else if (
+           CSIGNAL_WINDOW_RECTANGULAR > in_type
+           || CSIGNAL_WINDOW_KAISER < in_type
+           )
+  {
+    CPC_ERROR( "Unknown window type %d.", in_type );
+    
+    return_value = CSIGNAL_ERROR_CODE_INVALID_TYPE;
+  }
+  else if( CSIGNAL_WINDOW_KAISER == in_type && 0.0 > in_parameter )
+  {
+    CPC_ERROR( "Kaiser beta (%.4f) is negative.", in_parameter );
+    
+    return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  else
+  {
+    //  M is the denominator of the phase, the symmetric window is zero (or
+    //  minimum) at both n = 0 and n = M
+    FLOAT64 m =
+      ( in_periodic ? in_window_length : ( in_window_length - 1 ) ) * 1.0;
+    
+    for( USIZE n = 0; n < in_window_length; n++ )
+    {
+      FLOAT64 phase = ( 0.0 < m ? ( 2.0 * M_PI * n ) / m : 0.0 );
+      
+      switch( in_type )
+      {
+        case CSIGNAL_WINDOW_RECTANGULAR:
+          out_window[ n ] = 1.0;
+          break;
+        case CSIGNAL_WINDOW_HANN:
+          out_window[ n ] = 0.5 - 0.5 * cos( phase );
+          break;
+        case CSIGNAL_WINDOW_HAMMING:
+          out_window[ n ] = 0.54 - 0.46 * cos( phase );
+          break;
+        case CSIGNAL_WINDOW_BLACKMAN:
+          out_window[ n ] =
+            0.42 - 0.5 * cos( phase ) + 0.08 * cos( 2.0 * phase );
+          break;
+        case CSIGNAL_WINDOW_KAISER:
+        {
+          FLOAT64 ratio = ( 0.0 < m ? ( 2.0 * n ) / m - 1.0 : 0.0 );
+          
+          out_window[ n ] =
+            cpc_bessel_i0( in_parameter * sqrt( 1.0 - ratio * ratio ) )
+            / cpc_bessel_i0( in_parameter );
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+  
+  return( return_value );
+}
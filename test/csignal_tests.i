@@ -55,8 +55,18 @@
 %include <bit_packer.h>
 %include <bit_stream.h>
 %include <fft.h>
+%include <fft_kernels.h>
+%include <thread_pool.h>
 %include <conv.h>
 %include <detect.h>
+%include <window.h>
+%include <stft.h>
+%include <tone_bank.h>
+%include <psd.h>
+%include <block_convolver.h>
+%include <conv_kernels.h>
+%include <correlate.h>
+%include <polyphase.h>
 
 // These have to be included because we don't recursively parse headers
 %include <types.h>
@@ -55,6 +55,111 @@ python_convert_array_to_list  (
                                PyObject** out_list
                                );
 
+/*! \fn     csignal_error_code python_convert_complex_list_to_array  (
+              PyObject*  in_py_list,
+              USIZE*     out_array_length,
+              FLOAT64**  out_array
+            )
+    \brief  Converts a Python list of complex values to an array of FLOAT64
+            values with the real and imaginary components in adjacent indices.
+            The created array is of length out_array_length (twice the length
+            of the list).
+ 
+    \param  in_py_list  The Python list of complex values to convert.
+    \param  out_array_length  The length of the created array. 0 if an error
+                              occurrs.
+    \param  out_array A newly malloc'd array populated with the interleaved
+                      components of in_py_list. NULL if an error occurrs. Must
+                      be freed by the caller.
+    \return Returns NO_ERROR upon succesful execution or one of these errors
+            (see cpc_safe_malloc for other possible errors):
+ 
+            CPC_ERROR_CODE_NULL_POINTER If any of the parameters are null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If any element of in_py_list is not
+                                              a complex or float value.
+ */
+csignal_error_code
+python_convert_complex_list_to_array  (
+                                       PyObject*  in_py_list,
+                                       USIZE*     out_array_length,
+                                       FLOAT64**  out_array
+                                       );
+
+/*! \fn     csignal_error_code python_convert_complex_array_to_list  (
+              USIZE      in_array_length,
+              FLOAT64*   in_array,
+              PyObject** out_list
+            )
+    \brief  Converts a C array of interleaved real and imaginary components to
+            a Python list of complex values.
+ 
+    \param  in_array_length The number of elements in in_array (twice the
+                            number of complex values).
+    \param  in_array  The interleaved components.
+    \param  out_list  A newly created Python list (new reference).
+    \return Returns NO_ERROR upon succesful execution or one of these errors:
+ 
+            CPC_ERROR_CODE_NULL_POINTER If in_array or out_list is null.
+            CPC_ERROR_CODE_INVALID_PARAMETER  If any element of in_array failed
+                                              to convert to a Python complex.
+            CPC_ERROR_CODE_API_ERROR  If the Python list could not be created.
+ */
+csignal_error_code
+python_convert_complex_array_to_list  (
+                                       USIZE      in_array_length,
+                                       FLOAT64*   in_array,
+                                       PyObject** out_list
+                                       );
+
+/*! \fn     PyObject* python_convolve_region (
+              PyObject*                  in_signal_one,
+              PyObject*                  in_signal_two,
+              CPC_BOOL                   in_symmetric,
+              csignal_convolution_mode   in_mode,
+              csignal_convolution_method in_method,
+              USIZE                      in_decimation
+            )
+    \brief  Implements python_convolve_decimated and python_convolve_symmetric,
+            calling convolve_symmetric if in_symmetric is true and
+            convolve_decimated otherwise.
+ 
+    \return None on error. A new Python on list (new reference on success).
+ */
+PyObject*
+python_convolve_region  (
+                         PyObject*                  in_signal_one,
+                         PyObject*                  in_signal_two,
+                         CPC_BOOL                   in_symmetric,
+                         csignal_convolution_mode   in_mode,
+                         csignal_convolution_method in_method,
+                         USIZE                      in_decimation
+                         );
+
+/*! \var    python_concurrent_FFT_job
+    \brief  The work shared by the tasks of python_calculate_FFT_concurrently.
+            Every task transforms the same signal into an FFT of its own.
+ */
+typedef struct python_concurrent_FFT_job_t
+{
+  USIZE               signal_length;
+  FLOAT64*            signal;
+  FLOAT64**           ffts;
+  csignal_error_code* results;
+} python_concurrent_FFT_job;
+
+/*! \fn     void python_concurrent_FFT_task (
+              void* in_argument,
+              USIZE in_index
+            )
+    \brief  Calculates ffts[ in_index ] of the python_concurrent_FFT_job
+            in_argument with csignal_calculate_FFT.
+ */
+void
+python_concurrent_FFT_task  (
+                             void* in_argument,
+                             USIZE in_index
+                             );
+
 PyObject*
 python_calculate_IFFT(
                      PyObject* in_fft
@@ -198,7 +303,179 @@ python_calculate_FFT(
   {
     cpc_safe_free( ( void** )&fft );
   }
+  
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+void
+python_concurrent_FFT_task  (
+                             void* in_argument,
+                             USIZE in_index
+                             )
+{
+  python_concurrent_FFT_job* job = ( python_concurrent_FFT_job* ) in_argument;
+  
+  USIZE fft_length = 0;
+  
+  job->results[ in_index ] =
+    csignal_calculate_FFT (
+                           job->signal_length,
+                           job->signal,
+                           &fft_length,
+                           &( job->ffts[ in_index ] )
+                           );
+}
 
+PyObject*
+python_calculate_FFT_concurrently (
+                                   PyObject* in_signal,
+                                   USIZE     in_number_of_calls
+                                   )
+{
+  PyObject* return_value = NULL;
+  
+  FLOAT64* signal     = NULL;
+  FLOAT64* reference  = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
+  
+  csignal_thread_pool* pool = NULL;
+  
+  python_concurrent_FFT_job job;
+  
+  job.ffts    = NULL;
+  job.results = NULL;
+  
+  if( !PyList_Check( in_signal ) || PyList_Size( in_signal ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Signal must be a list with elements."
+      );
+  }
+  else if( 0 == in_number_of_calls )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Number of calls must be positive." );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        csignal_calculate_FFT (
+                               signal_length,
+                               signal,
+                               &fft_length,
+                               &reference
+                               );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        cpc_safe_malloc (
+                         ( void** ) &( job.ffts ),
+                         sizeof( FLOAT64* ) * in_number_of_calls
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        cpc_safe_malloc (
+                         ( void** ) &( job.results ),
+                         sizeof( csignal_error_code ) * in_number_of_calls
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result = csignal_initialize_thread_pool( in_number_of_calls, &pool );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      job.signal_length = signal_length;
+      job.signal        = signal;
+      
+      csignal_thread_pool_run (
+                               pool,
+                               in_number_of_calls,
+                               python_concurrent_FFT_task,
+                               &job
+                               );
+      
+      FLOAT64 difference = 0.0;
+      
+      for( USIZE i = 0; i < in_number_of_calls; i++ )
+      {
+        if( CPC_ERROR_CODE_NO_ERROR != job.results[ i ] )
+        {
+          result = job.results[ i ];
+        }
+        else
+        {
+          for( USIZE j = 0; j < fft_length; j++ )
+          {
+            if( fabs( job.ffts[ i ][ j ] - reference[ j ] ) > difference )
+            {
+              difference = fabs( job.ffts[ i ][ j ] - reference[ j ] );
+            }
+          }
+        }
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        return_value = PyFloat_FromDouble( difference );
+      }
+    }
+  }
+  
+  if( NULL != pool )
+  {
+    csignal_destroy_thread_pool( pool );
+  }
+  
+  if( NULL != job.ffts )
+  {
+    for( USIZE i = 0; i < in_number_of_calls; i++ )
+    {
+      if( NULL != job.ffts[ i ] )
+      {
+        cpc_safe_free( ( void** ) &( job.ffts[ i ] ) );
+      }
+    }
+    
+    cpc_safe_free( ( void** ) &( job.ffts ) );
+  }
+  
+  if( NULL != job.results )
+  {
+    cpc_safe_free( ( void** ) &( job.results ) );
+  }
+  
+  if( NULL != reference )
+  {
+    cpc_safe_free( ( void** ) &reference );
+  }
+  
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** ) &signal );
+  }
+  
   if( NULL != return_value )
   {
     return( return_value );
@@ -210,69 +487,1407 @@ python_calculate_FFT(
 }
 
 PyObject*
-python_filter_signal(
-                     fir_passband_filter*   in_filter,
-                     PyObject*              in_signal
-                     )
+python_calculate_FFT_float32(
+                             PyObject* in_signal
+                             )
 {
-  PyObject* return_value  = NULL;
+  PyObject* return_value = NULL;
 
-  FLOAT64* signal           = NULL;
-  FLOAT64* filtered_signal  = NULL;
+  FLOAT64* signal         = NULL;
+  FLOAT32* signal_float32 = NULL;
+  FLOAT32* fft            = NULL;
   
-  USIZE signal_length           = 0;
-  USIZE filtered_signal_length  = 0;
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
 
-  if( NULL == in_filter )
+  if( !PyList_Check( in_signal ) || PyList_Size( in_signal ) == 0 )
   {
-    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Filter is null." );
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Signal must be a list with elements."
+      );
   }
-  else if( !PyList_Check( in_signal ) || PyList_Size( in_signal ) == 0 )
+  else
+  {
+    csignal_error_code result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        cpc_safe_malloc (
+                         ( void** ) &signal_float32,
+                         sizeof( FLOAT32 ) * signal_length
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      for( USIZE i = 0; i < signal_length; i++ )
+      {
+        signal_float32[ i ] = ( FLOAT32 ) signal[ i ];
+      }
+      
+      result =
+        csignal_calculate_FFT_float32 (
+                                       signal_length,
+                                       signal_float32,
+                                       &fft_length,
+                                       &fft
+                                       );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        PyObject* fft_list = PyList_New( fft_length / 2 );
+        
+        for( USIZE i = 0; i < fft_length; i += 2 )
+        {
+          PyObject* complex =
+            PyComplex_FromDoubles( fft[i], fft[i + 1] );
+          
+          if( 0 != PyList_SetItem( fft_list, ( i / 2 ), complex ) )
+          {
+            PyErr_Print( );
+          }
+        }
+        
+        if( PyList_Check( fft_list ) )
+        {
+          return_value = fft_list;
+        }
+        else
+        {
+          CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "List not created." );
+        }
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != signal_float32 )
+  {
+    cpc_safe_free( ( void** )&signal_float32 );
+  }
+
+  if( NULL != fft )
+  {
+    cpc_safe_free( ( void** )&fft );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_real_FFT(
+                          PyObject* in_signal
+                          )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal   = NULL;
+  FLOAT64* fft      = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
+
+  if( !PyList_Check( in_signal ) || PyList_Size( in_signal ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Signal must be a list with elements."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        csignal_calculate_real_FFT( signal_length, signal, &fft_length, &fft );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        result =
+          python_convert_complex_array_to_list  (
+                                                 fft_length,
+                                                 fft,
+                                                 &return_value
+                                                 );
+        
+        if( CPC_ERROR_CODE_NO_ERROR != result )
+        {
+          return_value = NULL;
+        }
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != fft )
+  {
+    cpc_safe_free( ( void** )&fft );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_exact_FFT(
+                           PyObject* in_signal
+                           )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal   = NULL;
+  FLOAT64* fft      = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
+
+  if( !PyList_Check( in_signal ) || PyList_Size( in_signal ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Signal must be a list with elements."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        csignal_calculate_exact_FFT( signal_length, signal, &fft_length, &fft );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        result =
+          python_convert_complex_array_to_list  (
+                                                 fft_length,
+                                                 fft,
+                                                 &return_value
+                                                 );
+        
+        if( CPC_ERROR_CODE_NO_ERROR != result )
+        {
+          return_value = NULL;
+        }
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != fft )
+  {
+    cpc_safe_free( ( void** )&fft );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_zoom_FFT (
+                           PyObject* in_signal,
+                           UINT32    in_sample_rate,
+                           FLOAT64   in_start_frequency,
+                           FLOAT64   in_end_frequency,
+                           USIZE     in_number_of_bins
+                           )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal   = NULL;
+  FLOAT64* fft      = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
+
+  if( !PyList_Check( in_signal ) || PyList_Size( in_signal ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Signal must be a list with elements."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        csignal_calculate_zoom_FFT  (
+                                     signal_length,
+                                     signal,
+                                     in_sample_rate,
+                                     in_start_frequency,
+                                     in_end_frequency,
+                                     in_number_of_bins,
+                                     &fft_length,
+                                     &fft
+                                     );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        result =
+          python_convert_complex_array_to_list  (
+                                                 fft_length,
+                                                 fft,
+                                                 &return_value
+                                                 );
+        
+        if( CPC_ERROR_CODE_NO_ERROR != result )
+        {
+          return_value = NULL;
+        }
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != fft )
+  {
+    cpc_safe_free( ( void** )&fft );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_real_IFFT(
+                           PyObject* in_fft
+                           )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal   = NULL;
+  FLOAT64* fft      = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
+
+  if( !PyList_Check( in_fft ) || PyList_Size( in_fft ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "FFT must be a list with elements."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_complex_list_to_array( in_fft, &fft_length, &fft );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        csignal_calculate_real_IFFT( fft_length, fft, &signal_length, &signal );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        result =
+          python_convert_array_to_list  (
+                                         signal_length,
+                                         signal,
+                                         &return_value
+                                         );
+        
+        if( CPC_ERROR_CODE_NO_ERROR != result )
+        {
+          return_value = NULL;
+        }
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != fft )
+  {
+    cpc_safe_free( ( void** )&fft );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_complex_IFFT(
+                              PyObject* in_fft
+                              )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal   = NULL;
+  FLOAT64* fft      = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
+
+  if( !PyList_Check( in_fft ) || PyList_Size( in_fft ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "FFT must be a list with elements."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_complex_list_to_array( in_fft, &fft_length, &fft );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        csignal_calculate_complex_IFFT  (
+                                         fft_length,
+                                         fft,
+                                         &signal_length,
+                                         &signal
+                                         );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        result =
+          python_convert_complex_array_to_list  (
+                                                 signal_length,
+                                                 signal,
+                                                 &return_value
+                                                 );
+        
+        if( CPC_ERROR_CODE_NO_ERROR != result )
+        {
+          return_value = NULL;
+        }
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != fft )
+  {
+    cpc_safe_free( ( void** )&fft );
+  }
+  
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_execute_FFT_out_of_place (
+                                 PyObject* in_data,
+                                 CPC_BOOL  in_exact,
+                                 CPC_BOOL  in_inverse,
+                                 USIZE     in_offset
+                                 )
+{
+  PyObject* return_value  = NULL;
+  PyObject* output        = NULL;
+  
+  FLOAT64* data   = NULL;
+  FLOAT64* buffer = NULL;
+  
+  USIZE data_length = 0;
+  
+  csignal_fft_plan*       plan        = NULL;
+  csignal_exact_fft_plan* exact_plan  = NULL;
+  
+  if( !PyList_Check( in_data ) || PyList_Size( in_data ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Data must be a list with elements."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_complex_list_to_array( in_data, &data_length, &data );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        cpc_safe_malloc (
+                         ( void** ) &buffer,
+                         sizeof( FLOAT64 ) * ( data_length + in_offset )
+                         );
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      for( USIZE i = 0; i < data_length; i++ )
+      {
+        buffer[ i ] = data[ i ];
+      }
+      
+      if( in_exact )
+      {
+        result =
+          csignal_initialize_exact_fft_plan( data_length / 2, &exact_plan );
+      }
+      else
+      {
+        result = csignal_initialize_fft_plan( data_length / 2, &plan );
+      }
+    }
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      if( in_exact && in_inverse )
+      {
+        result =
+          csignal_execute_exact_IFFT_out_of_place (
+                                                   exact_plan,
+                                                   buffer,
+                                                   buffer + in_offset
+                                                   );
+      }
+      else if( in_exact )
+      {
+        result =
+          csignal_execute_exact_FFT_out_of_place  (
+                                                   exact_plan,
+                                                   buffer,
+                                                   buffer + in_offset
+                                                   );
+      }
+      else if( in_inverse )
+      {
+        result =
+          csignal_execute_IFFT_out_of_place (
+                                             plan,
+                                             buffer,
+                                             buffer + in_offset
+                                             );
+      }
+      else
+      {
+        result =
+          csignal_execute_FFT_out_of_place  (
+                                             plan,
+                                             buffer,
+                                             buffer + in_offset
+                                             );
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != result )
+      {
+        Py_INCREF( Py_None );
+        
+        output = Py_None;
+      }
+      else if  (
+                CPC_ERROR_CODE_NO_ERROR
+                != python_convert_complex_array_to_list (
+                                                         data_length,
+                                                         buffer + in_offset,
+                                                         &output
+                                                         )
+                )
+      {
+        output = NULL;
+      }
+      
+      if( NULL != output )
+      {
+        return_value =
+          Py_BuildValue( "(iN)", ( int ) result, output );
+      }
+    }
+  }
+  
+  if( NULL != plan )
+  {
+    csignal_destroy_fft_plan( plan );
+  }
+  
+  if( NULL != exact_plan )
+  {
+    csignal_destroy_exact_fft_plan( exact_plan );
+  }
+  
+  if( NULL != buffer )
+  {
+    cpc_safe_free( ( void** ) &buffer );
+  }
+  
+  if( NULL != data )
+  {
+    cpc_safe_free( ( void** ) &data );
+  }
+  
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_batch_FFT(
+                           USIZE     in_frame_length,
+                           PyObject* in_signal
+                           )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal   = NULL;
+  FLOAT64* fft      = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE fft_length    = 0;
+
+  if  (
+       !PyList_Check( in_signal )
+       || PyList_Size( in_signal ) == 0
+       || 0 == in_frame_length
+       || 0 != ( PyList_Size( in_signal ) % in_frame_length )
+       )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Signal must be a list of one or more frames."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+    
+    USIZE number_of_frames = signal_length / in_frame_length;
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+        csignal_calculate_batch_FFT (
+                                     number_of_frames,
+                                     in_frame_length,
+                                     signal,
+                                     &fft_length,
+                                     &fft
+                                     );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        USIZE frame_size = fft_length / number_of_frames;
+        
+        return_value = PyList_New( number_of_frames );
+        
+        for (
+             USIZE i = 0;
+             i < number_of_frames && NULL != return_value;
+             i++
+             )
+        {
+          PyObject* frame = NULL;
+          
+          result =
+            python_convert_complex_array_to_list  (
+                                                   frame_size,
+                                                   fft + i * frame_size,
+                                                   &frame
+                                                   );
+          
+          if  (
+               CPC_ERROR_CODE_NO_ERROR != result
+               || 0 != PyList_SetItem( return_value, i, frame )
+               )
+          {
+            Py_DECREF( return_value );
+            
+            return_value = NULL;
+          }
+        }
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != fft )
+  {
+    cpc_safe_free( ( void** )&fft );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_STFT(
+                      USIZE     in_window_length,
+                      USIZE     in_hop_length,
+                      USIZE     in_fft_length,
+                      USIZE     in_window_type,
+                      CPC_BOOL  in_magnitude,
+                      PyObject* in_signal
+                      )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal = NULL;
+  FLOAT64* frame  = NULL;
+  
+  csignal_stft* stft = NULL;
+  
+  USIZE signal_length = 0;
+
+  csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_stft (
+                               in_window_length,
+                               in_hop_length,
+                               in_fft_length,
+                               ( csignal_window_type ) in_window_type,
+                               0.0,
+                               in_magnitude
+                               ? CSIGNAL_STFT_OUTPUT_MAGNITUDE
+                               : CSIGNAL_STFT_OUTPUT_COMPLEX,
+                               1,
+                               &stft
+                               );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      cpc_safe_malloc (
+                       ( void** ) &frame,
+                       sizeof( FLOAT64 ) * csignal_stft_get_frame_length( stft )
+                       );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    USIZE offset = 0;
+    
+    return_value = PyList_New( 0 );
+    
+    while( offset < signal_length && NULL != return_value )
+    {
+      USIZE consumed = 0;
+      
+      result =
+        csignal_stft_add_samples  (
+                                   stft,
+                                   signal_length - offset,
+                                   signal + offset,
+                                   &consumed
+                                   );
+      
+      offset += consumed;
+      
+      while (
+             CPC_ERROR_CODE_NO_ERROR == result
+             && 0 < csignal_stft_get_number_of_frames( stft )
+             && NULL != return_value
+             )
+      {
+        PyObject* list = NULL;
+        
+        USIZE frame_length = csignal_stft_get_frame_length( stft );
+        
+        result = csignal_stft_read_frame( stft, frame_length, frame );
+        
+        if( CPC_ERROR_CODE_NO_ERROR == result )
+        {
+          result =
+            python_convert_array_to_list  (
+                                           frame_length,
+                                           frame,
+                                           &list
+                                           );
+        }
+        
+        if( CPC_ERROR_CODE_NO_ERROR == result )
+        {
+          if( 0 != PyList_Append( return_value, list ) )
+          {
+            result = CPC_ERROR_CODE_API_ERROR;
+          }
+          
+          Py_DECREF( list );
+        }
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != result && NULL != return_value )
+      {
+        Py_DECREF( return_value );
+        
+        return_value = NULL;
+      }
+    }
+  }
+
+  if( NULL != stft )
+  {
+    csignal_destroy_stft( stft );
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != frame )
+  {
+    cpc_safe_free( ( void** )&frame );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_ISTFT(
+                       USIZE     in_window_length,
+                       USIZE     in_hop_length,
+                       USIZE     in_fft_length,
+                       USIZE     in_window_type,
+                       PyObject* in_frames
+                       )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* frames = NULL;
+  FLOAT64* signal = NULL;
+  
+  csignal_istft* istft = NULL;
+  
+  USIZE frames_length     = 0;
+  USIZE number_of_frames  = 0;
+  USIZE signal_length     = 0;
+
+  csignal_error_code result =
+    python_convert_list_to_array( in_frames, &frames_length, &frames );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_istft  (
+                                 in_window_length,
+                                 in_hop_length,
+                                 in_fft_length,
+                                 ( csignal_window_type ) in_window_type,
+                                 0.0,
+                                 &istft
+                                 );
+  }
+  
+  if  (
+       CPC_ERROR_CODE_NO_ERROR == result
+       && 0 != ( frames_length % ( in_fft_length + 2 ) )
+       )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Frames must be complete." );
+    
+    result = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    number_of_frames  = frames_length / ( in_fft_length + 2 );
+    signal_length     =
+      number_of_frames * in_hop_length + in_window_length - in_hop_length;
+    
+    result =
+      cpc_safe_malloc( ( void** ) &signal, sizeof( FLOAT64 ) * signal_length );
+  }
+  
+  for (
+       USIZE i = 0;
+       i < number_of_frames && CPC_ERROR_CODE_NO_ERROR == result;
+       i++
+       )
+  {
+    result =
+      csignal_istft_add_frame (
+                               istft,
+                               in_fft_length + 2,
+                               frames + i * ( in_fft_length + 2 ),
+                               in_hop_length,
+                               signal + i * in_hop_length
+                               );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_istft_flush (
+                           istft,
+                           in_window_length - in_hop_length,
+                           signal + number_of_frames * in_hop_length
+                           );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_array_to_list( signal_length, signal, &return_value );
+  }
+
+  if( NULL != istft )
+  {
+    csignal_destroy_istft( istft );
+  }
+
+  if( NULL != frames )
+  {
+    cpc_safe_free( ( void** )&frames );
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_calculate_welch_PSD  (
+                             PyObject*  in_signal,
+                             UINT32     in_sample_rate,
+                             USIZE      in_segment_length,
+                             USIZE      in_overlap_length,
+                             USIZE      in_window_type,
+                             FLOAT64    in_window_parameter
+                             )
+{
+  PyObject* return_value = NULL;
+  
+  FLOAT64* signal = NULL;
+  FLOAT64* psd    = NULL;
+  
+  USIZE signal_length = 0;
+  USIZE psd_length    = in_segment_length / 2 + 1;
+  
+  csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      cpc_safe_malloc( ( void** ) &psd, sizeof( FLOAT64 ) * psd_length );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_calculate_welch_PSD (
+                                   signal_length,
+                                   signal,
+                                   in_sample_rate,
+                                   in_segment_length,
+                                   in_overlap_length,
+                                   ( csignal_window_type ) in_window_type,
+                                   in_window_parameter,
+                                   psd_length,
+                                   psd
+                                   );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result = python_convert_array_to_list( psd_length, psd, &return_value );
+  }
+  
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** ) &signal );
+  }
+  
+  if( NULL != psd )
+  {
+    cpc_safe_free( ( void** ) &psd );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_filter_signal(
+                     fir_passband_filter*   in_filter,
+                     PyObject*              in_signal
+                     )
+{
+  return  (
+           python_filter_with_mode  (
+                                     in_filter,
+                                     CSIGNAL_CONVOLUTION_MODE_FULL,
+                                     in_signal
+                                     )
+           );
+}
+
+PyObject*
+python_filter_with_mode (
+                         fir_passband_filter*     in_filter,
+                         csignal_convolution_mode in_mode,
+                         PyObject*                in_signal
+                         )
+{
+  return  (
+           python_filter_decimated  (
+                                     in_filter,
+                                     in_mode,
+                                     1,
+                                     in_signal
+                                     )
+           );
+}
+
+PyObject*
+python_filter_decimated (
+                         fir_passband_filter*     in_filter,
+                         csignal_convolution_mode in_mode,
+                         USIZE                    in_decimation,
+                         PyObject*                in_signal
+                         )
+{
+  PyObject* return_value  = NULL;
+
+  FLOAT64* signal           = NULL;
+  FLOAT64* filtered_signal  = NULL;
+  
+  USIZE signal_length           = 0;
+  USIZE filtered_signal_length  = 0;
+
+  if( NULL == in_filter )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Filter is null." );
+  }
+  else if( !PyList_Check( in_signal ) || PyList_Size( in_signal ) == 0 )
+  {
+    CPC_LOG_STRING(
+      CPC_LOG_LEVEL_ERROR,
+      "Signal must be a list with elements."
+      );
+  }
+  else
+  {
+    csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      result =
+      csignal_filter_decimated  (
+                                 in_filter,
+                                 in_mode,
+                                 in_decimation,
+                                 signal_length,
+                                 signal,
+                                 &filtered_signal_length,
+                                 &filtered_signal
+                                 );
+      
+      if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        result =
+          python_convert_array_to_list  (
+                                         filtered_signal_length,
+                                         filtered_signal,
+                                         &return_value
+                                         );
+      }
+    }
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( NULL != filtered_signal )
+  {
+    cpc_safe_free( ( void** )&filtered_signal );
+  }
+
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_filter_stream  (
+                       fir_passband_filter* in_filter,
+                       PyObject*            in_signal,
+                       USIZE                in_block_length
+                       )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* signal = NULL;
+  
+  fir_filter_state* state = NULL;
+  
+  USIZE signal_length = 0;
+
+  csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && 0 == in_block_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Block length is zero." );
+    
+    result = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result = csignal_initialize_fir_filter_state( in_filter, &state );
+  }
+  
+  //  The signal is filtered in place, block by block
+  for (
+       USIZE i = 0;
+       i < signal_length && CPC_ERROR_CODE_NO_ERROR == result;
+       i += in_block_length
+       )
+  {
+    result =
+      csignal_fir_filter_state_process  (
+                                         state,
+                                         CPC_MIN  (
+                                                   USIZE,
+                                                   in_block_length,
+                                                   signal_length - i
+                                                   ),
+                                         signal + i,
+                                         signal + i
+                                         );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_array_to_list( signal_length, signal, &return_value );
+  }
+
+  if( NULL != state )
+  {
+    csignal_destroy_fir_filter_state( state );
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_decimate_stream  (
+                         fir_passband_filter* in_filter,
+                         USIZE                in_decimation,
+                         PyObject*            in_signal,
+                         USIZE                in_block_length
+                         )
+{
+  PyObject* return_value = NULL;
+  
+  FLOAT64* signal    = NULL;
+  FLOAT64* decimated = NULL;
+  
+  fir_decimator* decimator = NULL;
+  
+  USIZE signal_length     = 0;
+  USIZE decimated_length  = 0;
+  
+  csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && 0 == in_block_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Block length is zero." );
+    
+    result = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_fir_decimator( in_filter, in_decimation, &decimator );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      cpc_safe_malloc (
+                       ( void** ) &decimated,
+                       sizeof( FLOAT64 )
+                       * ( signal_length + in_decimation - 1 ) / in_decimation
+                       );
+  }
+  
+  for (
+       USIZE i = 0;
+       i < signal_length && CPC_ERROR_CODE_NO_ERROR == result;
+       i += in_block_length
+       )
+  {
+    USIZE number_of_outputs = 0;
+    
+    result =
+      csignal_fir_decimator_process (
+                                     decimator,
+                                     CPC_MIN  (
+                                               USIZE,
+                                               in_block_length,
+                                               signal_length - i
+                                               ),
+                                     signal + i,
+                                     &number_of_outputs,
+                                     decimated + decimated_length
+                                     );
+    
+    decimated_length += number_of_outputs;
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_array_to_list  (
+                                     decimated_length,
+                                     decimated,
+                                     &return_value
+                                     );
+  }
+  
+  if( NULL != decimator )
+  {
+    csignal_destroy_fir_decimator( decimator );
+  }
+  
+  if( NULL != decimated )
+  {
+    cpc_safe_free( ( void** )&decimated );
+  }
+  
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_interpolate_stream (
+                           fir_passband_filter* in_filter,
+                           USIZE                in_interpolation,
+                           PyObject*            in_signal,
+                           USIZE                in_block_length
+                           )
+{
+  PyObject* return_value = NULL;
+  
+  FLOAT64* signal       = NULL;
+  FLOAT64* interpolated = NULL;
+  
+  fir_interpolator* interpolator = NULL;
+  
+  USIZE signal_length = 0;
+  
+  csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && 0 == in_block_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Block length is zero." );
+    
+    result = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_fir_interpolator (
+                                           in_filter,
+                                           in_interpolation,
+                                           &interpolator
+                                           );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      cpc_safe_malloc (
+                       ( void** ) &interpolated,
+                       sizeof( FLOAT64 ) * signal_length * in_interpolation
+                       );
+  }
+  
+  for (
+       USIZE i = 0;
+       i < signal_length && CPC_ERROR_CODE_NO_ERROR == result;
+       i += in_block_length
+       )
+  {
+    result =
+      csignal_fir_interpolator_process  (
+                                         interpolator,
+                                         CPC_MIN  (
+                                                   USIZE,
+                                                   in_block_length,
+                                                   signal_length - i
+                                                   ),
+                                         signal + i,
+                                         interpolated + i * in_interpolation
+                                         );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_array_to_list  (
+                                     signal_length * in_interpolation,
+                                     interpolated,
+                                     &return_value
+                                     );
+  }
+  
+  if( NULL != interpolator )
   {
-    CPC_LOG_STRING(
-      CPC_LOG_LEVEL_ERROR,
-      "Signal must be a list with elements."
-      );
+    csignal_destroy_fir_interpolator( interpolator );
   }
-  else
+  
+  if( NULL != interpolated )
   {
-    csignal_error_code result =
-    python_convert_list_to_array( in_signal, &signal_length, &signal );
-    
-    if( CPC_ERROR_CODE_NO_ERROR == result )
-    {
-      result =
-      csignal_filter_signal(
-                            in_filter,
-                            signal_length,
-                            signal,
-                            &filtered_signal_length,
-                            &filtered_signal
-                            );
-      
-      if( CPC_ERROR_CODE_NO_ERROR == result )
-      {
-        result =
-          python_convert_array_to_list  (
-                                         filtered_signal_length,
-                                         filtered_signal,
-                                         &return_value
-                                         );
-      }
-    }
+    cpc_safe_free( ( void** )&interpolated );
   }
-
+  
   if( NULL != signal )
   {
     cpc_safe_free( ( void** )&signal );
   }
-
-  if( NULL != filtered_signal )
-  {
-    cpc_safe_free( ( void** )&filtered_signal );
-  }
-
-  if( NULL != return_value )
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
   {
     return( return_value );
   }
@@ -1517,6 +3132,103 @@ python_convolve (
                  PyObject* in_signal_one,
                  PyObject* in_signal_two
                  )
+{
+  return  (
+           python_convolve_with_method  (
+                                         in_signal_one,
+                                         in_signal_two,
+                                         CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC
+                                         )
+           );
+}
+
+PyObject*
+python_convolve_with_method (
+                             PyObject*                  in_signal_one,
+                             PyObject*                  in_signal_two,
+                             csignal_convolution_method in_method
+                             )
+{
+  return  (
+           python_convolve_with_mode  (
+                                       in_signal_one,
+                                       in_signal_two,
+                                       CSIGNAL_CONVOLUTION_MODE_FULL,
+                                       in_method
+                                       )
+           );
+}
+
+PyObject*
+python_convolve_with_mode (
+                           PyObject*                  in_signal_one,
+                           PyObject*                  in_signal_two,
+                           csignal_convolution_mode   in_mode,
+                           csignal_convolution_method in_method
+                           )
+{
+  return  (
+           python_convolve_decimated  (
+                                       in_signal_one,
+                                       in_signal_two,
+                                       in_mode,
+                                       in_method,
+                                       1
+                                       )
+           );
+}
+
+PyObject*
+python_convolve_decimated (
+                           PyObject*                  in_signal_one,
+                           PyObject*                  in_signal_two,
+                           csignal_convolution_mode   in_mode,
+                           csignal_convolution_method in_method,
+                           USIZE                      in_decimation
+                           )
+{
+  return  (
+           python_convolve_region (
+                                   in_signal_one,
+                                   in_signal_two,
+                                   CPC_FALSE,
+                                   in_mode,
+                                   in_method,
+                                   in_decimation
+                                   )
+           );
+}
+
+PyObject*
+python_convolve_symmetric (
+                           PyObject*                  in_signal,
+                           PyObject*                  in_filter,
+                           csignal_convolution_mode   in_mode,
+                           csignal_convolution_method in_method,
+                           USIZE                      in_decimation
+                           )
+{
+  return  (
+           python_convolve_region (
+                                   in_signal,
+                                   in_filter,
+                                   CPC_TRUE,
+                                   in_mode,
+                                   in_method,
+                                   in_decimation
+                                   )
+           );
+}
+
+PyObject*
+python_convolve_region  (
+                         PyObject*                  in_signal_one,
+                         PyObject*                  in_signal_two,
+                         CPC_BOOL                   in_symmetric,
+                         csignal_convolution_mode   in_mode,
+                         csignal_convolution_method in_method,
+                         USIZE                      in_decimation
+                         )
 {
   csignal_error_code result = CPC_ERROR_CODE_NO_ERROR;
   
@@ -1563,49 +3275,390 @@ python_convolve (
                                        &signal_two
                                        );
       
+      if( CPC_ERROR_CODE_NO_ERROR == result && in_symmetric )
+      {
+        result =
+          convolve_symmetric  (
+                               signal_one_length,
+                               signal_one,
+                               signal_two_length,
+                               signal_two,
+                               in_mode,
+                               in_method,
+                               in_decimation,
+                               &convolved_signal_length,
+                               &convolved_signal
+                               );
+      }
+      else if( CPC_ERROR_CODE_NO_ERROR == result )
+      {
+        result =
+          convolve_decimated  (
+                               signal_one_length,
+                               signal_one,
+                               signal_two_length,
+                               signal_two,
+                               in_mode,
+                               in_method,
+                               in_decimation,
+                               &convolved_signal_length,
+                               &convolved_signal
+                               );
+      }
+      
       if( CPC_ERROR_CODE_NO_ERROR == result )
       {
         result =
-          convolve  (
-                     signal_one_length,
-                     signal_one,
-                     signal_two_length,
-                     signal_two,
-                     &convolved_signal_length,
-                     &convolved_signal
-                     );
-        
-        if( CPC_ERROR_CODE_NO_ERROR == result )
-        {
-          result =
-            python_convert_array_to_list  (
-                                           convolved_signal_length,
-                                           convolved_signal,
-                                           &list
-                                           );
-        }
+          python_convert_array_to_list  (
+                                         convolved_signal_length,
+                                         convolved_signal,
+                                         &list
+                                         );
       }
     }
   }
   
-  if( NULL != signal_one )
+  if( NULL != signal_one )
+  {
+    cpc_safe_free( ( void** ) &signal_one );
+  }
+  
+  if( NULL != signal_two )
+  {
+    cpc_safe_free( ( void** ) &signal_two );
+  }
+  
+  if( NULL != convolved_signal )
+  {
+    cpc_safe_free( ( void** ) &convolved_signal );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    return( list );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_block_convolve (
+                       PyObject* in_kernel,
+                       PyObject* in_signal,
+                       USIZE     in_block_length,
+                       USIZE     in_fft_length,
+                       USIZE     in_method
+                       )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* kernel = NULL;
+  FLOAT64* signal = NULL;
+  
+  csignal_block_convolver* convolver = NULL;
+  
+  USIZE kernel_length = 0;
+  USIZE signal_length = 0;
+
+  csignal_error_code result =
+    python_convert_list_to_array( in_kernel, &kernel_length, &kernel );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && 0 == in_block_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Block length is zero." );
+    
+    result = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_block_convolver  (
+                                           kernel_length,
+                                           kernel,
+                                           in_fft_length,
+                                           ( csignal_overlap_method ) in_method,
+                                           &convolver
+                                           );
+  }
+  
+  //  The signal is convolved in place, block by block
+  for (
+       USIZE i = 0;
+       i < signal_length && CPC_ERROR_CODE_NO_ERROR == result;
+       i += in_block_length
+       )
+  {
+    result =
+      csignal_block_convolver_process (
+                                       convolver,
+                                       CPC_MIN  (
+                                                 USIZE,
+                                                 in_block_length,
+                                                 signal_length - i
+                                                 ),
+                                       signal + i,
+                                       signal + i
+                                       );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_array_to_list( signal_length, signal, &return_value );
+  }
+
+  if( NULL != convolver )
+  {
+    csignal_destroy_block_convolver( convolver );
+  }
+
+  if( NULL != kernel )
+  {
+    cpc_safe_free( ( void** )&kernel );
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_fdl_convolve (
+                     PyObject* in_kernel,
+                     PyObject* in_signal,
+                     USIZE     in_block_length,
+                     USIZE     in_partition_length
+                     )
+{
+  PyObject* return_value = NULL;
+
+  FLOAT64* kernel = NULL;
+  FLOAT64* signal = NULL;
+  
+  csignal_fdl_convolver* convolver = NULL;
+  
+  USIZE kernel_length = 0;
+  USIZE signal_length = 0;
+
+  csignal_error_code result =
+    python_convert_list_to_array( in_kernel, &kernel_length, &kernel );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && 0 == in_block_length )
+  {
+    CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Block length is zero." );
+    
+    result = CPC_ERROR_CODE_INVALID_PARAMETER;
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_fdl_convolver  (
+                                         kernel_length,
+                                         kernel,
+                                         in_partition_length,
+                                         &convolver
+                                         );
+  }
+  
+  //  The signal is convolved in place, block by block
+  for (
+       USIZE i = 0;
+       i < signal_length && CPC_ERROR_CODE_NO_ERROR == result;
+       i += in_block_length
+       )
+  {
+    result =
+      csignal_fdl_convolver_process (
+                                     convolver,
+                                     CPC_MIN  (
+                                               USIZE,
+                                               in_block_length,
+                                               signal_length - i
+                                               ),
+                                     signal + i,
+                                     signal + i
+                                     );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_array_to_list( signal_length, signal, &return_value );
+  }
+
+  if( NULL != convolver )
+  {
+    csignal_destroy_fdl_convolver( convolver );
+  }
+
+  if( NULL != kernel )
+  {
+    cpc_safe_free( ( void** )&kernel );
+  }
+
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** )&signal );
+  }
+
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+csignal_correlator*
+python_initialize_correlator  (
+                               PyObject* in_reference
+                               )
+{
+  csignal_correlator* correlator = NULL;
+  
+  FLOAT64* reference = NULL;
+  
+  USIZE reference_length = 0;
+  
+  csignal_error_code result =
+    python_convert_list_to_array  (
+                                   in_reference,
+                                   &reference_length,
+                                   &reference
+                                   );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_correlator (
+                                     reference_length,
+                                     reference,
+                                     &correlator
+                                     );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR != result )
+  {
+    CPC_ERROR( "Could not create correlator: 0x%x.", result );
+    
+    correlator = NULL;
+  }
+  
+  if( NULL != reference )
+  {
+    cpc_safe_free( ( void** )&reference );
+  }
+  
+  return( correlator );
+}
+
+PyObject*
+python_correlate  (
+                   csignal_correlator*       in_correlator,
+                   csignal_correlation_mode  in_mode,
+                   PyObject*                 in_signal
+                   )
+{
+  PyObject* return_value = NULL;
+  
+  FLOAT64* signal       = NULL;
+  FLOAT64* correlation  = NULL;
+  
+  USIZE signal_length       = 0;
+  USIZE correlation_length  = 0;
+  
+  csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_correlate (
+                         in_correlator,
+                         in_mode,
+                         signal_length,
+                         signal,
+                         &correlation_length,
+                         &correlation
+                         );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
   {
-    cpc_safe_free( ( void** ) &signal_one );
+    result =
+      python_convert_array_to_list  (
+                                     correlation_length,
+                                     correlation,
+                                     &return_value
+                                     );
   }
   
-  if( NULL != signal_two )
+  if( NULL != signal )
   {
-    cpc_safe_free( ( void** ) &signal_two );
+    cpc_safe_free( ( void** )&signal );
   }
   
-  if( NULL != convolved_signal )
+  if( NULL != correlation )
   {
-    cpc_safe_free( ( void** ) &convolved_signal );
+    cpc_safe_free( ( void** )&correlation );
   }
   
-  if( CPC_ERROR_CODE_NO_ERROR == result )
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
   {
-    return( list );
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_cross_correlate  (
+                         PyObject*                 in_signal,
+                         PyObject*                 in_reference,
+                         csignal_correlation_mode  in_mode
+                         )
+{
+  PyObject* return_value = NULL;
+  
+  csignal_correlator* correlator = python_initialize_correlator( in_reference );
+  
+  if( NULL != correlator )
+  {
+    return_value = python_correlate( correlator, in_mode, in_signal );
+    
+    csignal_destroy_correlator( correlator );
+    
+    return( return_value );
   }
   else
   {
@@ -1680,6 +3733,139 @@ python_convert_array_to_list  (
   return( return_value );
 }
 
+csignal_error_code
+python_convert_complex_array_to_list  (
+                                       USIZE      in_array_length,
+                                       FLOAT64*   in_array,
+                                       PyObject** out_list
+                                       )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+  
+  if( NULL == in_array || NULL == out_list )
+  {
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+    
+    CPC_ERROR( "Array (0x%x) or list (0x%x) are null.", in_array, out_list );
+  }
+  else
+  {
+    *out_list = PyList_New( in_array_length / 2 );
+    
+    if( NULL != *out_list )
+    {
+      for( USIZE i = 0; i < in_array_length / 2; i++ )
+      {
+        if(
+           0
+           != PyList_SetItem(
+                             *out_list,
+                             i,
+                             PyComplex_FromDoubles  (
+                                                     in_array[ 2 * i ],
+                                                     in_array[ 2 * i + 1 ]
+                                                     )
+                             )
+           )
+        {
+          return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+          
+          CPC_ERROR( "Could not convert set item 0x%x.", i );
+          
+          break;
+        }
+      }
+      
+      if( CPC_ERROR_CODE_NO_ERROR != return_value )
+      {
+        Py_DECREF( *out_list );
+      }
+    }
+    else
+    {
+      return_value = CPC_ERROR_CODE_API_ERROR;
+      
+      CPC_LOG_STRING( CPC_LOG_LEVEL_ERROR, "Could not create list." );
+    }
+  }
+  
+  return( return_value );
+}
+
+csignal_error_code
+python_convert_complex_list_to_array  (
+                                       PyObject*  in_py_list,
+                                       USIZE*     out_array_length,
+                                       FLOAT64**  out_array
+                                       )
+{
+  csignal_error_code return_value = CPC_ERROR_CODE_NO_ERROR;
+ 
+  if  (
+       NULL == in_py_list
+       || Py_None == in_py_list
+       || NULL == out_array
+       || NULL == out_array_length
+       )
+  {
+    CPC_ERROR (
+               "Python list (0x%x), array (0x%x) or length (0x%x)"
+               " are null or Python None.",
+               in_py_list,
+               out_array,
+               out_array_length
+               );
+    
+    return_value = CPC_ERROR_CODE_NULL_POINTER;
+  }
+  else
+  {
+    *out_array_length = 2 * PyList_Size( in_py_list );
+    *out_array        = NULL;
+    
+    return_value =
+      cpc_safe_malloc (
+                       ( void** ) out_array,
+                       sizeof( FLOAT64 ) * *out_array_length
+                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == return_value )
+    {
+      for( USIZE i = 0; i < *out_array_length / 2; i++ )
+      {
+        PyObject* item = PyList_GetItem( in_py_list, i );
+        
+        if( PyComplex_Check( item ) || PyFloat_Check( item ) )
+        {
+          ( *out_array )[ 2 * i ]     = PyComplex_RealAsDouble( item );
+          ( *out_array )[ 2 * i + 1 ] = PyComplex_ImagAsDouble( item );
+        }
+        else
+        {
+          CPC_ERROR( "Entry 0x%x is not a complex value.", i );
+          
+          return_value = CPC_ERROR_CODE_INVALID_PARAMETER;
+          
+          *out_array_length = 0;
+          
+          cpc_safe_free( ( void** ) out_array );
+          
+          break;
+        }
+      }
+    }
+    else
+    {
+      CPC_ERROR( "Could not malloc signal: 0x%x.", return_value );
+      
+      *out_array_length = 0;
+      *out_array        = NULL;
+    }
+  }
+  
+  return( return_value );
+}
+
 csignal_error_code
 python_convert_list_to_array  (
                                PyObject*  in_py_list,
@@ -2114,6 +4300,160 @@ python_csignal_modulate_BFSK_symbol  (
   }
 }
 
+PyObject*
+python_csignal_demodulate_BFSK_symbol  (
+                                        UINT32     in_samples_per_symbol,
+                                        UINT32     in_sample_rate,
+                                        FLOAT32    in_carrier_frequency,
+                                        UINT32     in_separation_intervals,
+                                        PyObject*  in_signal
+                                        )
+{
+  PyObject* return_value = NULL;
+  
+  FLOAT64* signal = NULL;
+  
+  USIZE signal_length = 0;
+  UINT32 symbol       = 0;
+  
+  csignal_error_code result =
+    python_convert_list_to_array( in_signal, &signal_length, &signal );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_demodulate_BFSK_symbol  (
+                                       in_samples_per_symbol,
+                                       in_sample_rate,
+                                       in_carrier_frequency,
+                                       in_separation_intervals,
+                                       signal_length,
+                                       signal,
+                                       &symbol
+                                       );
+    
+    if( CPC_ERROR_CODE_NO_ERROR == result )
+    {
+      return_value = PyInt_FromLong( symbol );
+    }
+    else
+    {
+      CPC_ERROR( "Could not demodulate symbol: 0x%x.", result );
+    }
+  }
+  
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** ) &signal );
+  }
+  
+  if( NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
+PyObject*
+python_tone_bank_get_power  (
+                             PyObject*  in_frequencies,
+                             UINT32     in_sample_rate,
+                             USIZE      in_window_length,
+                             PyObject*  in_signal
+                             )
+{
+  PyObject* return_value = NULL;
+  
+  FLOAT64* frequencies  = NULL;
+  FLOAT64* signal       = NULL;
+  FLOAT64* power        = NULL;
+  
+  csignal_tone_bank* tone_bank = NULL;
+  
+  USIZE number_of_tones = 0;
+  USIZE signal_length   = 0;
+  
+  csignal_error_code result =
+    python_convert_list_to_array  (
+                                   in_frequencies,
+                                   &number_of_tones,
+                                   &frequencies
+                                   );
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_list_to_array( in_signal, &signal_length, &signal );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_initialize_tone_bank  (
+                                     number_of_tones,
+                                     frequencies,
+                                     in_sample_rate,
+                                     in_window_length,
+                                     &tone_bank
+                                     );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      cpc_safe_malloc( ( void** ) &power, sizeof( FLOAT64 ) * number_of_tones );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      csignal_tone_bank_add_samples( tone_bank, signal_length, signal );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result = csignal_tone_bank_get_power( tone_bank, number_of_tones, power );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result )
+  {
+    result =
+      python_convert_array_to_list( number_of_tones, power, &return_value );
+  }
+  
+  if( NULL != tone_bank )
+  {
+    csignal_destroy_tone_bank( tone_bank );
+  }
+  
+  if( NULL != frequencies )
+  {
+    cpc_safe_free( ( void** ) &frequencies );
+  }
+  
+  if( NULL != signal )
+  {
+    cpc_safe_free( ( void** ) &signal );
+  }
+  
+  if( NULL != power )
+  {
+    cpc_safe_free( ( void** ) &power );
+  }
+  
+  if( CPC_ERROR_CODE_NO_ERROR == result && NULL != return_value )
+  {
+    return( return_value );
+  }
+  else
+  {
+    Py_RETURN_NONE;
+  }
+}
+
 PyObject*
 python_detect_calculate_energy (
                                 PyObject*            in_signal,
@@ -20,6 +20,237 @@ python_calculate_FFT(
                      PyObject* in_signal
                      );
 
+/*! \fn     PyObject* python_calculate_FFT_concurrently  (
+              PyObject* in_signal,
+              USIZE     in_number_of_calls
+            )
+    \brief  Calculates the FFT of in_signal once on the calling thread and then
+            in_number_of_calls times at the same time, each call on a thread of
+            its own, with csignal_calculate_FFT.
+ 
+    \return The largest absolute difference between a component of a
+            concurrently calculated FFT and the FFT calculated alone, or None
+            if an error occurrs.
+ */
+PyObject*
+python_calculate_FFT_concurrently (
+                                   PyObject* in_signal,
+                                   USIZE     in_number_of_calls
+                                   );
+
+/*! \fn     PyObject* python_calculate_FFT_float32  (
+              PyObject* in_signal
+            )
+    \brief  Converts in_signal to FLOAT32, calculates its FFT with
+            csignal_calculate_FFT_float32 and returns a list of Python complex
+            values laid out as the list returned by python_calculate_FFT.
+
+    \return A list of Python Complex values is returned or None if an error
+            occurrs.
+ */
+PyObject*
+python_calculate_FFT_float32(
+                             PyObject* in_signal
+                             );
+
+/*! \fn     PyObject* python_calculate_exact_FFT  (
+              PyObject* in_signal
+            )
+    \brief  Calculates the FFT of in_signal without zero-padding it and returns
+            the len( in_signal ) bins as a list of Python complex values. See
+            csignal_calculate_exact_FFT for more details.
+
+    \return A list of Python Complex values is returned or None if an error
+            occurrs.
+ */
+PyObject*
+python_calculate_exact_FFT(
+                           PyObject* in_signal
+                           );
+
+/*! \fn     PyObject* python_calculate_zoom_FFT  (
+              PyObject* in_signal,
+              UINT32    in_sample_rate,
+              FLOAT64   in_start_frequency,
+              FLOAT64   in_end_frequency,
+              USIZE     in_number_of_bins
+            )
+    \brief  Calculates in_number_of_bins bins of the spectrum of in_signal from
+            in_start_frequency to in_end_frequency with
+            csignal_calculate_zoom_FFT.
+
+    \return A list of Python Complex values is returned or None if an error
+            occurrs.
+ */
+PyObject*
+python_calculate_zoom_FFT (
+                           PyObject* in_signal,
+                           UINT32    in_sample_rate,
+                           FLOAT64   in_start_frequency,
+                           FLOAT64   in_end_frequency,
+                           USIZE     in_number_of_bins
+                           );
+
+/*! \fn     PyObject* python_calculate_batch_FFT  (
+              USIZE     in_frame_length,
+              PyObject* in_signal
+            )
+    \brief  Splits in_signal into frames of in_frame_length samples and
+            calculates their FFTs with a single call to
+            csignal_calculate_batch_FFT.
+
+    \return A list with one list of Python Complex values per frame is
+            returned or None if an error occurrs (e.g., the length of in_signal
+            is not a multiple of in_frame_length).
+ */
+PyObject*
+python_calculate_batch_FFT(
+                           USIZE     in_frame_length,
+                           PyObject* in_signal
+                           );
+
+/*! \fn     PyObject* python_calculate_STFT  (
+              USIZE     in_window_length,
+              USIZE     in_hop_length,
+              USIZE     in_fft_length,
+              USIZE     in_window_type,
+              CPC_BOOL  in_magnitude,
+              PyObject* in_signal
+            )
+    \brief  Feeds in_signal through a csignal_stft and returns its frames.
+            Complex frames are lists of interleaved real and imaginary values.
+
+    \return A list with one list of Python floats per frame is returned or None
+            if an error occurrs.
+ */
+PyObject*
+python_calculate_STFT(
+                      USIZE     in_window_length,
+                      USIZE     in_hop_length,
+                      USIZE     in_fft_length,
+                      USIZE     in_window_type,
+                      CPC_BOOL  in_magnitude,
+                      PyObject* in_signal
+                      );
+
+/*! \fn     PyObject* python_calculate_ISTFT  (
+              USIZE     in_window_length,
+              USIZE     in_hop_length,
+              USIZE     in_fft_length,
+              USIZE     in_window_type,
+              PyObject* in_frames
+            )
+    \brief  Overlap-adds the complex frames returned by python_calculate_STFT,
+            concatenated into a single list, with a csignal_istft and flushes
+            it.
+
+    \return A list of Python floats is returned or None if an error occurrs.
+ */
+PyObject*
+python_calculate_ISTFT(
+                       USIZE     in_window_length,
+                       USIZE     in_hop_length,
+                       USIZE     in_fft_length,
+                       USIZE     in_window_type,
+                       PyObject* in_frames
+                       );
+
+/*! \fn     PyObject* python_calculate_welch_PSD  (
+              PyObject*  in_signal,
+              UINT32     in_sample_rate,
+              USIZE      in_segment_length,
+              USIZE      in_overlap_length,
+              USIZE      in_window_type,
+              FLOAT64    in_window_parameter
+            )
+    \brief  Calculates the one-sided PSD of in_signal with
+            csignal_calculate_welch_PSD.
+ 
+    \return A list of in_segment_length / 2 + 1 Python floats or None if an
+            error occurrs.
+ */
+PyObject*
+python_calculate_welch_PSD  (
+                             PyObject*  in_signal,
+                             UINT32     in_sample_rate,
+                             USIZE      in_segment_length,
+                             USIZE      in_overlap_length,
+                             USIZE      in_window_type,
+                             FLOAT64    in_window_parameter
+                             );
+
+/*! \fn     PyObject* python_calculate_real_FFT  (
+              PyObject* in_signal
+            )
+    \brief  Calculates the FFT of the real-valued signal in_signal and returns
+            the N / 2 + 1 non-redundant bins as a list of Python complex values.
+            See csignal_calculate_real_FFT for more details.
+
+    \return A list of Python Complex values is returned or None if an error
+            occurrs.
+ */
+PyObject*
+python_calculate_real_FFT(
+                          PyObject* in_signal
+                          );
+
+/*! \fn     PyObject* python_calculate_real_IFFT  (
+              PyObject* in_fft
+            )
+    \brief  Calculates the real-valued signal whose non-redundant FFT bins are
+            in in_fft (a list of Python complex values). See
+            csignal_calculate_real_IFFT for more details.
+
+    \return A list of Python floats is returned or None if an error occurrs.
+ */
+PyObject*
+python_calculate_real_IFFT(
+                           PyObject* in_fft
+                           );
+
+/*! \fn     PyObject* python_calculate_complex_IFFT  (
+              PyObject* in_fft
+            )
+    \brief  Calculates the scaled IFFT of the list of Python complex values
+            in_fft, e.g., the list returned by python_calculate_FFT, and returns
+            it as a list of Python complex values. See
+            csignal_calculate_complex_IFFT for more details.
+
+    \return A list of Python Complex values is returned or None if an error
+            occurrs.
+ */
+PyObject*
+python_calculate_complex_IFFT(
+                              PyObject* in_fft
+                              );
+
+/*! \fn     PyObject* python_execute_FFT_out_of_place  (
+              PyObject* in_data,
+              CPC_BOOL  in_exact,
+              CPC_BOOL  in_inverse,
+              USIZE     in_offset
+            )
+    \brief  Transforms the list of Python complex values in_data with a plan
+            of its length using csignal_execute_FFT_out_of_place,
+            csignal_execute_IFFT_out_of_place or, if in_exact is true, their
+            exact FFT counterparts. The input is stored at the start of a
+            buffer and the output in_offset elements (i.e., in_offset / 2
+            complex values) further into it, so an offset of zero transforms
+            in place and offsets below 2 * len( in_data ) overlap the input.
+ 
+    \return A tuple of the error code returned by the execute function and
+            the transform as a list of Python complex values (None if the
+            error code is not NO_ERROR), or None if the plan could not be
+            created.
+ */
+PyObject*
+python_execute_FFT_out_of_place (
+                                 PyObject* in_data,
+                                 CPC_BOOL  in_exact,
+                                 CPC_BOOL  in_inverse,
+                                 USIZE     in_offset
+                                 );
+
 /*! \fn     PyObject* python_filter_signal  (
               fir_passband_filter*  in_filter,
               PyObject*             in_signal
@@ -35,6 +266,97 @@ python_filter_signal(
                      PyObject*              in_signal
                      );
 
+/*! \fn     PyObject* python_filter_with_mode (
+              fir_passband_filter*     in_filter,
+              csignal_convolution_mode in_mode,
+              PyObject*                in_signal
+            )
+    \brief  Filters in_signal like python_filter_signal, but only returns the
+            part in_mode of the filtered signal, see csignal_filter_with_mode.
+ */
+PyObject*
+python_filter_with_mode (
+                         fir_passband_filter*     in_filter,
+                         csignal_convolution_mode in_mode,
+                         PyObject*                in_signal
+                         );
+
+/*! \fn     PyObject* python_filter_decimated (
+              fir_passband_filter*     in_filter,
+              csignal_convolution_mode in_mode,
+              USIZE                    in_decimation,
+              PyObject*                in_signal
+            )
+    \brief  Filters in_signal like python_filter_with_mode, but only returns
+            every in_decimation-th sample, see csignal_filter_decimated.
+ */
+PyObject*
+python_filter_decimated (
+                         fir_passband_filter*     in_filter,
+                         csignal_convolution_mode in_mode,
+                         USIZE                    in_decimation,
+                         PyObject*                in_signal
+                         );
+
+/*! \fn     PyObject* python_filter_stream (
+              fir_passband_filter* in_filter,
+              PyObject*            in_signal,
+              USIZE                in_block_length
+            )
+    \brief  Filters in_signal by feeding blocks of in_block_length samples (the
+            last one may be shorter) to a fir_filter_state.
+ 
+    \return A list of len( in_signal ) Python floats, the first samples of
+            python_filter_signal, or None if an error occurrs.
+ */
+PyObject*
+python_filter_stream  (
+                       fir_passband_filter* in_filter,
+                       PyObject*            in_signal,
+                       USIZE                in_block_length
+                       );
+
+/*! \fn     PyObject* python_decimate_stream (
+              fir_passband_filter* in_filter,
+              USIZE                in_decimation,
+              PyObject*            in_signal,
+              USIZE                in_block_length
+            )
+    \brief  Decimates in_signal by feeding blocks of in_block_length samples
+            (the last one may be shorter) to a fir_decimator.
+ 
+    \return A list of the ( len( in_signal ) + in_decimation - 1 ) /
+            in_decimation Python floats, every in_decimation-th sample of
+            python_filter_signal, or None if an error occurrs.
+ */
+PyObject*
+python_decimate_stream  (
+                         fir_passband_filter* in_filter,
+                         USIZE                in_decimation,
+                         PyObject*            in_signal,
+                         USIZE                in_block_length
+                         );
+
+/*! \fn     PyObject* python_interpolate_stream (
+              fir_passband_filter* in_filter,
+              USIZE                in_interpolation,
+              PyObject*            in_signal,
+              USIZE                in_block_length
+            )
+    \brief  Interpolates in_signal by feeding blocks of in_block_length
+            samples (the last one may be shorter) to a fir_interpolator.
+ 
+    \return A list of len( in_signal ) * in_interpolation Python floats, or
+            None if an error occurrs.
+ */
+PyObject*
+python_interpolate_stream (
+                           fir_passband_filter* in_filter,
+                           USIZE                in_interpolation,
+                           PyObject*            in_signal,
+                           USIZE                in_block_length
+                           );
+
 /*! \fn     fir_passband_filter* python_initialize_kaiser_filter (
               FLOAT32 in_first_stopband,
               FLOAT32 in_first_passband,
@@ -374,6 +696,196 @@ python_convolve (
                  PyObject* in_signal_two
                  );
 
+/*! \fn     PyObject* python_convolve_with_method (
+              PyObject*                  in_signal_one,
+              PyObject*                  in_signal_two,
+              csignal_convolution_method in_method
+            )
+    \brief  Convolves both input signals with the algorithm in_method and
+            returns a new Python list, see python_convolve.
+ 
+    \param  in_signal_one The first of the two signals to be convolved.
+    \param  in_signal_two The second of the two signals to be convolved.
+    \param  in_method The convolution algorithm.
+    \return None on error. A new Python on list (new reference on success).
+ */
+PyObject*
+python_convolve_with_method (
+                             PyObject*                  in_signal_one,
+                             PyObject*                  in_signal_two,
+                             csignal_convolution_method in_method
+                             );
+
+/*! \fn     PyObject* python_convolve_with_mode (
+              PyObject*                  in_signal_one,
+              PyObject*                  in_signal_two,
+              csignal_convolution_mode   in_mode,
+              csignal_convolution_method in_method
+            )
+    \brief  Returns the part in_mode of the convolution of both input signals
+            as a new Python list, see convolve_with_mode.
+ 
+    \param  in_signal_one The first of the two signals to be convolved.
+    \param  in_signal_two The second of the two signals to be convolved.
+    \param  in_mode The part of the convolution to return.
+    \param  in_method The convolution algorithm.
+    \return None on error. A new Python on list (new reference on success).
+ */
+PyObject*
+python_convolve_with_mode (
+                           PyObject*                  in_signal_one,
+                           PyObject*                  in_signal_two,
+                           csignal_convolution_mode   in_mode,
+                           csignal_convolution_method in_method
+                           );
+
+/*! \fn     PyObject* python_convolve_decimated (
+              PyObject*                  in_signal_one,
+              PyObject*                  in_signal_two,
+              csignal_convolution_mode   in_mode,
+              csignal_convolution_method in_method,
+              USIZE                      in_decimation
+            )
+    \brief  Returns every in_decimation-th sample of the part in_mode of the
+            convolution of both input signals as a new Python list, see
+            convolve_decimated.
+ 
+    \param  in_signal_one The first of the two signals to be convolved.
+    \param  in_signal_two The second of the two signals to be convolved.
+    \param  in_mode The part of the convolution to return.
+    \param  in_method The convolution algorithm.
+    \param  in_decimation The distance between the returned samples.
+    \return None on error. A new Python on list (new reference on success).
+ */
+PyObject*
+python_convolve_decimated (
+                           PyObject*                  in_signal_one,
+                           PyObject*                  in_signal_two,
+                           csignal_convolution_mode   in_mode,
+                           csignal_convolution_method in_method,
+                           USIZE                      in_decimation
+                           );
+
+/*! \fn     PyObject* python_convolve_symmetric (
+              PyObject*                  in_signal,
+              PyObject*                  in_filter,
+              csignal_convolution_mode   in_mode,
+              csignal_convolution_method in_method,
+              USIZE                      in_decimation
+            )
+    \brief  python_convolve_decimated for a symmetric in_filter, see
+            convolve_symmetric.
+ 
+    \param  in_signal The signal to filter.
+    \param  in_filter The symmetric filter.
+    \param  in_mode The part of the convolution to return.
+    \param  in_method The convolution algorithm.
+    \param  in_decimation The distance between the returned samples.
+    \return None on error. A new Python on list (new reference on success).
+ */
+PyObject*
+python_convolve_symmetric (
+                           PyObject*                  in_signal,
+                           PyObject*                  in_filter,
+                           csignal_convolution_mode   in_mode,
+                           csignal_convolution_method in_method,
+                           USIZE                      in_decimation
+                           );
+
+/*! \fn     PyObject* python_block_convolve (
+              PyObject* in_kernel,
+              PyObject* in_signal,
+              USIZE     in_block_length,
+              USIZE     in_fft_length,
+              USIZE     in_method
+            )
+    \brief  Convolves in_signal with in_kernel by feeding blocks of
+            in_block_length samples (the last one may be shorter) to a
+            csignal_block_convolver.
+ 
+    \return A list of len( in_signal ) Python floats, the first samples of
+            the convolution, or None if an error occurrs.
+ */
+PyObject*
+python_block_convolve (
+                       PyObject* in_kernel,
+                       PyObject* in_signal,
+                       USIZE     in_block_length,
+                       USIZE     in_fft_length,
+                       USIZE     in_method
+                       );
+
+/*! \fn     PyObject* python_fdl_convolve (
+              PyObject* in_kernel,
+              PyObject* in_signal,
+              USIZE     in_block_length,
+              USIZE     in_partition_length
+            )
+    \brief  Convolves in_signal with in_kernel by feeding blocks of
+            in_block_length samples (the last one may be shorter) to a
+            csignal_fdl_convolver.
+ 
+    \return A list of len( in_signal ) Python floats, the first samples of
+            the convolution, or None if an error occurrs.
+ */
+PyObject*
+python_fdl_convolve (
+                     PyObject* in_kernel,
+                     PyObject* in_signal,
+                     USIZE     in_block_length,
+                     USIZE     in_partition_length
+                     );
+
+/*! \fn     csignal_correlator* python_initialize_correlator (
+              PyObject* in_reference
+            )
+    \brief  Creates a correlator for the list of Python floats in_reference,
+            see csignal_initialize_correlator. It must be freed with
+            csignal_destroy_correlator.
+ 
+    \return The correlator or None if an error occurrs.
+ */
+csignal_correlator*
+python_initialize_correlator  (
+                               PyObject* in_reference
+                               );
+
+/*! \fn     PyObject* python_correlate (
+              csignal_correlator*       in_correlator,
+              csignal_correlation_mode  in_mode,
+              PyObject*                 in_signal
+            )
+    \brief  Cross-correlates in_signal with the reference of in_correlator,
+            see csignal_correlate.
+ 
+    \return A list of Python floats, the lags in_mode of the
+            cross-correlation, or None if an error occurrs.
+ */
+PyObject*
+python_correlate  (
+                   csignal_correlator*       in_correlator,
+                   csignal_correlation_mode  in_mode,
+                   PyObject*                 in_signal
+                   );
+
+/*! \fn     PyObject* python_cross_correlate (
+              PyObject*                 in_signal,
+              PyObject*                 in_reference,
+              csignal_correlation_mode  in_mode
+            )
+    \brief  Cross-correlates in_signal with in_reference, see
+            csignal_cross_correlate.
+ 
+    \return A list of Python floats, the lags in_mode of the
+            cross-correlation, or None if an error occurrs.
+ */
+PyObject*
+python_cross_correlate  (
+                         PyObject*                 in_signal,
+                         PyObject*                 in_reference,
+                         csignal_correlation_mode  in_mode
+                         );
+
 /*! \fn     PyObject* python_csignal_multiply_signals (
               PyObject* in_signal_one,
               PyObject* in_signal_two
@@ -486,6 +998,47 @@ python_csignal_modulate_BFSK_symbol  (
                                       UINT32     in_symbol_expansion_factor
                                       );
 
+/*! \fn     PyObject* python_csignal_demodulate_BFSK_symbol  (
+              UINT32     in_samples_per_symbol,
+              UINT32     in_sample_rate,
+              FLOAT32    in_carrier_frequency,
+              UINT32     in_separation_intervals,
+              PyObject*  in_signal
+            )
+    \brief  Demodulates the symbol at the start of in_signal. See
+            csignal_demodulate_BFSK_symbol for details.
+ 
+    \return A Python int with the symbol (0 or 1) or None if an error occurrs.
+ */
+PyObject*
+python_csignal_demodulate_BFSK_symbol  (
+                                        UINT32     in_samples_per_symbol,
+                                        UINT32     in_sample_rate,
+                                        FLOAT32    in_carrier_frequency,
+                                        UINT32     in_separation_intervals,
+                                        PyObject*  in_signal
+                                        );
+
+/*! \fn     PyObject* python_tone_bank_get_power  (
+              PyObject*  in_frequencies,
+              UINT32     in_sample_rate,
+              USIZE      in_window_length,
+              PyObject*  in_signal
+            )
+    \brief  Slides a csignal_tone_bank over in_signal and returns the power at
+            in_frequencies over its last in_window_length samples.
+ 
+    \return A list of Python floats, one per frequency, or None if an error
+            occurrs.
+ */
+PyObject*
+python_tone_bank_get_power  (
+                             PyObject*  in_frequencies,
+                             UINT32     in_sample_rate,
+                             USIZE      in_window_length,
+                             PyObject*  in_signal
+                             );
+
 /*! \fn     PyObject* python_detect_calculate_energy (
               PyObject*            in_signal,
               PyObject*            in_spread_signal,
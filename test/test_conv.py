@@ -2,6 +2,7 @@ from csignal_tests import *
 
 import unittest
 import random
+import math
 
 class TestsConv( unittest.TestCase ):
   def test_triangle( self ):
@@ -42,6 +43,437 @@ class TestsConv( unittest.TestCase ):
     for index in range( len( input ) ):
       self.assertEquals( input[ index ], output[ index ] )
 
+  def test_conv_methods( self ):
+    for _ in range( 100 ):
+      nImpulse = random.randint( 1, 300 )
+      nInput = random.randint( 1, 2000 )
+
+      input = [ random.normalvariate( 0, 1 ) for i in range( nInput ) ]
+      impulse = [ random.normalvariate( 0, 1 ) for i in range( nImpulse ) ]
+
+      direct = \
+        python_convolve_with_method (
+          input, impulse, CSIGNAL_CONVOLUTION_METHOD_DIRECT
+                                    )
+
+      self.assertNotEquals( direct, None )
+
+      for method in [ CSIGNAL_CONVOLUTION_METHOD_FFT, CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC ]:
+        output = python_convolve_with_method( input, impulse, method )
+
+        self.assertNotEquals( output, None )
+        self.assertEquals( len( output ), len( direct ) )
+
+        for index in range( len( output ) ):
+          self.assertAlmostEquals( output[ index ], direct[ index ], 9 )
+
+    output = python_convolve_with_method( [ 1.0 ], [ 1.0 ], 3 )
+
+    self.assertEquals( output, None )
+
+  def test_conv_modes( self ):
+    for _ in range( 50 ):
+      nImpulse = random.randint( 1, 300 )
+      nInput = random.randint( 1, 2000 )
+
+      input = [ random.normalvariate( 0, 1 ) for i in range( nInput ) ]
+      impulse = [ random.normalvariate( 0, 1 ) for i in range( nImpulse ) ]
+
+      full = python_convolve( input, impulse )
+
+      self.assertNotEquals( full, None )
+
+      shorter = min( nInput, nImpulse )
+      longer = max( nInput, nImpulse )
+
+      expected = {
+        CSIGNAL_CONVOLUTION_MODE_FULL : full,
+        CSIGNAL_CONVOLUTION_MODE_SAME :
+          full[ ( nImpulse - 1 ) / 2 : ( nImpulse - 1 ) / 2 + nInput ],
+        CSIGNAL_CONVOLUTION_MODE_VALID :
+          full[ shorter - 1 : longer ]
+                 }
+
+      for mode in expected.keys():
+        for method in [ CSIGNAL_CONVOLUTION_METHOD_DIRECT, CSIGNAL_CONVOLUTION_METHOD_FFT ]:
+          output = python_convolve_with_mode( input, impulse, mode, method )
+
+          self.assertNotEquals( output, None )
+          self.assertEquals( len( output ), len( expected[ mode ] ) )
+
+          for index in range( len( output ) ):
+            self.assertAlmostEquals( output[ index ], expected[ mode ][ index ], 9 )
+
+    output = \
+      python_convolve_with_mode (
+        [], [ 1.0 ], CSIGNAL_CONVOLUTION_MODE_SAME,
+        CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC
+                                )
+
+    self.assertEquals( output, None )
+
+  def test_conv_decimated( self ):
+    for _ in range( 50 ):
+      nImpulse = random.randint( 1, 300 )
+      nInput = random.randint( 1, 2000 )
+
+      input = [ random.normalvariate( 0, 1 ) for i in range( nInput ) ]
+      impulse = [ random.normalvariate( 0, 1 ) for i in range( nImpulse ) ]
+
+      for mode in [ CSIGNAL_CONVOLUTION_MODE_FULL, CSIGNAL_CONVOLUTION_MODE_SAME, CSIGNAL_CONVOLUTION_MODE_VALID ]:
+        expected = \
+          python_convolve_with_mode (
+            input, impulse, mode, CSIGNAL_CONVOLUTION_METHOD_DIRECT
+                                    )
+
+        self.assertNotEquals( expected, None )
+
+        for decimation in [ 1, 2, 5, 64 ]:
+          for method in [ CSIGNAL_CONVOLUTION_METHOD_DIRECT, CSIGNAL_CONVOLUTION_METHOD_FFT, CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC ]:
+            output = \
+              python_convolve_decimated (
+                input, impulse, mode, method, decimation
+                                        )
+
+            self.assertNotEquals( output, None )
+            self.assertEquals( len( output ), len( expected[ : : decimation ] ) )
+
+            for index in range( len( output ) ):
+              self.assertAlmostEquals( output[ index ], expected[ index * decimation ], 9 )
+
+    output = \
+      python_convolve_decimated (
+        [ 1.0 ], [ 1.0 ], CSIGNAL_CONVOLUTION_MODE_FULL,
+        CSIGNAL_CONVOLUTION_METHOD_AUTOMATIC, 0
+                                )
+
+    self.assertEquals( output, None )
+
+  def test_conv_symmetric( self ):
+    for _ in range( 50 ):
+      nImpulse = random.randint( 1, 300 )
+      nInput = random.randint( nImpulse, 2000 )
+
+      input = [ random.normalvariate( 0, 1 ) for i in range( nInput ) ]
+      half = [ random.normalvariate( 0, 1 ) for i in range( ( nImpulse + 1 ) / 2 ) ]
+      impulse = half[ : nImpulse / 2 ] + half[ : : -1 ]
+
+      self.assertEquals( len( impulse ), nImpulse )
+
+      for mode in [ CSIGNAL_CONVOLUTION_MODE_FULL, CSIGNAL_CONVOLUTION_MODE_SAME, CSIGNAL_CONVOLUTION_MODE_VALID ]:
+        for decimation in [ 1, 3 ]:
+          expected = \
+            python_convolve_decimated (
+              input, impulse, mode, CSIGNAL_CONVOLUTION_METHOD_DIRECT,
+              decimation
+                                      )
+
+          self.assertNotEquals( expected, None )
+
+          for method in [ CSIGNAL_CONVOLUTION_METHOD_DIRECT, CSIGNAL_CONVOLUTION_METHOD_FFT ]:
+            output = \
+              python_convolve_symmetric (
+                input, impulse, mode, method, decimation
+                                        )
+
+            self.assertNotEquals( output, None )
+            self.assertEquals( len( output ), len( expected ) )
+
+            for index in range( len( output ) ):
+              self.assertAlmostEquals( output[ index ], expected[ index ], 9 )
+
+  def test_conv_kernels( self ):
+    selected = csignal_fft_get_kernel()
+
+    kernels = [
+      CSIGNAL_FFT_KERNEL_SSE2,
+      CSIGNAL_FFT_KERNEL_AVX2,
+      CSIGNAL_FFT_KERNEL_NEON
+              ]
+
+    for _ in range( 50 ):
+      nImpulse = random.randint( 1, 40 )
+      nInput = random.randint( 1, 100 )
+
+      input = [ random.normalvariate( 0, 1 ) for i in range( nInput ) ]
+      impulse = [ random.normalvariate( 0, 1 ) for i in range( nImpulse ) ]
+
+      self.assertEquals (
+        csignal_fft_set_kernel( CSIGNAL_FFT_KERNEL_SCALAR ),
+        CPC_ERROR_CODE_NO_ERROR
+                        )
+
+      expected = \
+        python_convolve_with_method (
+          input, impulse, CSIGNAL_CONVOLUTION_METHOD_DIRECT
+                                    )
+
+      self.assertNotEquals( expected, None )
+
+      for kernel in kernels:
+        if( CPC_ERROR_CODE_NO_ERROR == csignal_fft_set_kernel( kernel ) ):
+          output = \
+            python_convolve_with_method (
+              input, impulse, CSIGNAL_CONVOLUTION_METHOD_DIRECT
+                                        )
+
+          self.assertNotEquals( output, None )
+          self.assertEquals( len( output ), len( expected ) )
+
+          for index in range( len( output ) ):
+            self.assertAlmostEquals( output[ index ], expected[ index ], 12 )
+
+    self.assertEquals (
+      csignal_fft_set_kernel( selected ),
+      CPC_ERROR_CODE_NO_ERROR
+                      )
+
+  def test_conv_threads( self ):
+    input = [ random.normalvariate( 0, 1 ) for i in range( 5000 ) ]
+
+    for nImpulse in [ 1, 40, 700 ]:
+      impulse = [ random.normalvariate( 0, 1 ) for i in range( nImpulse ) ]
+
+      for method in [ CSIGNAL_CONVOLUTION_METHOD_DIRECT, CSIGNAL_CONVOLUTION_METHOD_FFT ]:
+        csignal_set_convolution_grain_size( 0 )
+
+        expected = python_convolve_with_method( input, impulse, method )
+
+        self.assertNotEquals( expected, None )
+
+        for grain in [ 1, 300, 4096 ]:
+          csignal_set_convolution_grain_size( grain )
+
+          self.assertEquals( csignal_get_convolution_grain_size(), grain )
+
+          outputs = []
+
+          for threads in [ 1, 3 ]:
+            self.assertEquals (
+              csignal_set_number_of_threads( threads ),
+              CPC_ERROR_CODE_NO_ERROR
+                              )
+
+            output = python_convolve_with_method( input, impulse, method )
+
+            self.assertNotEquals( output, None )
+            self.assertEquals( len( output ), len( expected ) )
+
+            for index in range( len( output ) ):
+              self.assertAlmostEquals( output[ index ], expected[ index ], 9 )
+
+            outputs.append( output )
+
+          self.assertEquals( outputs[ 0 ], outputs[ 1 ] )
+
+    csignal_set_convolution_grain_size( CSIGNAL_CONVOLUTION_DEFAULT_GRAIN_SIZE )
+
+    self.assertEquals (
+      csignal_set_number_of_threads( 1 ),
+      CPC_ERROR_CODE_NO_ERROR
+                      )
+
+  def test_block_convolve( self ):
+    input = [ random.normalvariate( 0, 1 ) for i in range( 3000 ) ]
+
+    for nImpulse in [ 1, 15, 200 ]:
+      impulse = [ random.normalvariate( 0, 1 ) for i in range( nImpulse ) ]
+
+      expected = python_convolve( input, impulse )
+
+      for method in [ CSIGNAL_OVERLAP_SAVE, CSIGNAL_OVERLAP_ADD ]:
+        for blockLength in [ 1, 17, 256, 5000 ]:
+          for fftLength in [ 0, 512 ]:
+            output = \
+              python_block_convolve (
+                impulse, input, blockLength, fftLength, method
+                                    )
+
+            self.assertNotEquals( output, None )
+            self.assertEquals( len( output ), len( input ) )
+
+            for index in range( len( output ) ):
+              self.assertAlmostEquals( output[ index ], expected[ index ], 9 )
+
+    impulse = [ 1.0 ] * 100
+
+    self.assertEquals( python_block_convolve( impulse, input, 10, 64, CSIGNAL_OVERLAP_SAVE ), None )
+    self.assertEquals( python_block_convolve( impulse, input, 10, 200, CSIGNAL_OVERLAP_SAVE ), None )
+    self.assertEquals( python_block_convolve( impulse, input, 10, 0, 2 ), None )
+
+  def test_fdl_convolve( self ):
+    input = [ random.normalvariate( 0, 1 ) for i in range( 5000 ) ]
+
+    for nImpulse in [ 1, 100, 2000 ]:
+      impulse = \
+        [ random.normalvariate( 0, 1 ) * math.exp( -i / 500.0 ) for i in range( nImpulse ) ]
+
+      expected = python_convolve( input, impulse )
+
+      for partitionLength in [ 1, 32, 256 ]:
+        for blockLength in [ 1, 32, 100, 6000 ]:
+          output = \
+            python_fdl_convolve (
+              impulse, input, blockLength, partitionLength
+                                )
+
+          self.assertNotEquals( output, None )
+          self.assertEquals( len( output ), len( input ) )
+
+          for index in range( len( output ) ):
+            self.assertAlmostEquals( output[ index ], expected[ index ], 9 )
+
+    self.assertEquals( python_fdl_convolve( [ 1.0 ], input, 10, 48 ), None )
+    self.assertEquals( python_fdl_convolve( [ 1.0 ], input, 10, 0 ), None )
+
+  def test_cross_correlate( self ):
+    for _ in range( 30 ):
+      nReference = random.randint( 1, 400 )
+      nInput = random.randint( 1, 2000 )
+
+      input = [ random.normalvariate( 0, 1 ) for i in range( nInput ) ]
+      reference = [ random.normalvariate( 0, 1 ) for i in range( nReference ) ]
+
+      full = python_cross_correlate( input, reference, CSIGNAL_CORRELATION_MODE_FULL )
+
+      self.assertNotEquals( full, None )
+      self.assertEquals( len( full ), nInput + nReference - 1 )
+
+      for index in range( len( full ) ):
+        lag = index - ( nReference - 1 )
+
+        expected = 0.0
+
+        for j in range( max( 0, -lag ), min( nReference, nInput - lag ) ):
+          expected += reference[ j ] * input[ lag + j ]
+
+        self.assertAlmostEquals( full[ index ], expected, 9 )
+
+      valid = python_cross_correlate( input, reference, CSIGNAL_CORRELATION_MODE_VALID )
+
+      if( nReference > nInput ):
+        self.assertEquals( valid, None )
+      else:
+        self.assertNotEquals( valid, None )
+        self.assertEquals( len( valid ), nInput - nReference + 1 )
+
+        for index in range( len( valid ) ):
+          self.assertAlmostEquals( valid[ index ], full[ index + nReference - 1 ], 9 )
+
+    self.assertEquals( python_cross_correlate( [ 1.0 ], [ 1.0 ], 3 ), None )
+    self.assertEquals( python_cross_correlate( [ 1.0 ], [], CSIGNAL_CORRELATION_MODE_FULL ), None )
+
+  def test_correlator( self ):
+    reference = [ random.choice( [ -1.0, 1.0 ] ) for i in range( 127 ) ]
+
+    correlator = python_initialize_correlator( reference )
+
+    self.assertNotEquals( correlator, None )
+
+    for _ in range( 5 ):
+      offset = random.randint( 0, 1000 )
+      gain = random.uniform( 0.5, 4.0 )
+
+      input = [ random.normalvariate( 0, 0.1 ) for i in range( 1500 ) ]
+
+      for index in range( len( reference ) ):
+        input[ offset + index ] += gain * reference[ index ]
+
+      expected = python_cross_correlate( input, reference, CSIGNAL_CORRELATION_MODE_VALID )
+
+      valid = python_correlate( correlator, CSIGNAL_CORRELATION_MODE_VALID, input )
+
+      self.assertNotEquals( valid, None )
+      self.assertEquals( len( valid ), len( expected ) )
+
+      for index in range( len( valid ) ):
+        self.assertAlmostEquals( valid[ index ], expected[ index ], 9 )
+
+      normalized = python_correlate( correlator, CSIGNAL_CORRELATION_MODE_NORMALIZED, input )
+
+      self.assertNotEquals( normalized, None )
+      self.assertEquals( normalized.index( max( normalized ) ), offset )
+      self.assertTrue( max( normalized ) > 0.9 )
+
+      for value in normalized:
+        self.assertTrue( abs( value ) <= 1.0 + 1e-9 )
+
+    self.assertEquals (
+      csignal_destroy_correlator( correlator ),
+      CPC_ERROR_CODE_NO_ERROR
+                      )
+
+  def test_correlator_silence( self ):
+    reference = [ random.uniform( -1.0, 1.0 ) for i in range( 1023 ) ]
+
+    correlator = python_initialize_correlator( reference )
+
+    self.assertNotEquals( correlator, None )
+
+    # Loud bursts followed by silence leave rounding errors in the running
+    # window energy that must not show up in the silent windows
+    input = []
+
+    for burst in range( 10 ):
+      amplitude = 10.0 ** random.uniform( 0.0, 6.0 )
+
+      input += [ random.uniform( -amplitude, amplitude ) for i in range( 1500 ) ]
+      input += [ 0.0 ] * 2500
+
+    normalized = python_correlate( correlator, CSIGNAL_CORRELATION_MODE_NORMALIZED, input )
+
+    self.assertNotEquals( normalized, None )
+    self.assertEquals( len( normalized ), len( input ) - len( reference ) + 1 )
+
+    for index in range( len( normalized ) ):
+      self.assertTrue( -1.0 <= normalized[ index ] <= 1.0 )
+
+      # The reference lies completely within the silence after a burst
+      if 1500 <= index % 4000 <= 4000 - len( reference ):
+        self.assertEquals( normalized[ index ], 0.0 )
+
+    self.assertEquals (
+      csignal_destroy_correlator( correlator ),
+      CPC_ERROR_CODE_NO_ERROR
+                      )
+
+  def test_correlator_dynamic_range( self ):
+    reference = [ random.uniform( -1.0, 1.0 ) for i in range( 1023 ) ]
+
+    correlator = python_initialize_correlator( reference )
+
+    self.assertNotEquals( correlator, None )
+
+    # The rounding errors of a loud burst leaving the window must not swamp
+    # the energy of the low-level noise that follows it
+    input = [ random.uniform( -1e6, 1e6 ) for i in range( 1500 ) ]
+    input += [ random.uniform( -1e-3, 1e-3 ) for i in range( 4000 ) ]
+
+    normalized = python_correlate( correlator, CSIGNAL_CORRELATION_MODE_NORMALIZED, input )
+
+    self.assertNotEquals( normalized, None )
+
+    valid = python_cross_correlate( input, reference, CSIGNAL_CORRELATION_MODE_VALID )
+
+    self.assertNotEquals( valid, None )
+    self.assertEquals( len( normalized ), len( valid ) )
+
+    squares = [ value * value for value in input ]
+
+    reference_energy = math.fsum( [ value * value for value in reference ] )
+
+    for index in range( len( normalized ) ):
+      window_energy = math.fsum( squares[ index : index + len( reference ) ] )
+
+      expected = valid[ index ] / math.sqrt( reference_energy * window_energy )
+
+      self.assertAlmostEquals( normalized[ index ], expected, 6 )
+
+    self.assertEquals (
+      csignal_destroy_correlator( correlator ),
+      CPC_ERROR_CODE_NO_ERROR
+                      )
+
   def test_conv_negative( self ):
     test = [ 1.0 ]
 
@@ -40,6 +40,186 @@ class TestsCSignal( unittest.TestCase ):
 
     self.assertEquals( csignal_tests.csignal_destroy_passband_filter( filter ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
 
+  def test_filter_with_mode( self ):
+    filter = csignal_tests.python_initialize_kaiser_lowpass_filter( 10000, 12000, 0.1, 80, 48000 )
+
+    self.assertNotEquals( None, filter )
+
+    delay = csignal_tests.python_filter_get_group_delay( filter )
+
+    signal = [ random.normalvariate( 0, 1 ) for i in range( 1000 ) ]
+
+    full = csignal_tests.python_filter_signal( filter, signal )
+
+    self.assertNotEquals( full, None )
+
+    same = \
+      csignal_tests.python_filter_with_mode (
+        filter, csignal_tests.CSIGNAL_CONVOLUTION_MODE_SAME, signal
+                                            )
+
+    self.assertNotEquals( same, None )
+    self.assertEquals( len( same ), len( signal ) )
+
+    for index in range( len( same ) ):
+      self.assertAlmostEquals( same[ index ], full[ index + delay ], 9 )
+
+    valid = \
+      csignal_tests.python_filter_with_mode (
+        filter, csignal_tests.CSIGNAL_CONVOLUTION_MODE_VALID, signal
+                                            )
+
+    self.assertNotEquals( valid, None )
+    self.assertEquals( len( valid ), len( signal ) - 2 * delay )
+
+    for index in range( len( valid ) ):
+      self.assertAlmostEquals( valid[ index ], full[ index + 2 * delay ], 9 )
+
+    self.assertEquals( csignal_tests.csignal_destroy_passband_filter( filter ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+
+  def test_filter_decimated( self ):
+    filter = csignal_tests.python_initialize_kaiser_lowpass_filter( 10000, 12000, 0.1, 80, 48000 )
+
+    self.assertNotEquals( None, filter )
+
+    delay = csignal_tests.python_filter_get_group_delay( filter )
+
+    signal = [ random.normalvariate( 0, 1 ) for i in range( 1000 ) ]
+
+    full = csignal_tests.python_filter_signal( filter, signal )
+
+    self.assertNotEquals( full, None )
+
+    for decimation in [ 1, 2, 3, 8 ]:
+      same = \
+        csignal_tests.python_filter_decimated (
+          filter, csignal_tests.CSIGNAL_CONVOLUTION_MODE_SAME, decimation,
+          signal
+                                              )
+
+      self.assertNotEquals( same, None )
+      self.assertEquals( len( same ), ( len( signal ) + decimation - 1 ) / decimation )
+
+      for index in range( len( same ) ):
+        self.assertAlmostEquals( same[ index ], full[ index * decimation + delay ], 9 )
+
+    self.assertEquals (
+      csignal_tests.python_filter_decimated (
+        filter, csignal_tests.CSIGNAL_CONVOLUTION_MODE_SAME, 0, signal
+                                            ),
+      None
+                      )
+
+    self.assertEquals( csignal_tests.csignal_destroy_passband_filter( filter ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+
+  def test_filter_symmetric( self ):
+    filter = csignal_tests.python_initialize_kaiser_lowpass_filter( 10000, 12000, 0.1, 80, 48000 )
+
+    self.assertNotEquals( None, filter )
+    self.assertEquals( filter.symmetric, csignal_tests.CPC_TRUE )
+
+    signal = [ random.normalvariate( 0, 1 ) for i in range( 1000 ) ]
+
+    folded = csignal_tests.python_filter_signal( filter, signal )
+
+    self.assertNotEquals( folded, None )
+
+    filter.symmetric = csignal_tests.CPC_FALSE
+
+    full = csignal_tests.python_filter_signal( filter, signal )
+
+    self.assertNotEquals( full, None )
+    self.assertEquals( len( folded ), len( full ) )
+
+    for index in range( len( full ) ):
+      self.assertAlmostEquals( folded[ index ], full[ index ], 9 )
+
+    self.assertEquals( csignal_tests.csignal_destroy_passband_filter( filter ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+
+  def test_filter_stream( self ):
+    filter = csignal_tests.python_initialize_kaiser_lowpass_filter( 10000, 12000, 0.1, 80, 48000 )
+
+    self.assertNotEquals( None, filter )
+
+    signal = [ random.normalvariate( 0, 1 ) for i in range( 1000 ) ]
+
+    full = csignal_tests.python_filter_signal( filter, signal )
+
+    self.assertNotEquals( full, None )
+
+    for block_length in [ 1, 7, 256, 257, 1000, 2000 ]:
+      stream = \
+        csignal_tests.python_filter_stream( filter, signal, block_length )
+
+      self.assertNotEquals( stream, None )
+      self.assertEquals( len( stream ), len( signal ) )
+
+      for index in range( len( stream ) ):
+        self.assertAlmostEquals( stream[ index ], full[ index ], 9 )
+
+    self.assertEquals( csignal_tests.python_filter_stream( filter, signal, 0 ), None )
+
+    self.assertEquals( csignal_tests.csignal_destroy_passband_filter( filter ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+
+  def test_decimate_stream( self ):
+    filter = csignal_tests.python_initialize_kaiser_lowpass_filter( 4000, 6000, 0.1, 80, 48000 )
+
+    self.assertNotEquals( None, filter )
+
+    signal = [ random.normalvariate( 0, 1 ) for i in range( 1000 ) ]
+
+    full = csignal_tests.python_filter_signal( filter, signal )
+
+    self.assertNotEquals( full, None )
+
+    for decimation in [ 1, 2, 3, 4, 7 ]:
+      expected = full[ 0 : len( signal ) : decimation ]
+
+      for block_length in [ 1, 5, 256, 300, 1000 ]:
+        decimated = \
+          csignal_tests.python_decimate_stream( filter, decimation, signal, block_length )
+
+        self.assertNotEquals( decimated, None )
+        self.assertEquals( len( decimated ), len( expected ) )
+
+        for index in range( len( decimated ) ):
+          self.assertAlmostEquals( decimated[ index ], expected[ index ], 9 )
+
+    self.assertEquals( csignal_tests.python_decimate_stream( filter, 0, signal, 256 ), None )
+
+    self.assertEquals( csignal_tests.csignal_destroy_passband_filter( filter ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+
+  def test_interpolate_stream( self ):
+    filter = csignal_tests.python_initialize_kaiser_lowpass_filter( 4000, 6000, 0.1, 80, 48000 )
+
+    self.assertNotEquals( None, filter )
+
+    signal = [ random.normalvariate( 0, 1 ) for i in range( 500 ) ]
+
+    for interpolation in [ 1, 2, 3, 4, 7 ]:
+      stuffed = []
+
+      for sample in signal:
+        stuffed += [ sample ] + [ 0.0 ] * ( interpolation - 1 )
+
+      full = csignal_tests.python_filter_signal( filter, stuffed )
+
+      self.assertNotEquals( full, None )
+
+      for block_length in [ 1, 5, 256, 300, 1000 ]:
+        interpolated = \
+          csignal_tests.python_interpolate_stream( filter, interpolation, signal, block_length )
+
+        self.assertNotEquals( interpolated, None )
+        self.assertEquals( len( interpolated ), len( stuffed ) )
+
+        for index in range( len( interpolated ) ):
+          self.assertAlmostEquals( interpolated[ index ], interpolation * full[ index ], 9 )
+
+    self.assertEquals( csignal_tests.python_interpolate_stream( filter, 0, signal, 256 ), None )
+
+    self.assertEquals( csignal_tests.csignal_destroy_passband_filter( filter ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+
   def test_fft_of_lowpass_filter( self ):
     bits_per_symbol     = 1
     constellation_size  = 2 ** bits_per_symbol
@@ -773,6 +953,494 @@ class TestsCSignal( unittest.TestCase ):
     self.assertNotEquals( fft, None )
     self.assertEquals( len( fft ), 512 )
 
+  def test_real_fft( self ):
+    signal = []
+
+    for i in range( 300 ):
+      signal.append( 32767 * random.normalvariate( 0, 1 ) )
+
+    fft = csignal_tests.python_calculate_FFT( signal )
+    real_fft = csignal_tests.python_calculate_real_FFT( signal )
+
+    self.assertNotEquals( fft, None )
+    self.assertNotEquals( real_fft, None )
+    self.assertEquals( len( real_fft ), len( fft ) / 2 + 1 )
+
+    for index in range( len( real_fft ) ):
+      self.assertAlmostEquals( abs( fft[ index ] - real_fft[ index ] ), 0.0, 4 )
+
+    inverse = csignal_tests.python_calculate_real_IFFT( real_fft )
+
+    self.assertNotEquals( inverse, None )
+    self.assertEquals( len( inverse ), len( fft ) )
+
+    for index in range( len( inverse ) ):
+      if( index < len( signal ) ):
+        self.assertAlmostEquals( inverse[ index ], signal[ index ], 6 )
+      else:
+        self.assertAlmostEquals( inverse[ index ], 0.0, 6 )
+
+    self.assertEquals( csignal_tests.python_calculate_real_IFFT( [ 1.0 ] ), None )
+
+  def test_batch_fft( self ):
+    frameLength = 300
+    signal      = []
+
+    for i in range( 5 * frameLength ):
+      signal.append( 32767 * random.normalvariate( 0, 1 ) )
+
+    ffts = csignal_tests.python_calculate_batch_FFT( frameLength, signal )
+
+    self.assertNotEquals( ffts, None )
+    self.assertEquals( len( ffts ), 5 )
+
+    for frame in range( 5 ):
+      fft = \
+        csignal_tests.python_calculate_FFT  (
+          signal[ frame * frameLength : ( frame + 1 ) * frameLength ]
+                                            )
+
+      self.assertEquals( len( ffts[ frame ] ), len( fft ) )
+
+      for index in range( len( fft ) ):
+        self.assertAlmostEquals( abs( ffts[ frame ][ index ] - fft[ index ] ), 0.0, 6 )
+
+    self.assertEquals( csignal_tests.python_calculate_batch_FFT( 7, signal ), None )
+
+  def test_complex_ifft( self ):
+    signal = []
+
+    for i in range( 300 ):
+      signal.append( 32767 * random.normalvariate( 0, 1 ) )
+
+    for fft in  [
+                 csignal_tests.python_calculate_FFT( signal ),
+                 csignal_tests.python_calculate_exact_FFT( signal )
+                 ]:
+      self.assertNotEquals( fft, None )
+
+      inverse = csignal_tests.python_calculate_complex_IFFT( fft )
+
+      self.assertNotEquals( inverse, None )
+      self.assertEquals( len( inverse ), len( fft ) )
+
+      for index in range( len( inverse ) ):
+        if( index < len( signal ) ):
+          self.assertAlmostEquals( inverse[ index ].real, signal[ index ], 6 )
+        else:
+          self.assertAlmostEquals( inverse[ index ].real, 0.0, 6 )
+
+        self.assertAlmostEquals( inverse[ index ].imag, 0.0, 6 )
+
+    self.assertEquals( csignal_tests.python_calculate_complex_IFFT( [] ), None )
+
+  def test_exact_fft( self ):
+    for length in [ 1, 48, 49, 97, 300, 256 ]:
+      signal = []
+
+      for i in range( length ):
+        signal.append( 32767 * random.normalvariate( 0, 1 ) )
+
+      fft = csignal_tests.python_calculate_exact_FFT( signal )
+
+      self.assertNotEquals( fft, None )
+      self.assertEquals( len( fft ), length )
+
+      for k in range( length ):
+        real = 0.0
+        imaginary = 0.0
+
+        for j in range( length ):
+          theta = 2 * math.pi * ( ( j * k ) % length ) / length
+
+          real += signal[ j ] * math.cos( theta )
+          imaginary += signal[ j ] * math.sin( theta )
+
+        self.assertAlmostEquals( fft[ k ].real / length, real / length, 6 )
+        self.assertAlmostEquals( fft[ k ].imag / length, imaginary / length, 6 )
+
+    self.assertEquals( csignal_tests.python_calculate_exact_FFT( [] ), None )
+
+  def test_execute_fft_out_of_place( self ):
+    for exact, lengths in [ ( False, [ 1, 64 ] ), ( True, [ 1, 60, 64, 97 ] ) ]:
+      for length in lengths:
+        data = []
+
+        for i in range( length ):
+          data.append (
+            complex (
+              32767 * random.normalvariate( 0, 1 ),
+              32767 * random.normalvariate( 0, 1 )
+                    )
+                      )
+
+        for inverse in [ False, True ]:
+          if( inverse ):
+            sign = -1
+          else:
+            sign = 1
+
+          ( code, in_place ) = \
+            csignal_tests.python_execute_FFT_out_of_place( data, exact, inverse, 0 )
+
+          self.assertEquals( code, csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+          self.assertEquals( len( in_place ), length )
+
+          ( code, out_of_place ) = \
+            csignal_tests.python_execute_FFT_out_of_place (
+              data, exact, inverse, 2 * length
+                                                          )
+
+          self.assertEquals( code, csignal_tests.CPC_ERROR_CODE_NO_ERROR )
+          self.assertEquals( len( out_of_place ), length )
+
+          for k in range( length ):
+            expected = 0.0
+
+            for j in range( length ):
+              theta = sign * 2 * math.pi * ( ( j * k ) % length ) / length
+
+              expected += data[ j ] * complex( math.cos( theta ), math.sin( theta ) )
+
+            self.assertAlmostEquals( abs( in_place[ k ] - expected ) / length, 0.0, 6 )
+            self.assertAlmostEquals( abs( out_of_place[ k ] - in_place[ k ] ) / length, 0.0, 6 )
+
+          for offset in [ 1, 2 * length - 1 ]:
+            self.assertEquals (
+              csignal_tests.python_execute_FFT_out_of_place (
+                data, exact, inverse, offset
+                                                            ),
+              ( csignal_tests.CPC_ERROR_CODE_INVALID_PARAMETER, None )
+                              )
+
+    self.assertEquals (
+      csignal_tests.python_execute_FFT_out_of_place( [], False, False, 0 ),
+      None
+                      )
+
+  def test_zoom_fft( self ):
+    sample_rate = 8000
+    signal      = []
+
+    for i in range( 500 ):
+      signal.append( 32767 * random.normalvariate( 0, 1 ) )
+
+    for ( start, end, bins ) in [ ( 1000.0, 1100.0, 64 ), ( 2000.5, 1900.25, 9 ) ]:
+      fft = \
+        csignal_tests.python_calculate_zoom_FFT (
+          signal, sample_rate, start, end, bins
+                                                )
+
+      self.assertNotEquals( fft, None )
+      self.assertEquals( len( fft ), bins )
+
+      for k in range( bins ):
+        frequency = start + k * ( end - start ) / bins
+        real      = 0.0
+        imaginary = 0.0
+
+        for j in range( len( signal ) ):
+          theta = 2 * math.pi * frequency * j / sample_rate
+
+          real += signal[ j ] * math.cos( theta )
+          imaginary += signal[ j ] * math.sin( theta )
+
+        self.assertAlmostEquals( fft[ k ].real / len( signal ), real / len( signal ), 6 )
+        self.assertAlmostEquals( fft[ k ].imag / len( signal ), imaginary / len( signal ), 6 )
+
+    # Bins spaced by sample_rate / len( signal ) are the exact-length FFT
+    exact = csignal_tests.python_calculate_exact_FFT( signal )
+    fft   = \
+      csignal_tests.python_calculate_zoom_FFT (
+        signal, sample_rate, 0.0, float( sample_rate ), len( signal )
+                                              )
+
+    for k in range( len( signal ) ):
+      self.assertAlmostEquals( abs( fft[ k ] - exact[ k ] ) / len( signal ), 0.0, 6 )
+
+    self.assertEquals( csignal_tests.python_calculate_zoom_FFT( [], sample_rate, 0.0, 1.0, 1 ), None )
+    self.assertEquals( csignal_tests.python_calculate_zoom_FFT( signal, 0, 0.0, 1.0, 1 ), None )
+    self.assertEquals( csignal_tests.python_calculate_zoom_FFT( signal, sample_rate, 0.0, 1.0, 0 ), None )
+
+  def test_fft_float32( self ):
+    signal = []
+
+    for i in range( 1000 ):
+      signal.append( float( random.randint( -32768, 32767 ) ) )
+
+    fft         = csignal_tests.python_calculate_FFT( signal )
+    fft_float32 = csignal_tests.python_calculate_FFT_float32( signal )
+
+    self.assertNotEquals( fft, None )
+    self.assertNotEquals( fft_float32, None )
+    self.assertEquals( len( fft_float32 ), len( fft ) )
+
+    error = 0.0
+    power = 0.0
+
+    for index in range( len( fft ) ):
+      error += abs( fft_float32[ index ] - fft[ index ] ) ** 2
+      power += abs( fft[ index ] ) ** 2
+
+    self.assertAlmostEquals( math.sqrt( error / power ), 0.0, 6 )
+
+    self.assertEquals( csignal_tests.python_calculate_FFT_float32( [] ), None )
+
+  def test_fft_kernels( self ):
+    signal = []
+
+    for i in range( 1000 ):
+      signal.append( 32767 * random.normalvariate( 0, 1 ) )
+
+    selected = csignal_tests.csignal_fft_get_kernel()
+
+    self.assertEquals (
+      csignal_tests.csignal_fft_set_kernel( csignal_tests.CSIGNAL_FFT_KERNEL_SCALAR ),
+      csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                      )
+
+    expected = csignal_tests.python_calculate_FFT( signal )
+
+    self.assertNotEquals( expected, None )
+
+    kernels = [
+      csignal_tests.CSIGNAL_FFT_KERNEL_SSE2,
+      csignal_tests.CSIGNAL_FFT_KERNEL_AVX2,
+      csignal_tests.CSIGNAL_FFT_KERNEL_NEON
+              ]
+
+    for kernel in kernels:
+      if( csignal_tests.CPC_ERROR_CODE_NO_ERROR == csignal_tests.csignal_fft_set_kernel( kernel ) ):
+        self.assertEquals( csignal_tests.csignal_fft_get_kernel(), kernel )
+
+        fft = csignal_tests.python_calculate_FFT( signal )
+
+        self.assertNotEquals( fft, None )
+        self.assertEquals( len( fft ), len( expected ) )
+
+        for index in range( len( fft ) ):
+          self.assertAlmostEquals( abs( fft[ index ] - expected[ index ] ), 0.0, 4 )
+
+    self.assertEquals (
+      csignal_tests.csignal_fft_set_kernel( selected ),
+      csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                      )
+
+  def test_stft( self ):
+    signal = []
+
+    for i in range( 4000 ):
+      signal.append( math.sin( 2 * math.pi * 1000.0 * i / 48000.0 ) )
+
+    frames = \
+      csignal_tests.python_calculate_STFT (
+        1024, 256, 1024, csignal_tests.CSIGNAL_WINDOW_HANN, True, signal
+                                          )
+
+    self.assertNotEquals( frames, None )
+    self.assertEquals( len( frames ), ( 4000 - 1024 ) / 256 + 1 )
+
+    for frame in frames:
+      self.assertEquals( len( frame ), 513 )
+      self.assertEquals( frame.index( max( frame ) ), 21 )
+
+    dc = [ 1.0 ] * 64
+
+    frames = \
+      csignal_tests.python_calculate_STFT (
+        64, 64, 64, csignal_tests.CSIGNAL_WINDOW_RECTANGULAR, True, dc
+                                          )
+
+    self.assertAlmostEquals( frames[ 0 ][ 0 ], 64.0, 6 )
+
+    frames = \
+      csignal_tests.python_calculate_STFT (
+        64, 64, 64, csignal_tests.CSIGNAL_WINDOW_HANN, True, dc
+                                          )
+
+    self.assertAlmostEquals( frames[ 0 ][ 0 ], 32.0, 6 )
+
+    self.assertEquals (
+      csignal_tests.python_calculate_STFT (
+        64, 65, 64, csignal_tests.CSIGNAL_WINDOW_HANN, True, dc
+                                          ),
+      None
+                      )
+
+    self.assertEquals (
+      csignal_tests.python_calculate_STFT (
+        64, 16, 96, csignal_tests.CSIGNAL_WINDOW_HANN, True, dc
+                                          ),
+      None
+                      )
+
+  def test_istft( self ):
+    signal = []
+
+    for i in range( 2000 ):
+      signal.append( float( random.randint( -32768, 32767 ) ) )
+
+    frames = \
+      csignal_tests.python_calculate_STFT (
+        256, 64, 512, csignal_tests.CSIGNAL_WINDOW_HANN, False, signal
+                                          )
+
+    self.assertNotEquals( frames, None )
+
+    concatenated = []
+
+    for frame in frames:
+      self.assertEquals( len( frame ), 514 )
+
+      concatenated.extend( frame )
+
+    reconstructed = \
+      csignal_tests.python_calculate_ISTFT  (
+        256, 64, 512, csignal_tests.CSIGNAL_WINDOW_HANN, concatenated
+                                            )
+
+    self.assertNotEquals( reconstructed, None )
+    self.assertEquals( len( reconstructed ), len( frames ) * 64 + 192 )
+
+    # The first sample is zero in every Hann window
+    for index in range( 1, len( reconstructed ) ):
+      self.assertAlmostEquals( reconstructed[ index ], signal[ index ], 6 )
+
+    self.assertEquals (
+      csignal_tests.python_calculate_ISTFT  (
+        256, 64, 512, csignal_tests.CSIGNAL_WINDOW_HANN, concatenated[ 1 : ]
+                                            ),
+      None
+                      )
+
+  def test_welch_psd( self ):
+    signal = []
+
+    for i in range( 20000 ):
+      signal.append( random.normalvariate( 0, 2 ) )
+
+    psd = \
+      csignal_tests.python_calculate_welch_PSD (
+        signal, 1000, 256, 128, csignal_tests.CSIGNAL_WINDOW_HANN, 0.0
+                                               )
+
+    self.assertNotEquals( psd, None )
+    self.assertEquals( len( psd ), 129 )
+
+    # White noise of variance 4 has a one-sided density of 2 * 4 / 1000
+    mean = sum( psd[ 1 : 128 ] ) / 127.0
+
+    self.assertAlmostEquals( mean / 0.008, 1.0, 1 )
+
+    # The segments are summed in the same groups for any number of threads
+    for threads in [ 1, 4 ]:
+      self.assertEquals (
+        csignal_tests.csignal_set_number_of_threads( threads ),
+        csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                        )
+
+      self.assertEquals (
+        csignal_tests.python_calculate_welch_PSD (
+          signal, 1000, 256, 128, csignal_tests.CSIGNAL_WINDOW_HANN, 0.0
+                                                 ),
+        psd
+                        )
+
+    self.assertEquals (
+      csignal_tests.csignal_set_number_of_threads( 1 ),
+      csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                      )
+
+    signal = []
+
+    for i in range( 20000 ):
+      signal.append( 3.0 * math.cos( 2 * math.pi * 125.0 * i / 1000.0 ) )
+
+    for window in  [
+                    csignal_tests.CSIGNAL_WINDOW_HANN,
+                    csignal_tests.CSIGNAL_WINDOW_HAMMING,
+                    csignal_tests.CSIGNAL_WINDOW_KAISER
+                   ]:
+      psd = \
+        csignal_tests.python_calculate_welch_PSD (
+          signal, 1000, 256, 64, window, 6.0
+                                                 )
+
+      self.assertNotEquals( psd, None )
+      self.assertEquals( psd.index( max( psd ) ), 32 )
+
+      # The PSD integrates to the power of the cosine
+      self.assertAlmostEquals( sum( psd ) * 1000.0 / 256.0, 4.5, 3 )
+
+    self.assertEquals (
+      csignal_tests.python_calculate_welch_PSD (
+        signal, 1000, 256, 256, csignal_tests.CSIGNAL_WINDOW_HANN, 0.0
+                                               ),
+      None
+                      )
+
+    self.assertEquals (
+      csignal_tests.python_calculate_welch_PSD (
+        signal, 1000, 200, 100, csignal_tests.CSIGNAL_WINDOW_HANN, 0.0
+                                               ),
+      None
+                      )
+
+  def test_large_fft( self ):
+    length    = 2 ** 22
+    frequency = 1234
+    signal    = []
+
+    for i in range( length ):
+      signal.append( math.cos( 2 * math.pi * frequency * i / length ) )
+
+    for threads in [ 1, 4 ]:
+      self.assertEquals (
+        csignal_tests.csignal_set_number_of_threads( threads ),
+        csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                        )
+
+      fft = csignal_tests.python_calculate_FFT( signal )
+
+      self.assertNotEquals( fft, None )
+      self.assertEquals( len( fft ), length )
+
+      self.assertAlmostEquals( fft[ frequency ].real, length / 2, 6 )
+      self.assertAlmostEquals( fft[ length - frequency ].real, length / 2, 6 )
+
+      fft[ frequency ]          = 0
+      fft[ length - frequency ] = 0
+
+      self.assertAlmostEquals( max( [ abs( value ) for value in fft ] ), 0.0, 5 )
+
+    self.assertEquals (
+      csignal_tests.csignal_set_number_of_threads( 1 ),
+      csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                      )
+
+  def test_large_fft_concurrently( self ):
+    length  = 2 ** 22
+    signal  = []
+
+    for i in range( length ):
+      signal.append( random.uniform( -1.0, 1.0 ) )
+
+    for threads in [ 1, 4 ]:
+      self.assertEquals (
+        csignal_tests.csignal_set_number_of_threads( threads ),
+        csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                        )
+
+      self.assertEquals (
+        csignal_tests.python_calculate_FFT_concurrently( signal, 4 ),
+        0.0
+                        )
+
+    self.assertEquals (
+      csignal_tests.csignal_set_number_of_threads( 1 ),
+      csignal_tests.CPC_ERROR_CODE_NO_ERROR
+                      )
+
   def test_initialize_kaiser_filter( self ):
     filter = csignal_tests.python_initialize_kaiser_filter( 3000, 4000, 6000, 5000, 0.1, 80, 0 )
 
@@ -1350,6 +2018,73 @@ class TestsCSignal( unittest.TestCase ):
 
     self.assertEquals( csignal_tests.bit_stream_destroy( symbol_tracker ), csignal_tests.CPC_ERROR_CODE_NO_ERROR )
 
+  def test_demodulate_signal( self ):
+    for symbol in [ 0, 1, 1, 0, 1 ]:
+      signal = \
+        csignal_tests.python_csignal_modulate_BFSK_symbol (
+          symbol,
+          480,
+          48000,
+          12000,
+          2,
+          1
+                                                          )
+
+      self.assertNotEquals( signal, None )
+
+      part = []
+
+      for index in range( len( signal[ 0 ] ) ):
+        part.append (
+          signal[ 0 ][ index ] - signal[ 1 ][ index ]
+          + random.uniform( -0.5, 0.5 )
+                    )
+
+      self.assertEquals (
+        csignal_tests.python_csignal_demodulate_BFSK_symbol (
+          480,
+          48000,
+          12000,
+          2,
+          part
+                                                            ),
+        symbol
+                        )
+
+    self.assertEquals (
+      csignal_tests.python_csignal_demodulate_BFSK_symbol (
+        480, 48000, 12000, 2, [ 0.0 ] * 479
+                                                          ),
+      None
+                      )
+
+  def test_tone_bank( self ):
+    signal = []
+
+    for i in range( 5000 ):
+      signal.append (
+        math.cos( 2 * math.pi * 1000.0 * i / 8000.0 )
+        + 0.5 * math.sin( 2 * math.pi * 2500.0 * i / 8000.0 )
+                    )
+
+    power = \
+      csignal_tests.python_tone_bank_get_power  (
+        [ 1000.0, 2500.0, 3000.0 ], 8000, 400, signal
+                                                )
+
+    self.assertNotEquals( power, None )
+    self.assertEquals( len( power ), 3 )
+
+    # A cosine of amplitude A on a bin has a power of ( A * N / 2 )^2
+    self.assertAlmostEquals( power[ 0 ] / 40000.0, 1.0, 6 )
+    self.assertAlmostEquals( power[ 1 ] / 10000.0, 1.0, 6 )
+    self.assertAlmostEquals( power[ 2 ] / 40000.0, 0.0, 6 )
+
+    self.assertEquals (
+      csignal_tests.python_tone_bank_get_power( [], 8000, 400, signal ),
+      None
+                      )
+
 if __name__ == '__main__':
   csignal_tests.cpc_log_set_log_level( csignal_tests.CPC_LOG_LEVEL_ERROR )
 